@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include "Activity.h"
+#include "Breakdown.h"
+#include "Param.h"
+
+using namespace std;
+
+extern Param *param;
+
+const int numActivityBin = 10;      // row activity histogram: [0, 0.1), [0.1, 0.2), ..., [0.9, 1]
+
+struct ActivityCounter {
+	string instance;
+	double numRead;                 // # of input vectors applied to the subArray
+	double numZeroVector;           // # of them without any active row
+	double numADC;                  // # of column conversions of the ADCs (or S/As)
+	double sumActivity;             // sum of the fraction of active rows
+	double sumConductance;          // sum of the column conductance (S) ...
+	double numConductance;          // ... over this # of columns
+	vector<double> histogram;       // # of input vectors in each bin of row activity
+};
+
+vector<ActivityCounter> activity;   // in the order the subArrays are simulated
+map<string, int> activityIndex;     // instance path --> position in activity
+
+void ActivityClear() {
+	// drop the subArrays under the current path (the layer is simulated again)
+	if (!param->activity) {
+		return;
+	}
+	string prefix = BreakdownCurrentPath() + ";";
+	vector<ActivityCounter> keep;
+	activityIndex.clear();
+	for (int i=0; i<activity.size(); i++) {
+		if (activity[i].instance.compare(0, prefix.size(), prefix) != 0) {
+			activityIndex[activity[i].instance] = keep.size();
+			keep.push_back(activity[i]);
+		}
+	}
+	activity.swap(keep);
+}
+
+
+void ActivityRecord(double activityRowRead, int numRow, const vector<double> &columnResistance) {
+	if (!param->activity) {
+		return;
+	}
+	const string &instance = BreakdownCurrentPath();
+	map<string, int>::iterator it = activityIndex.find(instance);
+	if (it == activityIndex.end()) {
+		ActivityCounter counter;
+		counter.instance = instance;
+		counter.numRead = 0;
+		counter.numZeroVector = 0;
+		counter.numADC = 0;
+		counter.sumActivity = 0;
+		counter.sumConductance = 0;
+		counter.numConductance = 0;
+		counter.histogram.assign(numActivityBin, 0);
+		it = activityIndex.insert(make_pair(instance, (int) activity.size())).first;
+		activity.push_back(counter);
+	}
+	ActivityCounter &counter = activity[it->second];
+	
+	counter.numRead += 1;
+	counter.sumActivity += activityRowRead;
+	if (activityRowRead == 0) {
+		counter.numZeroVector += 1;
+	}
+	int bin = (int) floor(activityRowRead*numActivityBin);
+	counter.histogram[bin < numActivityBin? bin : numActivityBin-1] += 1;
+	
+	// parallel read converts every column once, row-by-row read converts every column once per active row
+	double numActiveRow = floor(activityRowRead*numRow + 0.5);
+	counter.numADC += param->parallelRead? columnResistance.size() : columnResistance.size()*numActiveRow;
+	for (int j=0; j<columnResistance.size(); j++) {
+		double conductance = 1/columnResistance[j];
+		if (conductance == conductance) {       // no active row in row-by-row read leaves the column undefined
+			counter.sumConductance += conductance;
+			counter.numConductance += 1;
+		}
+	}
+}
+
+
+void ActivityWrite(const string &filename) {
+	ofstream file(filename.c_str());
+	if (!file.is_open()) {
+		cout << "ERROR: cannot write the subArray activity to " << filename << endl;
+		return;
+	}
+	file << "instance,numRead,zeroVectorFraction,avgRowActivity,numADC,avgColumnConductance";
+	for (int b=0; b<numActivityBin; b++) {
+		file << ",rowActivity" << b*100/numActivityBin << "-" << (b+1)*100/numActivityBin << "%";
+	}
+	file << endl;
+	file.precision(17);
+	double numRead = 0, numZeroVector = 0;
+	for (int i=0; i<activity.size(); i++) {
+		const ActivityCounter &c = activity[i];
+		string instance = c.instance.substr(c.instance.find(';')+1);      // without the leading "chip"
+		for (int k=0; k<instance.size(); k++) {
+			if (instance[k] == ';') {
+				instance[k] = '/';
+			}
+		}
+		file << instance << "," << c.numRead << "," << c.numZeroVector/c.numRead << "," << c.sumActivity/c.numRead << "," << c.numADC << ","
+			<< (c.numConductance > 0? c.sumConductance/c.numConductance : 0);
+		for (int b=0; b<numActivityBin; b++) {
+			file << "," << c.histogram[b];
+		}
+		file << endl;
+		numRead += c.numRead;
+		numZeroVector += c.numZeroVector;
+	}
+	cout << "Activity of " << activity.size() << " subArrays written to " << filename << " (" << numZeroVector/max(numRead, 1.0)*100 << "% all-zero input vectors)" << endl;
+}
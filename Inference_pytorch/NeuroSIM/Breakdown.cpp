@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <sstream>
+#include "Breakdown.h"
+#include "Param.h"
+
+using namespace std;
+
+extern Param *param;
+
+vector<string> breakdownPath;                       // current instance path
+string breakdownPrefix;                             // breakdownPath joined by ';'
+map<string, pair<double, double> > breakdownTree;   // full path --> (latency, energy)
+
+void BreakdownPush(const string &name) {
+	if (!param->breakdown && !param->activity) {
+		return;
+	}
+	breakdownPath.push_back(name);
+	breakdownPrefix = breakdownPrefix.empty()? name : breakdownPrefix + ";" + name;
+}
+
+
+void BreakdownPush(const string &name, int row, int col) {
+	// indexed instance, e.g. tile2_3 or layer1
+	if (!param->breakdown && !param->activity) {
+		return;
+	}
+	ostringstream instance;
+	instance << name << row;
+	if (col >= 0) {
+		instance << "_" << col;
+	}
+	BreakdownPush(instance.str());
+}
+
+
+void BreakdownPop() {
+	if (!param->breakdown && !param->activity) {
+		return;
+	}
+	breakdownPath.pop_back();
+	breakdownPrefix.clear();
+	for (int i=0; i<breakdownPath.size(); i++) {
+		breakdownPrefix += (i > 0)? ";" + breakdownPath[i] : breakdownPath[i];
+	}
+}
+
+
+const string &BreakdownCurrentPath() {
+	return breakdownPrefix;
+}
+
+
+void BreakdownAdd(const string &name, double latency, double energy) {
+	if (!param->breakdown || (latency == 0 && energy == 0)) {
+		return;
+	}
+	pair<double, double> &node = breakdownTree[breakdownPrefix.empty()? name : breakdownPrefix + ";" + name];
+	node.first += latency;
+	node.second += energy;
+}
+
+
+void BreakdownClear() {
+	// drop everything under the current path (the instance is simulated again)
+	if (!param->breakdown) {
+		return;
+	}
+	string prefix = breakdownPrefix + ";";
+	map<string, pair<double, double> >::iterator it = breakdownTree.lower_bound(prefix);
+	while (it != breakdownTree.end() && it->first.compare(0, prefix.size(), prefix) == 0) {
+		breakdownTree.erase(it++);
+	}
+}
+
+
+void BreakdownByComponent(vector<string> *name, vector<double> *latency, vector<double> *energy) {
+	// totals of each kind of circuit (last element of the path) over all its instances
+	map<string, pair<double, double> > total;
+	for (map<string, pair<double, double> >::iterator it = breakdownTree.begin(); it != breakdownTree.end(); it++) {
+		string leaf = it->first.substr(it->first.rfind(';')+1);
+		total[leaf].first += it->second.first;
+		total[leaf].second += it->second.second;
+	}
+	name->clear();
+	latency->clear();
+	energy->clear();
+	for (map<string, pair<double, double> >::iterator it = total.begin(); it != total.end(); it++) {
+		name->push_back(it->first);
+		latency->push_back(it->second.first);
+		energy->push_back(it->second.second);
+	}
+}
+
+
+void BreakdownWriteFolded(const string &filename, bool latency) {
+	// folded stacks ("chip;layer1;...;wlDecoder 1234"), the input format of flamegraph.pl and speedscope; latency in ps, energy in fJ
+	ofstream file(filename.c_str());
+	if (!file.good()) {
+		cerr << "Error: the folded stack file " << filename << " cannot be opened!" << endl;
+		return;
+	}
+	for (map<string, pair<double, double> >::iterator it = breakdownTree.begin(); it != breakdownTree.end(); it++) {
+		long long value = llround(latency? it->second.first*1e12 : it->second.second*1e15);
+		if (value > 0) {
+			file << it->first << " " << value << endl;
+		}
+	}
+	file.close();
+}
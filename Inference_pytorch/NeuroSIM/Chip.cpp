@@ -1,1252 +1,1930 @@
-/*******************************************************************************
-* Copyright (c) 2015-2017
-* School of Electrical, Computer and Energy Engineering, Arizona State University
-* PI: Prof. Shimeng Yu
-* All rights reserved.
-* 
-* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
-* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
-* Copyright of the model is maintained by the developers, and the model is distributed under 
-* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
-* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
-* The source code is free and you can redistribute and/or modify it
-* by providing that the following conditions are met:
-* 
-*  1) Redistributions of source code must retain the above copyright notice,
-*     this list of conditions and the following disclaimer.
-* 
-*  2) Redistributions in binary form must reproduce the above copyright notice,
-*     this list of conditions and the following disclaimer in the documentation
-*     and/or other materials provided with the distribution.
-* 
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-* 
-* Developer list: 
-*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
-*                    
-*   Xiaochen Peng   Email: xpeng15 at asu dot edu
-********************************************************************************/
-
-#include <cmath>
-#include <iostream>
-#include <fstream>
-#include <string>
-#include <stdlib.h>
-#include <vector>
-#include <sstream>
-#include "MaxPooling.h"
-#include "Sigmoid.h"
-#include "BitShifter.h"
-#include "AdderTree.h"
-#include "Buffer.h"
-#include "HTree.h"
-#include "ProcessingUnit.h"
-#include "Tile.h"
-#include "constant.h"
-#include "formula.h"
-#include "Param.h"
-#include "Chip.h"
-
-using namespace std;
-
-extern Param *param;
-
-/*** Circuit Modules ***/
-Buffer *globalBuffer;
-HTree *GhTree;
-AdderTree *Gaccumulation;
-Sigmoid *Gsigmoid;
-BitShifter *GreLu;
-MaxPooling *maxPool;
-
-
-vector<int> ChipDesignInitialize(InputParameter& inputParameter, Technology& tech, MemCell& cell, const vector<vector<double> > &netStructure,
-					double *maxPESizeNM, double *maxTileSizeCM, double *numPENM){
-
-	globalBuffer = new Buffer(inputParameter, tech, cell);
-	GhTree = new HTree(inputParameter, tech, cell);
-	Gaccumulation = new AdderTree(inputParameter, tech, cell);
-	Gsigmoid = new Sigmoid(inputParameter, tech, cell);
-	GreLu = new BitShifter(inputParameter, tech, cell);
-	maxPool = new MaxPooling(inputParameter, tech, cell);
-
-	int numRowPerSynapse, numColPerSynapse;
-	numRowPerSynapse = param->numRowPerSynapse;
-	numColPerSynapse = param->numColPerSynapse;
-	
-	double numLayer, minCube;
-	
-	// get information of network structure
-	numLayer = netStructure.size();
-	
-	*maxPESizeNM = 0;
-	*maxTileSizeCM = 0;
-	*numPENM = 0;
-
-	vector<int> markNM;
-	if (param->novelMapping) {
-		// define number of PE in COV layers
-		int most = 0;
-		int numPE = 0;
-		for (int i=0; i<numLayer; i++) {
-			int temp = netStructure[i][3]*netStructure[i][4];
-			int count = 1;
-			for (int j=0; j<numLayer; j++) {
-				if (temp == netStructure[j][3]*netStructure[j][4]) {
-					count ++;
-				}
-				if (most < count) {
-					most = count;
-					numPE = temp;
-				}
-			}
-		}
-		*numPENM = numPE;
-		// mark the layers that use novel mapping
-		for (int i=0; i<numLayer; i++) {
-			
-			if ((netStructure[i][3]*netStructure[i][4]== (*numPENM))
-				// large Cov layers use novel mapping
-				&&(netStructure[i][2]*netStructure[i][3]*netStructure[i][4]*numRowPerSynapse >= param->numRowSubArray)) {
-				markNM.push_back(1);
-				minCube = pow(2, ceil((double) log2((double) netStructure[i][5]*(double) numColPerSynapse) ) );
-				*maxPESizeNM = max(minCube, (*maxPESizeNM));
-			} else {
-				// small Cov layers and FC layers use conventional mapping
-				markNM.push_back(0);
-				minCube = pow(2, ceil((double) log2((double) netStructure[i][5]*(double) numColPerSynapse) ) );
-				*maxTileSizeCM = max(minCube, (*maxTileSizeCM));
-			}
-		}
-	} else {
-		// all layers use conventional mapping
-		for (int i=0; i<numLayer; i++) {
-			markNM.push_back(0);
-			minCube = pow(2, ceil((double) log2((double) netStructure[i][5]*(double) numColPerSynapse) ) );
-			*maxTileSizeCM = max(minCube, (*maxTileSizeCM));
-		}
-	}
-	
-	return markNM;
-}
-
-
-vector<vector<double> > ChipFloorPlan(bool findNumTile, bool findUtilization, bool findSpeedUp, const vector<vector<double> > &netStructure, const vector<int > &markNM, 
-					double maxPESizeNM, double maxTileSizeCM, double numPENM,
-					double *desiredNumTileNM, double *desiredPESizeNM, double *desiredNumTileCM, double *desiredTileSizeCM, double *desiredPESizeCM, int *numTileRow, int *numTileCol) {
-	
-	
-	int numRowPerSynapse, numColPerSynapse;
-	numRowPerSynapse = param->numRowPerSynapse;
-	numColPerSynapse = param->numColPerSynapse;
-	
-	double maxUtilizationNM = 0;
-	double maxUtilizationCM = 0;
-	
-	vector<vector<double> > peDup;
-	vector<vector<double> > subArrayDup;
-	vector<vector<double> > numTileEachLayer;
-	vector<vector<double> > utilizationEachLayer;
-	vector<vector<double> > speedUpEachLayer;
-	
-	*desiredNumTileNM = 0;
-	*desiredPESizeNM = 0;
-	*desiredNumTileCM = 0;
-	*desiredTileSizeCM = 0;
-	*desiredPESizeCM = 0;
-	*numTileRow = 0;
-	*numTileCol = 0;
-
-	if (param->novelMapping) {		// Novel Mapping
-		if (maxPESizeNM < 2*param->numRowSubArray) {
-			cout << "ERROR: SubArray Size is too large, which break the chip hierarchey, please decrease the SubArray size! " << endl;
-		}else{
-		
-			/*** Tile Design ***/
-			*desiredPESizeNM = MAX(maxPESizeNM, 2*param->numRowSubArray);
-			vector<double> initialDesignNM;
-			initialDesignNM = TileDesignNM((*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
-			*desiredNumTileNM = initialDesignNM[0];
-			for (double thisPESize = MAX(maxPESizeNM, 2*param->numRowSubArray); thisPESize> 2*param->numRowSubArray; thisPESize/=2) {
-				// for layers use novel mapping
-				double thisUtilization = 0;
-				vector<double> thisDesign;
-				thisDesign = TileDesignNM(thisPESize, markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
-				thisUtilization = thisDesign[2];
-				if (thisUtilization > maxUtilizationNM) {
-					maxUtilizationNM = thisUtilization;
-					*desiredPESizeNM = thisPESize;
-					*desiredNumTileNM = thisDesign[0];
-				}
-			}
-			*desiredTileSizeCM = MAX(maxTileSizeCM, 4*param->numRowSubArray);
-			vector<double> initialDesignCM;
-			initialDesignCM = TileDesignCM((*desiredTileSizeCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-			*desiredNumTileCM = initialDesignCM[0];
-			for (double thisTileSize = MAX(maxTileSizeCM, 4*param->numRowSubArray); thisTileSize > 4*param->numRowSubArray; thisTileSize/=2) {
-				// for layers use conventional mapping
-				double thisUtilization = 0;
-				vector<double> thisDesign;
-				thisDesign = TileDesignCM(thisTileSize, markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-				thisUtilization = thisDesign[2];
-				if (thisUtilization > maxUtilizationCM) {
-					maxUtilizationCM = thisUtilization;
-					*desiredTileSizeCM = thisTileSize;
-					*desiredNumTileCM = thisDesign[0];
-				}
-			}
-			*desiredPESizeCM = (*desiredTileSizeCM)/2;
-			/*** PE Design ***/
-			for (double thisPESize = (*desiredTileSizeCM)/2; thisPESize > 2*param->numRowSubArray; thisPESize/=2) {
-				// define PE Size for layers use conventional mapping
-				double thisUtilization = 0;
-				vector<vector<double> > thisDesign;
-				thisDesign = PEDesign(true, thisPESize, (*desiredTileSizeCM), (*desiredNumTileCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-				thisUtilization = thisDesign[1][0];
-				if (thisUtilization > maxUtilizationCM) {
-					maxUtilizationCM = thisUtilization;
-					*desiredPESizeCM = thisPESize;
-				}
-			}
-			peDup = PEDesign(false, (*desiredPESizeCM), (*desiredTileSizeCM), (*desiredNumTileCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-			/*** SubArray Duplication ***/
-			subArrayDup = SubArrayDup((*desiredPESizeCM), (*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-			/*** Design SubArray ***/
-			numTileEachLayer = OverallEachLayer(false, false, peDup, subArrayDup, (*desiredTileSizeCM), (*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
-			utilizationEachLayer = OverallEachLayer(true, false, peDup, subArrayDup, (*desiredTileSizeCM), (*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
-			speedUpEachLayer = OverallEachLayer(false, true, peDup, subArrayDup, (*desiredTileSizeCM), (*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
-		}
-	} else {   // all Conventional Mapping
-		if (maxTileSizeCM < 4*param->numRowSubArray) {
-			cout << "ERROR: SubArray Size is too large, which break the chip hierarchey, please decrease the SubArray size! " << endl;
-		} else {
-			/*** Tile Design ***/
-			*desiredTileSizeCM = MAX(maxTileSizeCM, 4*param->numRowSubArray);
-			vector<double> initialDesign;
-			initialDesign = TileDesignCM((*desiredTileSizeCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-			*desiredNumTileCM = initialDesign[0];
-			for (double thisTileSize = MAX(maxTileSizeCM, 4*param->numRowSubArray); thisTileSize > 4*param->numRowSubArray; thisTileSize/=2) {
-				// for layers use conventional mapping
-				double thisUtilization = 0;
-				vector<double> thisDesign;
-				thisDesign = TileDesignCM(thisTileSize, markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-				thisUtilization = thisDesign[2];
-				if (thisUtilization > maxUtilizationCM) {
-					maxUtilizationCM = thisUtilization;
-					*desiredTileSizeCM = thisTileSize;
-					*desiredNumTileCM = thisDesign[0];
-				}
-			}
-			*desiredPESizeCM = (*desiredTileSizeCM)/2;
-			/*** PE Design ***/
-			for (double thisPESize = (*desiredTileSizeCM)/2; thisPESize > 2*param->numRowSubArray; thisPESize/=2) {
-				// define PE Size for layers use conventional mapping
-				double thisUtilization = 0;
-				vector<vector<double> > thisDesign;
-				thisDesign = PEDesign(true, thisPESize, (*desiredTileSizeCM), (*desiredNumTileCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-				thisUtilization = thisDesign[1][0];
-				if (thisUtilization > maxUtilizationCM) {
-					maxUtilizationCM = thisUtilization;
-					*desiredPESizeCM = thisPESize;
-				}
-			}
-			peDup = PEDesign(false, (*desiredPESizeCM), (*desiredTileSizeCM), (*desiredNumTileCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-			/*** SubArray Duplication ***/
-			subArrayDup = SubArrayDup((*desiredPESizeCM), 0, markNM, netStructure, numRowPerSynapse, numColPerSynapse);
-			/*** Design SubArray ***/
-			numTileEachLayer = OverallEachLayer(false, false, peDup, subArrayDup, (*desiredTileSizeCM), 0, markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
-			utilizationEachLayer = OverallEachLayer(true, false, peDup, subArrayDup, (*desiredTileSizeCM), 0, markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
-			speedUpEachLayer = OverallEachLayer(false, true, peDup, subArrayDup, (*desiredTileSizeCM), 0, markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
-		}
-	}
-	
-	*numTileRow = ceil((double)sqrt((double)(*desiredNumTileCM)+(double)(*desiredNumTileNM)));
-	*numTileCol = ceil((double)((*desiredNumTileCM)+(*desiredNumTileNM))/(double)(*numTileRow));
-	
-	vector<vector<double> > tileLocaEachLayer;
-	vector<double> tileLocaEachLayerRow;
-	vector<double> tileLocaEachLayerCol;
-	double thisTileTotal;
-	for (int i=0; i<netStructure.size(); i++) {
-		if (i==0) {
-			tileLocaEachLayerRow.push_back(0);
-			tileLocaEachLayerCol.push_back(0);
-		} else {
-			thisTileTotal += numTileEachLayer[0][i]*numTileEachLayer[1][i];
-			tileLocaEachLayerRow.push_back((int)thisTileTotal/(*numTileRow));
-			tileLocaEachLayerCol.push_back((int)thisTileTotal%(*numTileRow)-1);
-		}
-	}
-	tileLocaEachLayer.push_back(tileLocaEachLayerRow);
-	tileLocaEachLayer.push_back(tileLocaEachLayerCol);
-	
-	if (findNumTile) {
-		return numTileEachLayer;
-	} else if (findUtilization) {
-		return utilizationEachLayer;
-	} else if (findSpeedUp) {
-		return speedUpEachLayer;
-	} else {
-		return tileLocaEachLayer;
-	}
-	peDup.clear();
-	subArrayDup.clear();
-	numTileEachLayer.clear();
-	utilizationEachLayer.clear();
-	speedUpEachLayer.clear();
-}
-
-
-void ChipInitialize(InputParameter& inputParameter, Technology& tech, MemCell& cell, const vector<vector<double> > &netStructure, const vector<int > &markNM, const vector<vector<double> > &numTileEachLayer,
-					double numPENM, double desiredNumTileNM, double desiredPESizeNM, double desiredNumTileCM, double desiredTileSizeCM, double desiredPESizeCM, int numTileRow, int numTileCol) { 
-
-	/*** Initialize Tile ***/
-
-	if (param->novelMapping) {
-		TileInitialize(inputParameter, tech, cell, numPENM, desiredPESizeNM);
-	}
-	TileInitialize(inputParameter, tech, cell, ceil((double)(desiredTileSizeCM)/(double)(desiredPESizeCM)), desiredPESizeCM);
-	
-	// find max layer and define the global buffer: enough to hold the max layer inputs
-	double maxLayerInput = 0;
-	// define main global bus width
-	double globalBusWidth = 0;
-	// find max # tiles needed to be added at the same time
-	double maxTileAdded = 0;
-	for (int i=0; i<netStructure.size(); i++) {
-		double input = netStructure[i][0]*netStructure[i][1]*netStructure[i][2];  // IFM_Row * IFM_Column * IFM_depth
-		if (input > maxLayerInput) {
-			maxLayerInput = input;
-		}
-		
-		if (markNM[i] == 0) {
-			globalBusWidth += (desiredTileSizeCM)+(desiredTileSizeCM)/param->numColMuxed;
-		} else {
-			globalBusWidth += (desiredPESizeNM)*ceil((double)sqrt(numPENM))+(desiredPESizeNM)*ceil((double)sqrt(numPENM))/param->numColMuxed;
-		}
-		
-		if (numTileEachLayer[0][i] > maxTileAdded) {
-			maxTileAdded = numTileEachLayer[0][i];
-		}
-	}
-	// have to limit the global bus width --> cannot grow dramatically with num of tile
-	while (globalBusWidth > param->maxGlobalBusWidth) {
-		globalBusWidth /= 2;
-	}
-	
-	globalBuffer->Initialize(param->numBitInput*maxLayerInput, globalBusWidth, 1, param->unitLengthWireResistance, param->clkFreq, param->globalBufferType);
-	maxPool->Initialize(param->numBitInput, 2*2, (desiredTileSizeCM));
-	GhTree->Initialize((numTileRow), (numTileCol), param->globalBusDelayTolerance, globalBusWidth);
-	
-	//activation inside Tile or outside?
-	if (param->chipActivation) {
-		if (param->novelMapping) {
-			int maxThroughputTile = (int) max((desiredTileSizeCM), ceil((double)sqrt(numPENM))*(desiredPESizeNM));
-			int maxAddFromSubArray = (int) max(ceil((double)(desiredPESizeCM)/(double)param->numRowSubArray), ceil((double)(desiredPESizeNM)/(double)param->numRowSubArray));   // from subArray to ProcessingUnit
-			maxAddFromSubArray *= (int) max(ceil((double)(desiredTileSizeCM)/(double)(desiredPESizeCM)), ceil((double)sqrt(numPENM)));    // from ProcessingUnit to Tile
-			if (param->parallelRead) {
-				Gaccumulation->Initialize((int) maxTileAdded, ceil((double) log2((double) param->levelOutput))+param->numBitInput+1+ceil((double) log2((double) maxAddFromSubArray)), 
-										ceil((double) maxThroughputTile/(double) param->numColMuxed));
-			} else {
-				Gaccumulation->Initialize((int) maxTileAdded, ceil((double) log2((double) param->numRowSubArray)+(double) param->cellBit-1)+param->numBitInput+1+ceil((double) log2((double) maxAddFromSubArray)), 
-										ceil((double) maxThroughputTile/(double) param->numColMuxed));
-			}
-			if (param->reLu) {
-				GreLu->Initialize(ceil((double) maxThroughputTile/(double) param->numColMuxed), param->numBitInput, param->clkFreq);
-			} else {
-				Gsigmoid->Initialize(false, param->numBitInput, ceil((double) log2((double) param->numRowSubArray)+(double) param->cellBit-1)+param->numBitInput+1+log2((double) maxAddFromSubArray)+ceil((double) log2((double) maxTileAdded)), 
-										ceil((double) maxThroughputTile/(double) param->numColMuxed), param->clkFreq);
-			}
-		} else {
-			int maxAddFromSubArray = (int) ceil((double)(desiredPESizeCM)/(double)param->numRowSubArray);   // from subArray to ProcessingUnit
-			maxAddFromSubArray *= (int) ceil((double)(desiredTileSizeCM)/(double)(desiredPESizeCM));    // from ProcessingUnit to Tile
-			if (param->parallelRead) {
-				Gaccumulation->Initialize((int) maxTileAdded, ceil((double)log2((double)param->levelOutput))+param->numBitInput+1+ceil((double)log2((double)maxAddFromSubArray)), 
-										ceil((double)(desiredTileSizeCM)/(double)param->numColMuxed));
-			} else {
-				Gaccumulation->Initialize((int) maxTileAdded, ceil((double)log2((double)param->numRowSubArray)+(double)param->cellBit-1)+param->numBitInput+1+ceil((double)log2((double)maxAddFromSubArray)), 
-										ceil((double)(desiredTileSizeCM)/(double)param->numColMuxed));
-			}
-			if (param->reLu) {
-				GreLu->Initialize(ceil((double)(desiredTileSizeCM)/(double)param->numColMuxed), param->numBitInput, param->clkFreq);
-			} else {
-				Gsigmoid->Initialize(false, param->numBitInput, ceil((double) log2((double) param->numRowSubArray)+(double) param->cellBit-1)+param->numBitInput+1+log2((double) maxAddFromSubArray)+ceil((double) log2((double) maxTileAdded)), 
-										ceil((double) (desiredTileSizeCM)/(double) param->numColMuxed), param->clkFreq);
-			}
-		}
-	} else {   // activation inside tiles
-		if (param->novelMapping) {
-			int maxThroughputTile = (int) max((desiredTileSizeCM), ceil((double) sqrt((double) numPENM))*(double) (desiredPESizeNM));
-			if (param->parallelRead) {
-				Gaccumulation->Initialize((int) maxTileAdded, param->numBitInput, ceil((double) maxThroughputTile/(double) param->numColMuxed));
-			} else {
-				Gaccumulation->Initialize((int) maxTileAdded, param->numBitInput, ceil((double) maxThroughputTile/(double) param->numColMuxed));
-			}
-		} else {
-			if (param->parallelRead) {
-				Gaccumulation->Initialize((int) maxTileAdded, param->numBitInput, ceil((double) (desiredTileSizeCM)/(double) param->numColMuxed));
-			} else {
-				Gaccumulation->Initialize((int) maxTileAdded, param->numBitInput, ceil((double) (desiredTileSizeCM)/(double) param->numColMuxed));
-			}
-		}
-	}
-}
-
-
-
-vector<double> ChipCalculateArea(InputParameter& inputParameter, Technology& tech, MemCell& cell, double desiredNumTileNM, double numPENM, double desiredPESizeNM, double desiredNumTileCM, double desiredTileSizeCM, 
-						double desiredPESizeCM, int numTileRow, double *height, double *width, double *CMTileheight, double *CMTilewidth, double *NMTileheight, double *NMTilewidth) {
-	
-	vector<double> areaResults;
-	
-	double area = 0;
-	double areaIC = 0;
-	double areaADC = 0;
-	double areaAccum = 0;
-	double areaOther = 0;
-	
-	double NMheight = 0;
-	double NMwidth = 0;
-	double CMheight = 0;
-	double CMwidth = 0;
-	
-	*NMTileheight = 0;
-	*NMTilewidth = 0;
-	*CMTileheight = 0;
-	*CMTilewidth = 0;
-	*height = 0;
-	*width = 0;
-	
-	vector<double> areaCMTile;
-	vector<double> areaNMTile;
-	
-	if (param->novelMapping) {
-		areaNMTile = TileCalculateArea(numPENM, desiredPESizeNM, &NMheight, &NMwidth);
-		double NMTileArea = areaNMTile[0];
-		double NMTileAreaIC = areaNMTile[1];
-		double NMTileAreaADC = areaNMTile[2];
-		double NMTileAreaAccum = areaNMTile[3];
-		double NMTileAreaOther = areaNMTile[4];
-		area += NMTileArea*desiredNumTileNM;
-		areaIC += NMTileAreaIC*desiredNumTileNM;
-		areaADC += NMTileAreaADC*desiredNumTileNM;
-		areaAccum += NMTileAreaAccum*desiredNumTileNM;
-		areaOther += NMTileAreaOther*desiredNumTileNM;
-		*NMTileheight = NMheight;
-		*NMTilewidth = NMwidth;
-	}
-	
-	areaCMTile = TileCalculateArea(pow(ceil((double) desiredTileSizeCM/(double) desiredPESizeCM), 2), desiredPESizeCM, &CMheight, &CMwidth);
-	
-	double CMTileArea = areaCMTile[0];
-	double CMTileAreaIC = areaCMTile[1];
-	double CMTileAreaADC = areaCMTile[2];
-	double CMTileAreaAccum = areaCMTile[3];
-	double CMTileAreaOther = areaCMTile[4];
-	
-	area += CMTileArea*desiredNumTileCM;
-	areaIC += CMTileAreaIC*desiredNumTileCM;
-	areaADC += CMTileAreaADC*desiredNumTileCM;
-	areaAccum += CMTileAreaAccum*desiredNumTileCM;
-	areaOther += CMTileAreaOther*desiredNumTileCM;
-	*CMTileheight = CMheight;
-	*CMTilewidth = CMwidth;
-	
-	globalBuffer->CalculateArea(numTileRow*max(NMheight, CMheight), NULL, NONE);
-	GhTree->CalculateArea(max(NMheight, CMheight), max(NMwidth, CMwidth), param->treeFoldedRatio);
-	maxPool->CalculateUnitArea(NONE);
-	maxPool->CalculateArea(globalBuffer->width);
-	Gaccumulation->CalculateArea(NULL, globalBuffer->height/3, NONE);
-	
-	double areaGreLu = 0;
-	double areaGsigmoid = 0;
-	
-	if (param->chipActivation) {
-		if (param->reLu) {
-			GreLu->CalculateArea(NULL, globalBuffer->width/3, NONE);
-			area += GreLu->area;
-			areaGreLu += GreLu->area;
-		} else {
-			Gsigmoid->CalculateUnitArea(NONE);
-			Gsigmoid->CalculateArea(NULL, globalBuffer->width/3, NONE);
-			area += Gsigmoid->area;
-			areaGsigmoid += Gsigmoid->area;
-		}
-	}
-	
-	area += globalBuffer->area + GhTree->area + maxPool->area + Gaccumulation->area;
-	areaIC += GhTree->area;
-	areaResults.push_back(area);
-	areaResults.push_back(areaIC);
-	areaResults.push_back(areaADC);
-	areaResults.push_back(areaAccum + Gaccumulation->area);
-	areaResults.push_back(areaOther + globalBuffer->area + GhTree->area + maxPool->area + areaGreLu + areaGsigmoid);
-	
-	*height = sqrt(area);
-	*width = area/(*height);
-	
-	return areaResults;
-}
-
-
-double ChipCalculatePerformance(MemCell& cell, int layerNumber, const string &newweightfile, const string &oldweightfile, const string &inputfile, bool followedByMaxPool, 
-							const vector<vector<double> > &netStructure, const vector<int> &markNM, const vector<vector<double> > &numTileEachLayer, const vector<vector<double> > &utilizationEachLayer, 
-							const vector<vector<double> > &speedUpEachLayer, const vector<vector<double> > &tileLocaEachLayer, double numPENM, double desiredPESizeNM, double desiredTileSizeCM, 
-							double desiredPESizeCM, double CMTileheight, double CMTilewidth, double NMTileheight, double NMTilewidth,
-							double *readLatency, double *readDynamicEnergy, double *leakage, double *bufferLatency, double *bufferDynamicEnergy, double *icLatency, double *icDynamicEnergy, 
-							double *coreLatencyADC, double *coreLatencyAccum, double *coreLatencyOther, double *coreEnergyADC, double *coreEnergyAccum, double *coreEnergyOther) {
-	
-	
-	int numRowPerSynapse, numColPerSynapse;
-	numRowPerSynapse = param->numRowPerSynapse;
-	numColPerSynapse = param->numColPerSynapse;
-	
-	// only get performance of single layer
-	int l = layerNumber;
-	// get weight matrix file Size
-	int weightMatrixRow = netStructure[l][2]*netStructure[l][3]*netStructure[l][4]*numRowPerSynapse;
-	int weightMatrixCol = netStructure[l][5]*numColPerSynapse;
-	
-	// load in whole file 
-	vector<vector<double> > inputVector;
-	inputVector = LoadInInputData(inputfile); 
-	vector<vector<double> > newMemory;
-	newMemory = LoadInWeightData(newweightfile, numRowPerSynapse, numColPerSynapse, param->maxConductance, param->minConductance);
-	
-	*readLatency = 0;
-	*readDynamicEnergy = 0;
-	*leakage = 0;
-	*bufferLatency = 0;
-	*bufferDynamicEnergy = 0;
-	*icLatency = 0;
-	*icDynamicEnergy = 0;
-	
-	*coreEnergyADC = 0;
-	*coreEnergyAccum = 0;
-	*coreEnergyOther = 0;
-	*coreLatencyADC = 0;
-	*coreLatencyAccum = 0;
-	*coreLatencyOther = 0;
-	
-	double tileLeakage = 0;
-	int numInVector = (netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1);
-	
-	if (markNM[l] == 0) {   // conventional mapping
-		for (int i=0; i<numTileEachLayer[0][l]; i++) {       // # of tiles in row
-			for (int j=0; j<numTileEachLayer[1][l]; j++) {   // # of tiles in Column
-				
-				double tileReadLatency = 0;
-				double tileReadDynamicEnergy = 0;
-				double tilebufferLatency = 0;
-				double tilebufferDynamicEnergy = 0;
-				double tileicLatency = 0;
-				double tileicDynamicEnergy = 0;
-				double tileLatencyADC = 0;
-				double tileLatencyAccum = 0;
-				double tileLatencyOther = 0;
-				double tileEnergyADC = 0;
-				double tileEnergyAccum = 0;
-				double tileEnergyOther = 0;
-
-				int numRowMatrix = min(desiredTileSizeCM, weightMatrixRow-i*desiredTileSizeCM);
-				int numColMatrix = min(desiredTileSizeCM, weightMatrixCol-j*desiredTileSizeCM);
-				
-				// assign weight and input to specific tile
-				vector<vector<double> > tileMemory;
-				tileMemory = CopyArray(newMemory, i*desiredTileSizeCM, j*desiredTileSizeCM, numRowMatrix, numColMatrix);
-				
-				vector<vector<double> > tileInput;
-				tileInput = CopyInput(inputVector, i*desiredTileSizeCM, (netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*param->numBitInput, numRowMatrix);
-				
-				TileCalculatePerformance(tileMemory, tileMemory, tileInput, markNM[l], ceil((double)desiredTileSizeCM/(double)desiredPESizeCM), desiredPESizeCM, speedUpEachLayer[0][l], speedUpEachLayer[1][l],
-									numRowMatrix, numColMatrix, (netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*param->numBitInput, cell, &tileReadLatency, &tileReadDynamicEnergy, &tileLeakage,
-									&tilebufferLatency, &tilebufferDynamicEnergy, &tileicLatency, &tileicDynamicEnergy, 
-									&tileLatencyADC, &tileLatencyAccum, &tileLatencyOther, &tileEnergyADC, &tileEnergyAccum, &tileEnergyOther);
-
-				*readLatency = max(tileReadLatency, (*readLatency));
-				*readDynamicEnergy += tileReadDynamicEnergy;
-				*bufferLatency = max(tilebufferLatency, (*bufferLatency));
-				*bufferDynamicEnergy += tilebufferDynamicEnergy;
-				*icLatency = max(tileicLatency, (*icLatency));
-				*icDynamicEnergy += tileicDynamicEnergy;
-				
-				*coreLatencyADC = MAX(tileLatencyADC, (*coreLatencyADC));
-				*coreLatencyAccum = MAX(tileLatencyAccum, (*coreLatencyAccum));
-				*coreLatencyOther = MAX(tileLatencyOther, (*coreLatencyOther));
-				
-				*coreEnergyADC += tileEnergyADC;
-				*coreEnergyAccum += tileEnergyAccum;
-				*coreEnergyOther += tileEnergyOther;
-
-			}
-		}
-		
-		
-		if (param->chipActivation) {
-			if (param->reLu) {
-				GreLu->CalculateLatency(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*netStructure[l][5]/(double) GreLu->numUnit));
-				GreLu->CalculatePower(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*netStructure[l][5]/(double) GreLu->numUnit));
-				*readLatency += GreLu->readLatency;
-				*readDynamicEnergy += GreLu->readDynamicEnergy;
-				*coreLatencyOther += GreLu->readLatency;
-				*coreEnergyOther += GreLu->readDynamicEnergy;
-			} else {
-				Gsigmoid->CalculateLatency(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*netStructure[l][5]/Gsigmoid->numEntry));
-				Gsigmoid->CalculatePower(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*netStructure[l][5]/Gsigmoid->numEntry));
-				*readLatency += Gsigmoid->readLatency;
-				*readDynamicEnergy += Gsigmoid->readDynamicEnergy;
-				*coreLatencyOther += Gsigmoid->readLatency;
-				*coreEnergyOther += Gsigmoid->readDynamicEnergy;
-			}
-		}
-		
-		if (numTileEachLayer[0][l] > 1) {   
-			Gaccumulation->CalculateLatency(numTileEachLayer[1][l]*netStructure[l][5]*(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/(double) Gaccumulation->numAdderTree)), numTileEachLayer[0][l], 0);
-			Gaccumulation->CalculatePower(numTileEachLayer[1][l]*netStructure[l][5]*(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/(double) Gaccumulation->numAdderTree)), numTileEachLayer[0][l]);
-			*readLatency += Gaccumulation->readLatency;
-			*readDynamicEnergy += Gaccumulation->readDynamicEnergy;
-			*coreLatencyAccum += Gaccumulation->readLatency;
-			*coreEnergyAccum += Gaccumulation->readDynamicEnergy;
-		}
-		
-		// if this layer is followed by Max Pool
-		if (followedByMaxPool) {
-			maxPool->CalculateLatency(1e20, 0, ceil((double) ((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/(double) maxPool->window)/(double) desiredTileSizeCM));
-			maxPool->CalculatePower(ceil((double) ((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/maxPool->window)/(double) desiredTileSizeCM));
-			*readLatency += maxPool->readLatency;
-			*readDynamicEnergy += maxPool->readDynamicEnergy;
-			*coreLatencyOther += maxPool->readLatency;
-			*coreEnergyOther += maxPool->readDynamicEnergy;
-		}
-		
-		
-		GhTree->CalculateLatency(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], CMTileheight, CMTilewidth, 
-								(weightMatrixRow+weightMatrixCol)*(netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/GhTree->busWidth);
-		GhTree->CalculatePower(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], CMTileheight, CMTilewidth, GhTree->busWidth, 
-								(weightMatrixRow+weightMatrixCol)/(desiredPESizeCM)*(netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/GhTree->busWidth);
-
-		double numBitToLoadOut = weightMatrixRow*param->numBitInput*(netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1);
-		double numBitToLoadIn = ceil(weightMatrixCol/param->numColPerSynapse)*param->numBitInput*(netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1);
-		globalBuffer->CalculateLatency(globalBuffer->interface_width, numBitToLoadOut/globalBuffer->interface_width,
-								globalBuffer->interface_width, numBitToLoadIn/globalBuffer->interface_width);
-		globalBuffer->CalculatePower(globalBuffer->interface_width, numBitToLoadOut/globalBuffer->interface_width,
-								globalBuffer->interface_width, numBitToLoadIn/globalBuffer->interface_width);
-		
-		*bufferLatency += globalBuffer->readLatency + globalBuffer->writeLatency;
-		*bufferDynamicEnergy += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy;
-		*icLatency += GhTree->readLatency;
-		*icDynamicEnergy += GhTree->readDynamicEnergy;
-		
-		*readLatency += globalBuffer->readLatency + globalBuffer->writeLatency + GhTree->readLatency;
-		*readDynamicEnergy += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy + GhTree->readDynamicEnergy;
-		*coreLatencyOther += globalBuffer->readLatency + globalBuffer->writeLatency + GhTree->readLatency;
-		*coreEnergyOther += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy + GhTree->readDynamicEnergy;
-		
-	} else {   // novel Mapping
-		for (int i=0; i<numTileEachLayer[0][l]; i++) {       // # of tiles in row
-			for (int j=0; j<numTileEachLayer[1][l]; j++) {   // # of tiles in Column
-				
-				double tileReadLatency = 0;
-				double tileReadDynamicEnergy = 0;
-				double tilebufferLatency = 0;
-				double tilebufferDynamicEnergy = 0;
-				double tileicLatency = 0;
-				double tileicDynamicEnergy = 0;
-				double tileLatencyADC = 0;
-				double tileLatencyAccum = 0;
-				double tileLatencyOther = 0;
-				double tileEnergyADC = 0;
-				double tileEnergyAccum = 0;
-				double tileEnergyOther = 0;
-				
-				// novel mapping
-				int numtileEachLayerRow = ceil((double) netStructure[l][2]*(double) numRowPerSynapse/(double) desiredPESizeNM);
-				int numtileEachLayerCol = ceil((double) netStructure[l][5]*(double) numColPerSynapse/(double) desiredPESizeNM);
-				
-				int numRowMatrix = min(desiredPESizeNM*numPENM, weightMatrixRow-i*desiredPESizeNM*numPENM);
-				int numColMatrix = min(desiredPESizeNM, weightMatrixCol-j*desiredPESizeNM);
-				
-				// assign weight and input to specific tile
-				vector<vector<double> > tileMemory;
-				tileMemory = ReshapeArray(newMemory, i*desiredPESizeNM, j*desiredPESizeNM, (int) netStructure[l][2]*numRowPerSynapse/numtileEachLayerRow, 
-									(int) netStructure[l][5]*numColPerSynapse/numtileEachLayerCol, numPENM, (int) netStructure[l][2]*numRowPerSynapse);
-
-				vector<vector<double> > tileInput;
-				tileInput = ReshapeInput(inputVector, i*desiredPESizeNM, (int) (netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*param->numBitInput, 
-									(int) netStructure[l][2]*numRowPerSynapse/numtileEachLayerRow, numPENM, (int) netStructure[l][2]*numRowPerSynapse);
-	
-				TileCalculatePerformance(tileMemory, tileMemory, tileInput, markNM[l], numPENM, desiredPESizeNM, speedUpEachLayer[0][l], speedUpEachLayer[1][l],
-									numRowMatrix, numColMatrix, numInVector*param->numBitInput, cell, 
-									&tileReadLatency, &tileReadDynamicEnergy, &tileLeakage, &tilebufferLatency, &tilebufferDynamicEnergy, &tileicLatency, &tileicDynamicEnergy,
-									&tileLatencyADC, &tileLatencyAccum, &tileLatencyOther, &tileEnergyADC, &tileEnergyAccum, &tileEnergyOther);
-				
-				*readLatency = max(tileReadLatency, (*readLatency));
-				*readDynamicEnergy += tileReadDynamicEnergy;
-				*bufferLatency = max(tilebufferLatency, (*bufferLatency));
-				*bufferDynamicEnergy += tilebufferDynamicEnergy;
-				*icLatency = max(tileicLatency, (*icLatency));
-				*icDynamicEnergy += tileicDynamicEnergy;
-				
-				*coreLatencyADC = MAX(tileLatencyADC, (*coreLatencyADC));
-				*coreLatencyAccum = MAX(tileLatencyAccum, (*coreLatencyAccum));
-				*coreLatencyOther = MAX(tileLatencyOther, (*coreLatencyOther));
-				
-				*coreEnergyADC += tileEnergyADC;
-				*coreEnergyAccum += tileEnergyAccum;
-				*coreEnergyOther += tileEnergyOther;
-
-			}
-		}
-		
-		if (param->chipActivation) {
-			if (param->reLu) {
-				GreLu->CalculateLatency(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*netStructure[l][5]/(double) GreLu->numUnit));
-				GreLu->CalculatePower(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*netStructure[l][5]/(double) GreLu->numUnit));
-				*readLatency += GreLu->readLatency;
-				*readDynamicEnergy += GreLu->readDynamicEnergy;
-				*coreLatencyOther += GreLu->readLatency;
-				*coreEnergyOther += GreLu->readDynamicEnergy;
-			} else {
-				Gsigmoid->CalculateLatency(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*netStructure[l][5]/Gsigmoid->numEntry));
-				Gsigmoid->CalculatePower(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)*netStructure[l][5]/Gsigmoid->numEntry));
-				*readLatency += Gsigmoid->readLatency;
-				*readDynamicEnergy += Gsigmoid->readDynamicEnergy;
-				*coreLatencyOther += Gsigmoid->readLatency;
-				*coreEnergyOther += Gsigmoid->readDynamicEnergy;
-			}
-		}
-		
-		if (numTileEachLayer[0][l] > 1) {   
-			Gaccumulation->CalculateLatency(numTileEachLayer[1][l]*netStructure[l][5]*(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/(double) Gaccumulation->numAdderTree)), numTileEachLayer[0][l], 0);
-			Gaccumulation->CalculatePower(numTileEachLayer[1][l]*netStructure[l][5]*(ceil((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/(double) Gaccumulation->numAdderTree)), numTileEachLayer[0][l]);
-			*readLatency += Gaccumulation->readLatency;
-			*readDynamicEnergy += Gaccumulation->readDynamicEnergy;
-			*coreLatencyAccum += Gaccumulation->readLatency;
-			*coreEnergyAccum += Gaccumulation->readDynamicEnergy;
-		}
-		
-		// if this layer is followed by Max Pool
-		if (followedByMaxPool) {
-			maxPool->CalculateLatency(1e20, 0, ceil((double) ((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/(double) maxPool->window)/(double) desiredPESizeNM*sqrt((double) numPENM)));
-			maxPool->CalculatePower(ceil((double) ((netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/maxPool->window)/(double) desiredPESizeNM*sqrt((double) numPENM)));
-			*readLatency += maxPool->readLatency;
-			*readDynamicEnergy += maxPool->readDynamicEnergy;
-			*coreLatencyOther += maxPool->readLatency;
-			*coreEnergyOther += maxPool->readDynamicEnergy;
-		}
-		
-		GhTree->CalculateLatency(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], NMTileheight, NMTilewidth, 
-								(weightMatrixRow+weightMatrixCol)*(netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/GhTree->busWidth/netStructure[l][3]);
-		GhTree->CalculatePower(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], NMTileheight, NMTilewidth, GhTree->busWidth, 
-								(weightMatrixRow+weightMatrixCol)/(desiredPESizeNM)*(netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/GhTree->busWidth/netStructure[l][3]);
-
-		double numBitToLoadOut = weightMatrixRow*param->numBitInput*(netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/netStructure[l][3];
-		double numBitToLoadIn = weightMatrixCol*param->numBitInput*(netStructure[l][0]-netStructure[l][3]+1)*(netStructure[l][1]-netStructure[l][4]+1)/netStructure[l][3];
-		globalBuffer->CalculateLatency(globalBuffer->interface_width, numBitToLoadOut/globalBuffer->interface_width,
-								globalBuffer->interface_width, numBitToLoadIn/globalBuffer->interface_width);
-		globalBuffer->CalculatePower(globalBuffer->interface_width, numBitToLoadOut/globalBuffer->interface_width,
-								globalBuffer->interface_width, numBitToLoadIn/globalBuffer->interface_width);
-								
-		*bufferLatency += globalBuffer->readLatency + globalBuffer->writeLatency;
-		*bufferDynamicEnergy += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy;
-		*icLatency += GhTree->readLatency;
-		*icDynamicEnergy += GhTree->readDynamicEnergy;
-		
-		*readLatency += (*bufferLatency) + (*icLatency);
-		*readDynamicEnergy += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy + GhTree->readDynamicEnergy;
-		
-		*coreLatencyOther += (*bufferLatency) + (*icLatency);
-		*coreEnergyOther += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy + GhTree->readDynamicEnergy;
-	}
-	*leakage = tileLeakage;
-}
-
-
-
-vector<double> TileDesignCM(double tileSize, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse) {
-	double numTileTotal = 0;
-	double matrixTotalCM = 0;
-	double utilization = 0;
-	for (int i=0; i<netStructure.size(); i++) {
-		if (markNM[i] == 0) {
-			numTileTotal += ceil((double) netStructure[i][2]*(double) netStructure[i][3]*(double) netStructure[i][4]*(double) numRowPerSynapse/(double) tileSize) * ceil(netStructure[i][5]*numColPerSynapse/tileSize);
-			matrixTotalCM += netStructure[i][2]*netStructure[i][3]*netStructure[i][4]*numRowPerSynapse*netStructure[i][5]*numColPerSynapse;
-		}
-	}
-	utilization = matrixTotalCM/(numTileTotal*tileSize*tileSize);
-	
-	vector<double> tileDesignCM;
-	tileDesignCM.push_back(numTileTotal);
-	// tileDesignCM[0] = numTileTotal; tileDesignCM[1] = matrixTotalCM; tileDesignCM = utilization
-	tileDesignCM.push_back(matrixTotalCM);
-	tileDesignCM.push_back(utilization);
-	return tileDesignCM;
-	tileDesignCM.clear();
-}
-
-vector<double> TileDesignNM(double peSize, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse, double numPENM){
-	double numTileTotal = 0;
-	double matrixTotalNM = 0;
-	double utilization = 0;
-	for (int i=0; i<netStructure.size(); i++) {
-		if (markNM[i] == 1) {
-			numTileTotal += ceil((double) netStructure[i][2]*(double) numRowPerSynapse/(double) peSize) * ceil((double) netStructure[i][5]*(double) numColPerSynapse/(double) peSize);
-			matrixTotalNM += netStructure[i][2]*netStructure[i][3]*netStructure[i][4]*numRowPerSynapse*netStructure[i][5]*numColPerSynapse;
-		}
-	}
-	utilization = matrixTotalNM/(numTileTotal*peSize*peSize*numPENM);
-	vector<double> tileDesignNM;
-	tileDesignNM.push_back(numTileTotal);
-	tileDesignNM.push_back(matrixTotalNM);
-	tileDesignNM.push_back(utilization);
-	return tileDesignNM;
-	tileDesignNM.clear();
-}
-
-vector<vector<double> > PEDesign(bool Design, double peSize, double desiredTileSize, double numTileTotal, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse) {
-	double matrixTotalCM = 0;
-	double utilization = 0;
-	vector<double> peDupRow;
-	vector<double> peDupCol;
-	for (int i=0; i<netStructure.size(); i++) {
-		int actualDupRow = 0;
-		int actualDupCol = 0;
-		if (markNM[i] ==0) {
-			if ( (netStructure[i][2]*netStructure[i][3]*netStructure[i][4]*numRowPerSynapse <= desiredTileSize)||(netStructure[i][5]*numColPerSynapse <= desiredTileSize) ) {
-				int peForOneMatrixRow = ceil((double) netStructure[i][2]*(double) netStructure[i][3]*(double) netStructure[i][4]*(double) numRowPerSynapse/(double) peSize);
-				int peForOneMatrixCol = ceil((double) netStructure[i][5]*(double) numColPerSynapse/(double) peSize);
-				int numPERow = ceil((double) desiredTileSize/(double) peSize);
-				int numPECol = ceil((double) desiredTileSize/(double) peSize);
-				actualDupRow = floor(numPERow/peForOneMatrixRow)==0? 1:floor(numPERow/peForOneMatrixRow);
-				actualDupCol = floor(numPECol/peForOneMatrixCol)==0? 1:floor(numPECol/peForOneMatrixCol);
-				matrixTotalCM += actualDupRow*actualDupCol*netStructure[i][2]*netStructure[i][3]*netStructure[i][4]*numRowPerSynapse*netStructure[i][5]*numColPerSynapse;
-			} else {
-				actualDupRow = 1;
-				actualDupCol = 1;
-				matrixTotalCM += actualDupRow*actualDupCol*netStructure[i][2]*netStructure[i][3]*netStructure[i][4]*numRowPerSynapse*netStructure[i][5]*numColPerSynapse;
-			}
-		} else {
-			actualDupRow = 1;
-			actualDupCol = 1;
-		}
-		peDupRow.push_back(actualDupRow);
-		peDupCol.push_back(actualDupCol);
-	}
-	utilization = matrixTotalCM/(numTileTotal*desiredTileSize*desiredTileSize);
-	
-	vector<double> matrixTotal;
-	matrixTotal.push_back(matrixTotalCM);
-	vector<double> utiliz;
-	utiliz.push_back(utilization);
-	vector<vector<double> > peDesignCM;
-	peDesignCM.push_back(matrixTotal);
-	peDesignCM.push_back(utiliz);
-	matrixTotal.clear();
-	utiliz.clear();
-	
-	vector<vector<double> > peDup;
-	peDup.push_back(peDupRow);
-	peDup.push_back(peDupCol);
-	peDupRow.clear();
-	peDupCol.clear();
-	if (Design) {
-		return peDesignCM;
-	} else {
-		return peDup;
-	}
-	peDesignCM.clear();
-	peDup.clear();
-}
-
-vector<vector<double> > SubArrayDup(double desiredPESizeCM, double desiredPESizeNM, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse) {
-	vector<double> subArrayDupRow;
-	vector<double> subArrayDupCol;
-	
-	for (int i=0; i<netStructure.size(); i++) {
-		int actualDupRow = 0;
-		int actualDupCol = 0;
-		if (markNM[i] == 0){
-			if ( (netStructure[i][2]*netStructure[i][3]*netStructure[i][4]*numRowPerSynapse <= desiredPESizeCM)||(netStructure[i][5]*numColPerSynapse <= desiredPESizeCM) ) {
-				int arrayForOneMatrixRow = ceil((double) netStructure[i][2]*(double) netStructure[i][3]*(double) netStructure[i][4]*(double) numRowPerSynapse/(double) param->numRowSubArray);
-				int arrayForOneMatrixCol = ceil((double) netStructure[i][5]*(double) numColPerSynapse/(double) param->numColSubArray);
-				int numSubArrayRow = ceil((double) desiredPESizeCM/(double) param->numRowSubArray);
-				int numSubArrayCol = ceil((double) desiredPESizeCM/(double) param->numColSubArray);
-				actualDupRow = floor(numSubArrayRow/arrayForOneMatrixRow)==0? 1:floor(numSubArrayRow/arrayForOneMatrixRow);
-				actualDupCol = floor(numSubArrayCol/arrayForOneMatrixCol)==0? 1:floor(numSubArrayCol/arrayForOneMatrixCol);
-			} else {
-				actualDupRow = 1;
-				actualDupCol = 1;
-			}
-		} else {
-			if ( (netStructure[i][2]*numRowPerSynapse <= desiredPESizeNM)||(netStructure[i][5]*numColPerSynapse <= desiredPESizeNM) ) {
-				int arrayForOneMatrixRow = ceil((double) netStructure[i][2]*(double) numRowPerSynapse/(double) param->numRowSubArray);
-				int arrayForOneMatrixCol = ceil((double) netStructure[i][5]*(double) numColPerSynapse/(double) param->numColSubArray);
-				int numSubArrayRow = ceil((double) desiredPESizeNM/(double) param->numRowSubArray);
-				int numSubArrayCol = ceil((double) desiredPESizeNM/(double) param->numColSubArray);
-				actualDupRow = floor(numSubArrayRow/arrayForOneMatrixRow)==0? 1:floor(numSubArrayRow/arrayForOneMatrixRow);
-				actualDupCol = floor(numSubArrayCol/arrayForOneMatrixCol)==0? 1:floor(numSubArrayCol/arrayForOneMatrixCol);
-			} else {
-				actualDupRow = 1;
-				actualDupCol = 1;
-			}
-		}
-		subArrayDupRow.push_back(actualDupRow);
-		subArrayDupCol.push_back(actualDupCol);
-	}
-	vector<vector<double> > subArrayDup;
-	subArrayDup.push_back(subArrayDupRow);
-	subArrayDup.push_back(subArrayDupCol);
-	subArrayDupRow.clear();
-	subArrayDupCol.clear();
-	return subArrayDup;
-	subArrayDup.clear();
-}
-
-vector<vector<double> > OverallEachLayer(bool utilization, bool speedUp, const vector<vector<double> > &peDup, const vector<vector<double> > &subArrayDup, double desiredTileSizeCM, double desiredPESizeNM, 
-										const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse, double numPENM) {
-	vector<double> numTileEachLayerRow;
-	vector<double> numTileEachLayerCol;
-	vector<vector<double> > utilizationEachLayer;	
-	vector<double> speedUpEachLayerRow;
-	vector<double> speedUpEachLayerCol;
-	
-	for (int i=0; i<netStructure.size(); i++) {
-		vector<double> utilization;
-		
-		double numtileEachLayerRow, numtileEachLayerCol, utilizationEach;
-		if (markNM[i] == 0) {
-			// conventional mapping
-			numtileEachLayerRow = ceil((double) netStructure[i][2]*(double) netStructure[i][3]*(double) netStructure[i][4]*(double) numRowPerSynapse/desiredTileSizeCM);
-			numtileEachLayerCol = ceil((double) netStructure[i][5]*(double) numColPerSynapse/(double) desiredTileSizeCM);
-			utilizationEach = (peDup[0][i]*peDup[1][i]*subArrayDup[0][i]*subArrayDup[1][i]*netStructure[i][2]*netStructure[i][3]*netStructure[i][4]
-										*numRowPerSynapse*netStructure[i][5]*numColPerSynapse)/(numtileEachLayerRow*numtileEachLayerCol*desiredTileSizeCM*desiredTileSizeCM);
-
-			utilization.push_back(utilizationEach);
-		} else {
-			// novel mapping
-			numtileEachLayerRow = ceil((double) netStructure[i][2]*(double) numRowPerSynapse/(double) desiredPESizeNM);
-			numtileEachLayerCol = ceil((double) netStructure[i][5]*(double) numColPerSynapse/(double) desiredPESizeNM);
-			utilizationEach = (peDup[0][i]*peDup[1][i]*subArrayDup[0][i]*subArrayDup[1][i]*netStructure[i][2]*numPENM*numRowPerSynapse*netStructure[i][5]
-										*numColPerSynapse)/(numtileEachLayerRow*numtileEachLayerCol*desiredPESizeNM*desiredPESizeNM*numPENM);
-			
-			utilization.push_back(utilizationEach);
-		}
-		numTileEachLayerRow.push_back(numtileEachLayerRow);
-		numTileEachLayerCol.push_back(numtileEachLayerCol);
-		utilizationEachLayer.push_back(utilization);
-		speedUpEachLayerRow.push_back(peDup[0][i]*subArrayDup[0][i]);
-		speedUpEachLayerCol.push_back(peDup[1][i]*subArrayDup[1][i]);
-		utilization.clear();
-	}
-
-	vector<vector<double> > numTileEachLayer;
-	numTileEachLayer.push_back(numTileEachLayerRow);
-	numTileEachLayer.push_back(numTileEachLayerCol);
-	numTileEachLayerRow.clear();
-	numTileEachLayerCol.clear();
-	
-	vector<vector<double> > speedUpEachLayer;
-	speedUpEachLayer.push_back(speedUpEachLayerRow);
-	speedUpEachLayer.push_back(speedUpEachLayerCol);
-	speedUpEachLayerRow.clear();
-	speedUpEachLayerCol.clear();
-
-	if (utilization) {
-		return utilizationEachLayer;
-	} else if (speedUp) {
-		return speedUpEachLayer;
-	} else {
-		return numTileEachLayer;
-	}
-	utilizationEachLayer.clear();
-	speedUpEachLayer.clear();
-	numTileEachLayer.clear();
-}
-
-
-
-vector<vector<double> > LoadInWeightData(const string &weightfile, int numRowPerSynapse, int numColPerSynapse, double maxConductance, double minConductance) {
-	
-	ifstream fileone(weightfile.c_str());                           
-	string lineone;
-	string valone;
-	
-	int ROW = 0;
-	int COL = 0;
-	
-	if (!fileone.good()) {                                       
-		cerr << "Error: the fileone cannot be opened!" << endl;
-		exit(1);
-	}else{
-		while (getline(fileone, lineone, '\n')) {                   
-			ROW++;                                             
-		}
-		fileone.clear();
-		fileone.seekg(0, ios::beg);                               
-		if (getline(fileone, lineone, '\n')) {                      
-			istringstream iss (lineone);                         
-			while (getline(iss, valone, ',')) {                   
-				COL++;
-			}
-		}	
-	}
-	fileone.clear();
-	fileone.seekg(0, ios::beg);                   
-	
-	
-	double NormalizedMin = 0;
-	double NormalizedMax = pow(2, param->synapseBit);
-	
-	double RealMax = param->algoWeightMax;
-	double RealMin = param->algoWeightMin;
-	
-	vector<vector<double> > weight;            
-	// load the data into a weight matrix ...
-	for (int row=0; row<ROW; row++) {	
-		vector<double> weightrow;
-		vector<double> weightrowb;
-		getline(fileone, lineone, '\n');              
-		istringstream iss;
-		iss.str(lineone);
-		for (int col=0; col<COL; col++) {       
-			while(getline(iss, valone, ',')){	
-				istringstream fs;
-				fs.str(valone);
-				double f=0;
-				fs >> f;	
-				//normalize weight to integer
-				double newdata = ((NormalizedMax-NormalizedMin)/(RealMax-RealMin)*(f-RealMax)+NormalizedMax);
-				if (newdata >= 0) {
-					newdata += 0.5;
-				}else {
-					newdata -= 0.5;
-				}
-				// map and expend the weight in memory array
-				int cellrange = pow(2, param->cellBit);
-				vector<double> synapsevector(numColPerSynapse);       
-				int value = newdata; 
-				if (param->BNNparallelMode) {
-					if (value == 1) {
-						weightrow.push_back(maxConductance);
-						weightrow.push_back(minConductance);
-					} else {
-						weightrow.push_back(minConductance);
-						weightrow.push_back(maxConductance);
-					}
-				} else if (param->XNORparallelMode || param->XNORsequentialMode) {
-					if (value == 1) {
-						weightrow.push_back(maxConductance);
-						weightrowb.push_back(minConductance);
-					} else {
-						weightrow.push_back(minConductance);
-						weightrowb.push_back(maxConductance);
-					}
-				} else {
-					int remainder;   
-					for (int z=0; z<numColPerSynapse; z++) {   
-						remainder = ceil((double)(value%cellrange));
-						value = ceil((double)(value/cellrange));
-						synapsevector.insert(synapsevector.begin(), remainder);
-					}
-					for (int u=0; u<numColPerSynapse; u++) {
-						double cellvalue = synapsevector[u];
-						double conductance = cellvalue/(cellrange-1) * (maxConductance-minConductance) + minConductance;
-						weightrow.push_back(conductance);
-					}
-				}
-			}
-		}
-		if (param->XNORparallelMode || param->XNORsequentialMode) {
-			weight.push_back(weightrow);
-			weightrow.clear();
-			weight.push_back(weightrowb);
-			weightrowb.clear();
-		} else {
-			weight.push_back(weightrow);
-			weightrow.clear();
-		}
-	}
-	fileone.close();
-	
-	return weight;
-	weight.clear();
-}
-
-
-
-vector<vector<double> > CopyArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol) {
-	
-	vector<vector<double> > copy;
-	for (int i=0; i<numRow; i++) {
-		vector<double> copyRow;
-		for (int j=0; j<numCol; j++) {
-			copyRow.push_back(orginal[positionRow+i][positionCol+j]);
-		}
-		copy.push_back(copyRow);
-		copyRow.clear();
-	}
-	
-	return copy;
-	copy.clear();
-} 
-
-
-
-vector<vector<double> > ReshapeArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol, int numPE, int weightMatrixRow) {
-	
-	vector<vector<double> > copy;
-
-	for (int k=0; k<numPE; k++) {
-		for (int i=0; i<numRow; i++) {
-			vector<double> copyRow;
-			for (int j=0; j<numCol; j++) {
-				copyRow.push_back(orginal[positionRow+k*weightMatrixRow+i][positionCol+j]);
-			}
-			copy.push_back(copyRow);
-			copyRow.clear();
-		}
-	}
-	
-	return copy;
-	copy.clear();
-} 
-
-
-
-vector<vector<double> > LoadInInputData(const string &inputfile) {
-	
-	ifstream infile(inputfile.c_str());     
-	string inputline;
-	string inputval;
-	
-	int ROWin=0, COLin=0;      
-	if (!infile.good()) {       
-		cerr << "Error: the input file cannot be opened!" << endl;
-		exit(1);
-	}else{
-		while (getline(infile, inputline, '\n')) {      
-			ROWin++;                               
-		}
-		infile.clear();
-		infile.seekg(0, ios::beg);    
-		if (getline(infile, inputline, '\n')) {        
-			istringstream iss (inputline);      
-			while (getline(iss, inputval, ',')) {       
-				COLin++;
-			}
-		}	
-	}
-	infile.clear();
-	infile.seekg(0, ios::beg);          
-	
-	vector<vector<double> > inputvector;              
-	// load the data into inputvector ...
-	for (int row=0; row<ROWin; row++) {	
-		vector<double> inputvectorrow;
-		vector<double> inputvectorrowb;
-		getline(infile, inputline, '\n');             
-		istringstream iss;
-		iss.str(inputline);
-		for (int col=0; col<COLin; col++) {
-			while(getline(iss, inputval, ',')){	
-				istringstream fs;
-				fs.str(inputval);
-				double f=0;
-				fs >> f;
-				
-				if (param->BNNparallelMode) {
-					if (f == 1) {
-						inputvectorrow.push_back(1);
-					} else {
-						inputvectorrow.push_back(0);
-					}
-				} else if (param->XNORparallelMode || param->XNORsequentialMode) {
-					if (f == 1) {
-						inputvectorrow.push_back(1);
-						inputvectorrowb.push_back(0);
-					} else {
-						inputvectorrow.push_back(0);
-						inputvectorrowb.push_back(1);
-					}
-				} else {
-					inputvectorrow.push_back(f);
-				}
-			}
-		}
-		if (param->XNORparallelMode || param->XNORsequentialMode) {
-			inputvector.push_back(inputvectorrow);
-			inputvectorrow.clear();
-			inputvector.push_back(inputvectorrowb);
-			inputvectorrowb.clear();
-		} else {
-			inputvector.push_back(inputvectorrow);
-			inputvectorrow.clear();
-		}
-	}
-	// close the input file ...
-	infile.close();
-	
-	return inputvector;
-	inputvector.clear();
-}
-
-
-
-
-vector<vector<double> > CopyInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow) {
-	
-	vector<vector<double> > copy;
-	for (int i=0; i<numRow; i++) {
-		vector<double> copyRow;
-		for (int j=0; j<numInputVector; j++) {
-			copyRow.push_back(orginal[positionRow+i][j]);
-		}
-		copy.push_back(copyRow);
-		copyRow.clear();
-	}
-	
-	return copy;
-	copy.clear();
-	
-} 
-
-
-
-vector<vector<double> > ReshapeInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow, int numPE, int weightMatrixRow) {
-	
-	vector<vector<double> > copy;
-
-	for (int k=0; k<numPE; k++) {
-		for (int i=0; i<numRow; i++) {
-			vector<double> copyRow;
-			for (int j=0; j<numInputVector; j++) {
-				copyRow.push_back(orginal[positionRow+k*weightMatrixRow+i][j]);
-			}
-			copy.push_back(copyRow);
-			copyRow.clear();
-		}
-	}
-	
-	return copy;
-	copy.clear();
-} 
-
-
-
-
-
-
-
-
-
-
-
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <stdlib.h>
+#include <vector>
+#include <sstream>
+#include "MaxPooling.h"
+#include "Sigmoid.h"
+#include "BitShifter.h"
+#include "AdderTree.h"
+#include "Buffer.h"
+#include "HTree.h"
+#include "ProcessingUnit.h"
+#include "MonteCarlo.h"
+#include "Report.h"
+#include "Tile.h"
+#include "constant.h"
+#include "formula.h"
+#include "Param.h"
+#include "Breakdown.h"
+#include "Profile.h"
+#include "Heatmap.h"
+#include "Activity.h"
+#include "Chip.h"
+
+using namespace std;
+
+extern Param *param;
+
+/*** Circuit Modules ***/
+Buffer *globalBuffer;
+HTree *GhTree;
+AdderTree *Gaccumulation;
+Sigmoid *Gsigmoid;
+BitShifter *GreLu;
+MaxPooling *maxPool;
+
+RooflineStats rooflineStats;
+
+
+void LayerNormalize(vector<double> *layer) {
+	// older network files end after the pooling column (or before it): the missing columns are a dense stride-1 layer without padding
+	const double defaultValue[numLayerDescriptor] = {0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0};
+	vector<double> &l = *layer;
+	if (l.size() < 6) {
+		cerr << "Error: a layer of the network file has only " << l.size() << " columns (at least IFM height, width, channels, kernel height, width and OFM channels)!" << endl;
+		exit(1);
+	}
+	while (l.size() < numLayerDescriptor) {
+		l.push_back(defaultValue[l.size()]);
+	}
+	if (l[7] < 1 || l[9] < 1 || l[10] < 1 || l[8] < 0) {
+		cerr << "Error: stride, groups and dilation must be >= 1 and padding >= 0!" << endl;
+		exit(1);
+	}
+	if (fmod(l[2], l[9]) != 0 || fmod(l[5], l[9]) != 0) {
+		cerr << "Error: groups (" << l[9] << ") must divide both the IFM channels (" << l[2] << ") and the OFM channels (" << l[5] << ")!" << endl;
+		exit(1);
+	}
+	if (LayerOutputHeight(l) < 1 || LayerOutputWidth(l) < 1) {
+		cerr << "Error: the dilated kernel is larger than the padded IFM!" << endl;
+		exit(1);
+	}
+	if (l[12] < 0 || l[12] > 2 || (l[13] != 0 && l[13] != 1)) {
+		cerr << "Error: the layer type must be 0, 1 or 2 and the stored GEMM operand 0 or 1!" << endl;
+		exit(1);
+	}
+	if (l[12] > 0) {
+		if (l[1] != 1 || l[3] != 1 || l[4] != 1 || l[6] != 0 || l[7] != 1 || l[8] != 0 || l[9] != 1 || l[10] != 1) {
+			cerr << "Error: a GEMM layer is written as M,1,K,1,1,N without pooling, stride, padding, groups or dilation!" << endl;
+			exit(1);
+		}
+		if (l[13] == 1) {   // the left operand is stored: (M x K) x (K x N) = ((K x N)^T x (M x K)^T)^T, N rows stream through the stored M x K operand
+			swap(l[0], l[5]);
+		}
+	}
+}
+
+
+double LayerOutputHeight(const vector<double> &layer) {
+	// floor((H + 2*padding - dilation*(K-1) - 1)/stride) + 1, which is H-K+1 for a dense stride-1 layer without padding
+	return floor((layer[0] + 2*layer[8] - layer[10]*(layer[3]-1) - 1)/layer[7]) + 1;
+}
+
+
+double LayerOutputWidth(const vector<double> &layer) {
+	return floor((layer[1] + 2*layer[8] - layer[10]*(layer[4]-1) - 1)/layer[7]) + 1;
+}
+
+
+double LayerNumOperation(const vector<double> &layer) {
+	// counted at the IFM resolution (as before) divided by the stride, with the IFM channels each group actually sees
+	return 2*(layer[0]/layer[7] * layer[1]/layer[7] * layer[2]/layer[9] * layer[3] * layer[4] * layer[5]);
+}
+
+
+bool LayerGroupPacked(const vector<double> &layer) {
+	return param->groupPacking && layer[9] > 1;
+}
+
+
+void LayerGroupPacking(const vector<double> &layer, int *groupPerBand, int *bandRow) {
+	// the (IFM channels/groups x kernel) x (OFM channels/groups) blocks of *groupPerBand groups sit on the diagonal of a band of *bandRow rows (whole subarrays),
+	// the bands are stacked so that each band takes the input rows of its own groups in order, subarrays outside the blocks are never allocated
+	double groupRow = layer[2]/layer[9]*layer[3]*layer[4]*param->numRowPerSynapse;
+	double groupCol = layer[5]/layer[9]*param->numColPerSynapse;
+	*groupPerBand = MAX(1, MIN(floor(param->numRowSubArray/groupRow), floor(param->numColSubArray/groupCol)));
+	*bandRow = ceil((*groupPerBand)*groupRow/param->numRowSubArray)*param->numRowSubArray;
+}
+
+
+bool LayerStoredActivation(const vector<double> &layer) {
+	// a stored activation (activation-stationary GEMM or either operand of an activation x activation GEMM) changes with every input,
+	// so it is written into the arrays at run time
+	return layer[12] == 2 || (layer[12] == 1 && layer[13] == 1);
+}
+
+
+double LayerMatrixRow(const vector<double> &layer) {
+	if (LayerGroupPacked(layer)) {
+		int groupPerBand, bandRow;
+		LayerGroupPacking(layer, &groupPerBand, &bandRow);
+		return ceil(layer[9]/groupPerBand)*bandRow;
+	}
+	return layer[2]*layer[3]*layer[4]*param->numRowPerSynapse;
+}
+
+
+double LayerMatrixCol(const vector<double> &layer) {
+	if (LayerGroupPacked(layer)) {
+		int groupPerBand, bandRow;
+		LayerGroupPacking(layer, &groupPerBand, &bandRow);
+		return groupPerBand*layer[5]/layer[9]*param->numColPerSynapse;
+	}
+	return layer[5]*param->numColPerSynapse;
+}
+
+
+vector<int> ChipDesignInitialize(InputParameter& inputParameter, Technology& tech, MemCell& cell, const vector<vector<double> > &netStructure,
+					double *maxPESizeNM, double *maxTileSizeCM, double *numPENM){
+
+	globalBuffer = new Buffer(inputParameter, tech, cell);
+	GhTree = new HTree(inputParameter, tech, cell);
+	Gaccumulation = new AdderTree(inputParameter, tech, cell);
+	Gsigmoid = new Sigmoid(inputParameter, tech, cell);
+	GreLu = new BitShifter(inputParameter, tech, cell);
+	maxPool = new MaxPooling(inputParameter, tech, cell);
+
+	int numRowPerSynapse, numColPerSynapse;
+	numRowPerSynapse = param->numRowPerSynapse;
+	numColPerSynapse = param->numColPerSynapse;
+	
+	double numLayer, minCube;
+	
+	// get information of network structure
+	numLayer = netStructure.size();
+	
+	*maxPESizeNM = 0;
+	*maxTileSizeCM = 0;
+	*numPENM = 0;
+
+	vector<int> markNM;
+	if (param->novelMapping) {
+		// define number of PE in COV layers
+		int most = 0;
+		int numPE = 0;
+		for (int i=0; i<numLayer; i++) {
+			int temp = netStructure[i][3]*netStructure[i][4];
+			int count = 1;
+			for (int j=0; j<numLayer; j++) {
+				if (temp == netStructure[j][3]*netStructure[j][4]) {
+					count ++;
+				}
+				if (most < count) {
+					most = count;
+					numPE = temp;
+				}
+			}
+		}
+		*numPENM = numPE;
+		// mark the layers that use novel mapping
+		for (int i=0; i<numLayer; i++) {
+			
+			if ((netStructure[i][3]*netStructure[i][4]== (*numPENM))
+				// large Cov layers use novel mapping, packed grouped layers and GEMMs (no kernel window to reuse the input over) never do
+				&&(netStructure[i][2]*netStructure[i][3]*netStructure[i][4]*numRowPerSynapse >= param->numRowSubArray) && !LayerGroupPacked(netStructure[i]) && netStructure[i][12] == 0) {
+				markNM.push_back(1);
+				minCube = pow(2, ceil((double) log2((double) netStructure[i][5]*(double) numColPerSynapse) ) );
+				*maxPESizeNM = max(minCube, (*maxPESizeNM));
+			} else {
+				// small Cov layers and FC layers use conventional mapping
+				markNM.push_back(0);
+				minCube = pow(2, ceil((double) log2(LayerMatrixCol(netStructure[i])) ) );
+				*maxTileSizeCM = max(minCube, (*maxTileSizeCM));
+			}
+		}
+		if (*maxPESizeNM == 0) {
+			// no layer qualifies (e.g. a network of GEMMs only): the chip has conventional-mapped tiles only
+			cout << "No layer uses novel mapping, switching to conventional mapping for all layers" << endl;
+			param->novelMapping = false;
+		}
+	} else {
+		// all layers use conventional mapping
+		for (int i=0; i<numLayer; i++) {
+			markNM.push_back(0);
+			minCube = pow(2, ceil((double) log2(LayerMatrixCol(netStructure[i])) ) );
+			*maxTileSizeCM = max(minCube, (*maxTileSizeCM));
+		}
+	}
+	
+	return markNM;
+}
+
+
+vector<vector<double> > ChipFloorPlan(bool findNumTile, bool findUtilization, bool findSpeedUp, const vector<vector<double> > &netStructure, const vector<int > &markNM, 
+					double maxPESizeNM, double maxTileSizeCM, double numPENM,
+					double *desiredNumTileNM, double *desiredPESizeNM, double *desiredNumTileCM, double *desiredTileSizeCM, double *desiredPESizeCM, int *numTileRow, int *numTileCol) {
+	PROFILE_SCOPE_TRACE("ChipFloorPlan", 1);
+	
+	
+	int numRowPerSynapse, numColPerSynapse;
+	numRowPerSynapse = param->numRowPerSynapse;
+	numColPerSynapse = param->numColPerSynapse;
+	
+	double maxUtilizationNM = 0;
+	double maxUtilizationCM = 0;
+	
+	vector<vector<double> > peDup;
+	vector<vector<double> > subArrayDup;
+	vector<vector<double> > numTileEachLayer;
+	vector<vector<double> > utilizationEachLayer;
+	vector<vector<double> > speedUpEachLayer;
+	
+	*desiredNumTileNM = 0;
+	*desiredPESizeNM = 0;
+	*desiredNumTileCM = 0;
+	*desiredTileSizeCM = 0;
+	*desiredPESizeCM = 0;
+	*numTileRow = 0;
+	*numTileCol = 0;
+
+	if (param->novelMapping) {		// Novel Mapping
+		if (maxPESizeNM < 2*param->numRowSubArray) {
+			cout << "ERROR: SubArray Size is too large, which break the chip hierarchey, please decrease the SubArray size! " << endl;
+		}else{
+		
+			/*** Tile Design ***/
+			*desiredPESizeNM = MAX(maxPESizeNM, 2*param->numRowSubArray);
+			vector<double> initialDesignNM;
+			initialDesignNM = TileDesignNM((*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
+			*desiredNumTileNM = initialDesignNM[0];
+			for (double thisPESize = MAX(maxPESizeNM, 2*param->numRowSubArray); thisPESize> 2*param->numRowSubArray; thisPESize/=2) {
+				// for layers use novel mapping
+				double thisUtilization = 0;
+				vector<double> thisDesign;
+				thisDesign = TileDesignNM(thisPESize, markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
+				thisUtilization = thisDesign[2];
+				if (thisUtilization > maxUtilizationNM) {
+					maxUtilizationNM = thisUtilization;
+					*desiredPESizeNM = thisPESize;
+					*desiredNumTileNM = thisDesign[0];
+				}
+			}
+			*desiredTileSizeCM = MAX(maxTileSizeCM, 4*param->numRowSubArray);
+			vector<double> initialDesignCM;
+			initialDesignCM = TileDesignCM((*desiredTileSizeCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+			*desiredNumTileCM = initialDesignCM[0];
+			for (double thisTileSize = MAX(maxTileSizeCM, 4*param->numRowSubArray); thisTileSize > 4*param->numRowSubArray; thisTileSize/=2) {
+				// for layers use conventional mapping
+				double thisUtilization = 0;
+				vector<double> thisDesign;
+				thisDesign = TileDesignCM(thisTileSize, markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+				thisUtilization = thisDesign[2];
+				if (thisUtilization > maxUtilizationCM) {
+					maxUtilizationCM = thisUtilization;
+					*desiredTileSizeCM = thisTileSize;
+					*desiredNumTileCM = thisDesign[0];
+				}
+			}
+			*desiredPESizeCM = (*desiredTileSizeCM)/2;
+			/*** PE Design ***/
+			for (double thisPESize = (*desiredTileSizeCM)/2; thisPESize > 2*param->numRowSubArray; thisPESize/=2) {
+				// define PE Size for layers use conventional mapping
+				double thisUtilization = 0;
+				vector<vector<double> > thisDesign;
+				thisDesign = PEDesign(true, thisPESize, (*desiredTileSizeCM), (*desiredNumTileCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+				thisUtilization = thisDesign[1][0];
+				if (thisUtilization > maxUtilizationCM) {
+					maxUtilizationCM = thisUtilization;
+					*desiredPESizeCM = thisPESize;
+				}
+			}
+			peDup = PEDesign(false, (*desiredPESizeCM), (*desiredTileSizeCM), (*desiredNumTileCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+			/*** SubArray Duplication ***/
+			subArrayDup = SubArrayDup((*desiredPESizeCM), (*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+			/*** Design SubArray ***/
+			numTileEachLayer = OverallEachLayer(false, false, peDup, subArrayDup, (*desiredTileSizeCM), (*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
+			utilizationEachLayer = OverallEachLayer(true, false, peDup, subArrayDup, (*desiredTileSizeCM), (*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
+			speedUpEachLayer = OverallEachLayer(false, true, peDup, subArrayDup, (*desiredTileSizeCM), (*desiredPESizeNM), markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
+		}
+	} else {   // all Conventional Mapping
+		if (maxTileSizeCM < 4*param->numRowSubArray) {
+			cout << "ERROR: SubArray Size is too large, which break the chip hierarchey, please decrease the SubArray size! " << endl;
+		} else {
+			/*** Tile Design ***/
+			*desiredTileSizeCM = MAX(maxTileSizeCM, 4*param->numRowSubArray);
+			vector<double> initialDesign;
+			initialDesign = TileDesignCM((*desiredTileSizeCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+			*desiredNumTileCM = initialDesign[0];
+			for (double thisTileSize = MAX(maxTileSizeCM, 4*param->numRowSubArray); thisTileSize > 4*param->numRowSubArray; thisTileSize/=2) {
+				// for layers use conventional mapping
+				double thisUtilization = 0;
+				vector<double> thisDesign;
+				thisDesign = TileDesignCM(thisTileSize, markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+				thisUtilization = thisDesign[2];
+				if (thisUtilization > maxUtilizationCM) {
+					maxUtilizationCM = thisUtilization;
+					*desiredTileSizeCM = thisTileSize;
+					*desiredNumTileCM = thisDesign[0];
+				}
+			}
+			*desiredPESizeCM = (*desiredTileSizeCM)/2;
+			/*** PE Design ***/
+			for (double thisPESize = (*desiredTileSizeCM)/2; thisPESize > 2*param->numRowSubArray; thisPESize/=2) {
+				// define PE Size for layers use conventional mapping
+				double thisUtilization = 0;
+				vector<vector<double> > thisDesign;
+				thisDesign = PEDesign(true, thisPESize, (*desiredTileSizeCM), (*desiredNumTileCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+				thisUtilization = thisDesign[1][0];
+				if (thisUtilization > maxUtilizationCM) {
+					maxUtilizationCM = thisUtilization;
+					*desiredPESizeCM = thisPESize;
+				}
+			}
+			peDup = PEDesign(false, (*desiredPESizeCM), (*desiredTileSizeCM), (*desiredNumTileCM), markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+			/*** SubArray Duplication ***/
+			subArrayDup = SubArrayDup((*desiredPESizeCM), 0, markNM, netStructure, numRowPerSynapse, numColPerSynapse);
+			/*** Design SubArray ***/
+			numTileEachLayer = OverallEachLayer(false, false, peDup, subArrayDup, (*desiredTileSizeCM), 0, markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
+			utilizationEachLayer = OverallEachLayer(true, false, peDup, subArrayDup, (*desiredTileSizeCM), 0, markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
+			speedUpEachLayer = OverallEachLayer(false, true, peDup, subArrayDup, (*desiredTileSizeCM), 0, markNM, netStructure, numRowPerSynapse, numColPerSynapse, numPENM);
+		}
+	}
+	
+	*numTileRow = ceil((double)sqrt((double)(*desiredNumTileCM)+(double)(*desiredNumTileNM)));
+	*numTileCol = ceil((double)((*desiredNumTileCM)+(*desiredNumTileNM))/(double)(*numTileRow));
+	
+	vector<vector<double> > tileLocaEachLayer;
+	vector<double> tileLocaEachLayerRow;
+	vector<double> tileLocaEachLayerCol;
+	double thisTileTotal;
+	for (int i=0; i<netStructure.size(); i++) {
+		if (i==0) {
+			tileLocaEachLayerRow.push_back(0);
+			tileLocaEachLayerCol.push_back(0);
+		} else {
+			thisTileTotal += numTileEachLayer[0][i]*numTileEachLayer[1][i];
+			tileLocaEachLayerRow.push_back((int)thisTileTotal/(*numTileRow));
+			tileLocaEachLayerCol.push_back((int)thisTileTotal%(*numTileRow)-1);
+		}
+	}
+	tileLocaEachLayer.push_back(tileLocaEachLayerRow);
+	tileLocaEachLayer.push_back(tileLocaEachLayerCol);
+	
+	if (findNumTile) {
+		return numTileEachLayer;
+	} else if (findUtilization) {
+		return utilizationEachLayer;
+	} else if (findSpeedUp) {
+		return speedUpEachLayer;
+	} else {
+		return tileLocaEachLayer;
+	}
+	peDup.clear();
+	subArrayDup.clear();
+	numTileEachLayer.clear();
+	utilizationEachLayer.clear();
+	speedUpEachLayer.clear();
+}
+
+
+void ChipInitialize(InputParameter& inputParameter, Technology& tech, MemCell& cell, const vector<vector<double> > &netStructure, const vector<int > &markNM, const vector<vector<double> > &numTileEachLayer,
+					double numPENM, double desiredNumTileNM, double desiredPESizeNM, double desiredNumTileCM, double desiredTileSizeCM, double desiredPESizeCM, int numTileRow, int numTileCol) { 
+	PROFILE_SCOPE_TRACE("ChipInitialize", 1);
+
+	/*** Initialize Tile ***/
+
+	if (param->novelMapping) {
+		TileInitialize(inputParameter, tech, cell, numPENM, desiredPESizeNM);
+	}
+	TileInitialize(inputParameter, tech, cell, ceil((double)(desiredTileSizeCM)/(double)(desiredPESizeCM)), desiredPESizeCM);
+	
+	// find max layer and define the global buffer: enough to hold the max layer inputs
+	double maxLayerInput = 0;
+	// define main global bus width
+	double globalBusWidth = 0;
+	// find max # tiles needed to be added at the same time
+	double maxTileAdded = 0;
+	for (int i=0; i<netStructure.size(); i++) {
+		double input = netStructure[i][0]*netStructure[i][1]*netStructure[i][2];  // IFM_Row * IFM_Column * IFM_depth
+		if (input > maxLayerInput) {
+			maxLayerInput = input;
+		}
+		
+		if (markNM[i] == 0) {
+			globalBusWidth += (desiredTileSizeCM)+(desiredTileSizeCM)/param->numColMuxed;
+		} else {
+			globalBusWidth += (desiredPESizeNM)*ceil((double)sqrt(numPENM))+(desiredPESizeNM)*ceil((double)sqrt(numPENM))/param->numColMuxed;
+		}
+		
+		if (numTileEachLayer[0][i] > maxTileAdded) {
+			maxTileAdded = numTileEachLayer[0][i];
+		}
+	}
+	// have to limit the global bus width --> cannot grow dramatically with num of tile
+	while (globalBusWidth > param->maxGlobalBusWidth) {
+		globalBusWidth /= 2;
+	}
+	
+	globalBuffer->Initialize(param->numBitInput*maxLayerInput, globalBusWidth, 1, param->unitLengthWireResistance, param->clkFreq, param->globalBufferType);
+	maxPool->Initialize(param->numBitInput, 2*2, (desiredTileSizeCM));
+	GhTree->Initialize((numTileRow), (numTileCol), param->globalBusDelayTolerance, globalBusWidth);
+	
+	//activation inside Tile or outside?
+	if (param->chipActivation) {
+		if (param->novelMapping) {
+			int maxThroughputTile = (int) max((desiredTileSizeCM), ceil((double)sqrt(numPENM))*(desiredPESizeNM));
+			int maxAddFromSubArray = (int) max(ceil((double)(desiredPESizeCM)/(double)param->numRowSubArray), ceil((double)(desiredPESizeNM)/(double)param->numRowSubArray));   // from subArray to ProcessingUnit
+			maxAddFromSubArray *= (int) max(ceil((double)(desiredTileSizeCM)/(double)(desiredPESizeCM)), ceil((double)sqrt(numPENM)));    // from ProcessingUnit to Tile
+			if (param->parallelRead) {
+				Gaccumulation->Initialize((int) maxTileAdded, ceil((double) log2((double) param->levelOutput))+param->numBitInput+1+ceil((double) log2((double) maxAddFromSubArray)), 
+										ceil((double) maxThroughputTile/(double) param->numColMuxed));
+			} else {
+				Gaccumulation->Initialize((int) maxTileAdded, ceil((double) log2((double) param->numRowSubArray)+(double) param->cellBit-1)+param->numBitInput+1+ceil((double) log2((double) maxAddFromSubArray)), 
+										ceil((double) maxThroughputTile/(double) param->numColMuxed));
+			}
+			if (param->reLu) {
+				GreLu->Initialize(ceil((double) maxThroughputTile/(double) param->numColMuxed), param->numBitInput, param->clkFreq);
+			} else {
+				Gsigmoid->Initialize(false, param->numBitInput, ceil((double) log2((double) param->numRowSubArray)+(double) param->cellBit-1)+param->numBitInput+1+log2((double) maxAddFromSubArray)+ceil((double) log2((double) maxTileAdded)), 
+										ceil((double) maxThroughputTile/(double) param->numColMuxed), param->clkFreq);
+			}
+		} else {
+			int maxAddFromSubArray = (int) ceil((double)(desiredPESizeCM)/(double)param->numRowSubArray);   // from subArray to ProcessingUnit
+			maxAddFromSubArray *= (int) ceil((double)(desiredTileSizeCM)/(double)(desiredPESizeCM));    // from ProcessingUnit to Tile
+			if (param->parallelRead) {
+				Gaccumulation->Initialize((int) maxTileAdded, ceil((double)log2((double)param->levelOutput))+param->numBitInput+1+ceil((double)log2((double)maxAddFromSubArray)), 
+										ceil((double)(desiredTileSizeCM)/(double)param->numColMuxed));
+			} else {
+				Gaccumulation->Initialize((int) maxTileAdded, ceil((double)log2((double)param->numRowSubArray)+(double)param->cellBit-1)+param->numBitInput+1+ceil((double)log2((double)maxAddFromSubArray)), 
+										ceil((double)(desiredTileSizeCM)/(double)param->numColMuxed));
+			}
+			if (param->reLu) {
+				GreLu->Initialize(ceil((double)(desiredTileSizeCM)/(double)param->numColMuxed), param->numBitInput, param->clkFreq);
+			} else {
+				Gsigmoid->Initialize(false, param->numBitInput, ceil((double) log2((double) param->numRowSubArray)+(double) param->cellBit-1)+param->numBitInput+1+log2((double) maxAddFromSubArray)+ceil((double) log2((double) maxTileAdded)), 
+										ceil((double) (desiredTileSizeCM)/(double) param->numColMuxed), param->clkFreq);
+			}
+		}
+	} else {   // activation inside tiles
+		if (param->novelMapping) {
+			int maxThroughputTile = (int) max((desiredTileSizeCM), ceil((double) sqrt((double) numPENM))*(double) (desiredPESizeNM));
+			if (param->parallelRead) {
+				Gaccumulation->Initialize((int) maxTileAdded, param->numBitInput, ceil((double) maxThroughputTile/(double) param->numColMuxed));
+			} else {
+				Gaccumulation->Initialize((int) maxTileAdded, param->numBitInput, ceil((double) maxThroughputTile/(double) param->numColMuxed));
+			}
+		} else {
+			if (param->parallelRead) {
+				Gaccumulation->Initialize((int) maxTileAdded, param->numBitInput, ceil((double) (desiredTileSizeCM)/(double) param->numColMuxed));
+			} else {
+				Gaccumulation->Initialize((int) maxTileAdded, param->numBitInput, ceil((double) (desiredTileSizeCM)/(double) param->numColMuxed));
+			}
+		}
+	}
+}
+
+
+
+vector<double> ChipCalculateArea(InputParameter& inputParameter, Technology& tech, MemCell& cell, double desiredNumTileNM, double numPENM, double desiredPESizeNM, double desiredNumTileCM, double desiredTileSizeCM, 
+						double desiredPESizeCM, int numTileRow, double *height, double *width, double *CMTileheight, double *CMTilewidth, double *NMTileheight, double *NMTilewidth) {
+	PROFILE_SCOPE_TRACE("ChipCalculateArea", 1);
+	
+	vector<double> areaResults;
+	
+	double area = 0;
+	double areaIC = 0;
+	double areaADC = 0;
+	double areaAccum = 0;
+	double areaOther = 0;
+	
+	double NMheight = 0;
+	double NMwidth = 0;
+	double CMheight = 0;
+	double CMwidth = 0;
+	
+	*NMTileheight = 0;
+	*NMTilewidth = 0;
+	*CMTileheight = 0;
+	*CMTilewidth = 0;
+	*height = 0;
+	*width = 0;
+	
+	vector<double> areaCMTile;
+	vector<double> areaNMTile;
+	
+	if (param->novelMapping) {
+		areaNMTile = TileCalculateArea(numPENM, desiredPESizeNM, &NMheight, &NMwidth);
+		double NMTileArea = areaNMTile[0];
+		double NMTileAreaIC = areaNMTile[1];
+		double NMTileAreaADC = areaNMTile[2];
+		double NMTileAreaAccum = areaNMTile[3];
+		double NMTileAreaOther = areaNMTile[4];
+		area += NMTileArea*desiredNumTileNM;
+		areaIC += NMTileAreaIC*desiredNumTileNM;
+		areaADC += NMTileAreaADC*desiredNumTileNM;
+		areaAccum += NMTileAreaAccum*desiredNumTileNM;
+		areaOther += NMTileAreaOther*desiredNumTileNM;
+		*NMTileheight = NMheight;
+		*NMTilewidth = NMwidth;
+	}
+	
+	areaCMTile = TileCalculateArea(pow(ceil((double) desiredTileSizeCM/(double) desiredPESizeCM), 2), desiredPESizeCM, &CMheight, &CMwidth);
+	
+	double CMTileArea = areaCMTile[0];
+	double CMTileAreaIC = areaCMTile[1];
+	double CMTileAreaADC = areaCMTile[2];
+	double CMTileAreaAccum = areaCMTile[3];
+	double CMTileAreaOther = areaCMTile[4];
+	
+	area += CMTileArea*desiredNumTileCM;
+	areaIC += CMTileAreaIC*desiredNumTileCM;
+	areaADC += CMTileAreaADC*desiredNumTileCM;
+	areaAccum += CMTileAreaAccum*desiredNumTileCM;
+	areaOther += CMTileAreaOther*desiredNumTileCM;
+	*CMTileheight = CMheight;
+	*CMTilewidth = CMwidth;
+	
+	globalBuffer->CalculateArea(numTileRow*max(NMheight, CMheight), NULL, NONE);
+	globalBuffer->area *= param->numBufferStage;
+	GhTree->CalculateArea(max(NMheight, CMheight), max(NMwidth, CMwidth), param->treeFoldedRatio);
+	maxPool->CalculateUnitArea(NONE);
+	maxPool->CalculateArea(globalBuffer->width);
+	Gaccumulation->CalculateArea(NULL, globalBuffer->height/3, NONE);
+	
+	double areaGreLu = 0;
+	double areaGsigmoid = 0;
+	
+	if (param->chipActivation) {
+		if (param->reLu) {
+			GreLu->CalculateArea(NULL, globalBuffer->width/3, NONE);
+			area += GreLu->area;
+			areaGreLu += GreLu->area;
+		} else {
+			Gsigmoid->CalculateUnitArea(NONE);
+			Gsigmoid->CalculateArea(NULL, globalBuffer->width/3, NONE);
+			area += Gsigmoid->area;
+			areaGsigmoid += Gsigmoid->area;
+		}
+	}
+	
+	area += globalBuffer->area + GhTree->area + maxPool->area + Gaccumulation->area;
+	areaIC += GhTree->area;
+	areaResults.push_back(area);
+	areaResults.push_back(areaIC);
+	areaResults.push_back(areaADC);
+	areaResults.push_back(areaAccum + Gaccumulation->area);
+	areaResults.push_back(areaOther + globalBuffer->area + GhTree->area + maxPool->area + areaGreLu + areaGsigmoid);
+	
+	*height = sqrt(area);
+	*width = area/(*height);
+	
+	return areaResults;
+}
+
+
+// global buffer and global H-tree traffic of the layer, with the bandwidth these two circuits sustain for it
+void ChipRecordDataMovement(double numBitBuffer, double numBitIC) {
+	rooflineStats.numBitBuffer = numBitBuffer;
+	rooflineStats.numBitIC = numBitIC;
+	double bufferTime = globalBuffer->readLatency + globalBuffer->writeLatency;
+	rooflineStats.bufferPeakBandwidth = (bufferTime > 0)? numBitBuffer/bufferTime : 0;
+	rooflineStats.icPeakBandwidth = (GhTree->readLatency > 0)? numBitIC/GhTree->readLatency : 0;
+}
+
+
+
+double ChipCalculatePerformance(MemCell& cell, int layerNumber, const string &newweightfile, const string &oldweightfile, const string &inputfile, bool followedByMaxPool, 
+							const vector<vector<double> > &netStructure, const vector<int> &markNM, const vector<vector<double> > &numTileEachLayer, const vector<vector<double> > &utilizationEachLayer, 
+							const vector<vector<double> > &speedUpEachLayer, const vector<vector<double> > &tileLocaEachLayer, double numPENM, double desiredPESizeNM, double desiredTileSizeCM, 
+							double desiredPESizeCM, double CMTileheight, double CMTilewidth, double NMTileheight, double NMTilewidth,
+							double *readLatency, double *readDynamicEnergy, double *leakage, double *bufferLatency, double *bufferDynamicEnergy, double *icLatency, double *icDynamicEnergy, 
+							double *coreLatencyADC, double *coreLatencyAccum, double *coreLatencyOther, double *coreEnergyADC, double *coreEnergyAccum, double *coreEnergyOther) {
+	PROFILE_SCOPE_TRACE("ChipCalculatePerformance", LayerOutputHeight(netStructure[layerNumber])*LayerOutputWidth(netStructure[layerNumber]));
+	
+	
+	int numRowPerSynapse, numColPerSynapse;
+	numRowPerSynapse = param->numRowPerSynapse;
+	numColPerSynapse = param->numColPerSynapse;
+	
+	// only get performance of single layer
+	int l = layerNumber;
+	double outputHeight = LayerOutputHeight(netStructure[l]);
+	double outputWidth = LayerOutputWidth(netStructure[l]);
+	// get weight matrix file Size
+	int weightMatrixRow = netStructure[l][2]*netStructure[l][3]*netStructure[l][4]*numRowPerSynapse;
+	int weightMatrixCol = netStructure[l][5]*numColPerSynapse;
+	// the matrix actually mapped onto the tiles, smaller than the dense one for a packed grouped layer
+	int mappedMatrixRow = LayerMatrixRow(netStructure[l]);
+	int mappedMatrixCol = LayerMatrixCol(netStructure[l]);
+	int groupPerBand = 0;
+	int bandRow = 0;
+	if (LayerGroupPacked(netStructure[l])) {
+		LayerGroupPacking(netStructure[l], &groupPerBand, &bandRow);
+	}
+	
+	// load in whole file 
+	vector<vector<double> > inputVector;
+	inputVector = LoadInInputData(inputfile); 
+	if (param->numInputBitPerCycle > 1) {
+		inputVector = MergeInputBitPlane(inputVector, param->numBitInput, param->numInputBitPerCycle);
+	}
+	if (groupPerBand > 0) {
+		inputVector = PackGroupInput(inputVector, netStructure[l][9], groupPerBand, bandRow/numRowPerSynapse);
+	}
+	vector<vector<double> > newMemory;
+	newMemory = LoadInWeightData(newweightfile, numRowPerSynapse, numColPerSynapse, param->maxConductance, param->minConductance, netStructure[l][9], groupPerBand, bandRow/numRowPerSynapse);
+	
+	*readLatency = 0;
+	*readDynamicEnergy = 0;
+	*leakage = 0;
+	*bufferLatency = 0;
+	*bufferDynamicEnergy = 0;
+	*icLatency = 0;
+	*icDynamicEnergy = 0;
+	
+	*coreEnergyADC = 0;
+	*coreEnergyAccum = 0;
+	*coreEnergyOther = 0;
+	*coreLatencyADC = 0;
+	*coreLatencyAccum = 0;
+	*coreLatencyOther = 0;
+	
+	ResetSamplingStats();
+	ResetMonteCarloStats();
+	BreakdownPush("chip");
+	BreakdownPush("layer", l+1);
+	BreakdownClear();       // the layer may be simulated again (e.g. with more duplication)
+	ActivityClear();
+	HeatmapClear(l+1);
+	rooflineStats.numBitBuffer = 0;
+	rooflineStats.numBitIC = 0;
+	rooflineStats.bufferPeakBandwidth = 0;
+	rooflineStats.icPeakBandwidth = 0;
+	
+	double tileLeakage = 0;
+	double tileLatency = 0;
+	int numInVector = outputHeight*outputWidth;
+	int firstTile = 0;      // the tiles of the previous layers come first on the chip
+	for (int k=0; k<l; k++) {
+		firstTile += numTileEachLayer[0][k]*numTileEachLayer[1][k];
+	}
+	
+	if (markNM[l] == 0) {   // conventional mapping
+		double numOutputChannel = 0;
+		for (int i=0; i<numTileEachLayer[0][l]; i++) {       // # of tiles in row
+			for (int j=0; j<numTileEachLayer[1][l]; j++) {   // # of tiles in Column
+				
+				double tileReadLatency = 0;
+				double tileReadDynamicEnergy = 0;
+				double tilebufferLatency = 0;
+				double tilebufferDynamicEnergy = 0;
+				double tileicLatency = 0;
+				double tileicDynamicEnergy = 0;
+				double tileLatencyADC = 0;
+				double tileLatencyAccum = 0;
+				double tileLatencyOther = 0;
+				double tileEnergyADC = 0;
+				double tileEnergyAccum = 0;
+				double tileEnergyOther = 0;
+
+				int numRowMatrix = min(desiredTileSizeCM, mappedMatrixRow-i*desiredTileSizeCM);
+				int numColMatrix = min(desiredTileSizeCM, mappedMatrixCol-j*desiredTileSizeCM);
+				
+				// assign weight and input to specific tile
+				vector<vector<double> > tileMemory;
+				tileMemory = CopyArray(newMemory, i*desiredTileSizeCM, j*desiredTileSizeCM, numRowMatrix, numColMatrix);
+				
+				vector<vector<double> > tileInput;
+				tileInput = CopyInput(inputVector, i*desiredTileSizeCM, outputHeight*outputWidth*param->numInputCycle, numRowMatrix);
+				
+				BreakdownPush("tile", i, j);
+				HeatmapBeginTile(l+1, i, j, firstTile+i*numTileEachLayer[1][l]+j);
+				TileCalculatePerformance(tileMemory, tileMemory, tileInput, markNM[l], ceil((double)desiredTileSizeCM/(double)desiredPESizeCM), desiredPESizeCM, speedUpEachLayer[0][l], speedUpEachLayer[1][l],
+									numRowMatrix, numColMatrix, outputHeight*outputWidth*param->numInputCycle, bandRow, SubInstance(vector<int>(1, l+1), i, j), cell, &tileReadLatency, &tileReadDynamicEnergy, &tileLeakage,
+									&tilebufferLatency, &tilebufferDynamicEnergy, &tileicLatency, &tileicDynamicEnergy, 
+									&tileLatencyADC, &tileLatencyAccum, &tileLatencyOther, &tileEnergyADC, &tileEnergyAccum, &tileEnergyOther);
+				BreakdownPop();
+				if (groupPerBand > 0 && j == 0) {     // each band starting in this tile row sends out the OFM channels of its groups
+					for (int b=ceil((double) i*desiredTileSizeCM/bandRow); b<ceil((double) (i*desiredTileSizeCM+numRowMatrix)/bandRow); b++) {
+						numOutputChannel += MIN(groupPerBand, netStructure[l][9]-b*groupPerBand)*netStructure[l][5]/netStructure[l][9];
+					}
+				}
+				double numPECM = ceil((double)desiredTileSizeCM/(double)desiredPESizeCM);
+				HeatmapEndTile(tileReadLatency, tileReadDynamicEnergy, (double) numRowMatrix*numColMatrix*speedUpEachLayer[0][l]*speedUpEachLayer[1][l],
+								numPECM*numPECM*desiredPESizeCM*desiredPESizeCM);
+
+				string tileScope = LayerScope(l+1) + "/tile" + to_string(i) + "_" + to_string(j);
+				ReportSetBreakdown(tileScope, tileReadLatency, tileReadDynamicEnergy, tilebufferLatency, tilebufferDynamicEnergy, tileicLatency, tileicDynamicEnergy,
+								tileLatencyADC, tileLatencyAccum, tileLatencyOther, tileEnergyADC, tileEnergyAccum, tileEnergyOther);
+				ReportSet(tileScope, "leakagePower", tileLeakage, "W");
+				ReportSet(tileScope, "area", CMTileheight*CMTilewidth, "m^2");
+
+				*readLatency = max(tileReadLatency, (*readLatency));
+				*readDynamicEnergy += tileReadDynamicEnergy;
+				*bufferLatency = max(tilebufferLatency, (*bufferLatency));
+				*bufferDynamicEnergy += tilebufferDynamicEnergy;
+				*icLatency = max(tileicLatency, (*icLatency));
+				*icDynamicEnergy += tileicDynamicEnergy;
+				
+				*coreLatencyADC = MAX(tileLatencyADC, (*coreLatencyADC));
+				*coreLatencyAccum = MAX(tileLatencyAccum, (*coreLatencyAccum));
+				*coreLatencyOther = MAX(tileLatencyOther, (*coreLatencyOther));
+				
+				*coreEnergyADC += tileEnergyADC;
+				*coreEnergyAccum += tileEnergyAccum;
+				*coreEnergyOther += tileEnergyOther;
+
+			}
+		}
+		
+		if (groupPerBand > 0) {
+			ReportSet(LayerScope(l+1), "numOutputChannel", numOutputChannel, "");
+		}
+		
+		// tile part of the layer latency, the part that tiles duplicated at chip level (ChipOptimizeDuplication) split among their copies
+		tileLatency = (*readLatency);
+		
+		if (param->chipActivation && netStructure[l][11]) {
+			if (param->reLu) {
+				GreLu->CalculateLatency(ceil(outputHeight*outputWidth*netStructure[l][5]/(double) GreLu->numUnit));
+				GreLu->CalculatePower(ceil(outputHeight*outputWidth*netStructure[l][5]/(double) GreLu->numUnit));
+				*readLatency += GreLu->readLatency;
+				*readDynamicEnergy += GreLu->readDynamicEnergy;
+				GreLu->AddBreakdown("GreLu");
+				*coreLatencyOther += GreLu->readLatency;
+				*coreEnergyOther += GreLu->readDynamicEnergy;
+			} else {
+				Gsigmoid->CalculateLatency(ceil(outputHeight*outputWidth*netStructure[l][5]/Gsigmoid->numEntry));
+				Gsigmoid->CalculatePower(ceil(outputHeight*outputWidth*netStructure[l][5]/Gsigmoid->numEntry));
+				*readLatency += Gsigmoid->readLatency;
+				*readDynamicEnergy += Gsigmoid->readDynamicEnergy;
+				Gsigmoid->AddBreakdown("Gsigmoid");
+				*coreLatencyOther += Gsigmoid->readLatency;
+				*coreEnergyOther += Gsigmoid->readDynamicEnergy;
+			}
+		}
+		
+		// the tile rows holding different bands of a packed grouped layer produce different outputs, only the tiles of one band are summed
+		double numTileAdded = (groupPerBand > 0)? MIN(numTileEachLayer[0][l], ceil((double) bandRow/desiredTileSizeCM)) : numTileEachLayer[0][l];
+		if (numTileAdded > 1) {   
+			Gaccumulation->CalculateLatency(numTileEachLayer[1][l]*netStructure[l][5]*(ceil(outputHeight*outputWidth/(double) Gaccumulation->numAdderTree)), numTileAdded, 0);
+			Gaccumulation->CalculatePower(numTileEachLayer[1][l]*netStructure[l][5]*(ceil(outputHeight*outputWidth/(double) Gaccumulation->numAdderTree)), numTileAdded);
+			*readLatency += Gaccumulation->readLatency;
+			*readDynamicEnergy += Gaccumulation->readDynamicEnergy;
+			Gaccumulation->AddBreakdown("Gaccumulation");
+			*coreLatencyAccum += Gaccumulation->readLatency;
+			*coreEnergyAccum += Gaccumulation->readDynamicEnergy;
+		}
+		
+		// if this layer is followed by Max Pool (average pooling is modeled with the same 2x2 window unit)
+		if (followedByMaxPool) {
+			maxPool->CalculateLatency(1e20, 0, ceil((double) (outputHeight*outputWidth/(double) maxPool->window)/(double) desiredTileSizeCM));
+			maxPool->CalculatePower(ceil((double) (outputHeight*outputWidth/maxPool->window)/(double) desiredTileSizeCM));
+			*readLatency += maxPool->readLatency;
+			*readDynamicEnergy += maxPool->readDynamicEnergy;
+			maxPool->AddBreakdown("maxPool");
+			*coreLatencyOther += maxPool->readLatency;
+			*coreEnergyOther += maxPool->readDynamicEnergy;
+		}
+		
+		
+		GhTree->CalculateLatency(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], CMTileheight, CMTilewidth, 
+								(weightMatrixRow+weightMatrixCol)*outputHeight*outputWidth/GhTree->busWidth);
+		GhTree->CalculatePower(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], CMTileheight, CMTilewidth, GhTree->busWidth, 
+								(weightMatrixRow+weightMatrixCol)/(desiredPESizeCM)*outputHeight*outputWidth/GhTree->busWidth);
+
+		double numBitToLoadOut = weightMatrixRow*param->numBitInput*outputHeight*outputWidth;
+		double numBitToLoadIn = ceil(weightMatrixCol/param->numColPerSynapse)*param->numBitInput*outputHeight*outputWidth;
+		globalBuffer->CalculateLatency(globalBuffer->interface_width, numBitToLoadOut/globalBuffer->interface_width,
+								globalBuffer->interface_width, numBitToLoadIn/globalBuffer->interface_width);
+		globalBuffer->CalculatePower(globalBuffer->interface_width, numBitToLoadOut/globalBuffer->interface_width,
+								globalBuffer->interface_width, numBitToLoadIn/globalBuffer->interface_width);
+		
+		*bufferLatency += globalBuffer->readLatency + globalBuffer->writeLatency;
+		*bufferDynamicEnergy += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy;
+		*icLatency += GhTree->readLatency;
+		*icDynamicEnergy += GhTree->readDynamicEnergy;
+		
+		*readLatency += globalBuffer->readLatency + globalBuffer->writeLatency + GhTree->readLatency;
+		*readDynamicEnergy += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy + GhTree->readDynamicEnergy;
+		globalBuffer->AddBreakdown("globalBuffer", true);
+		GhTree->AddBreakdown("GhTree");
+		ChipRecordDataMovement(numBitToLoadOut+numBitToLoadIn, (weightMatrixRow+weightMatrixCol)*outputHeight*outputWidth);
+		*coreLatencyOther += globalBuffer->readLatency + globalBuffer->writeLatency + GhTree->readLatency;
+		*coreEnergyOther += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy + GhTree->readDynamicEnergy;
+		if (param->numBufferStage > 1) {
+			double inputShare = (double) weightMatrixRow/(weightMatrixRow+weightMatrixCol);   // the H-tree carries the inputs to the tiles and the outputs back
+			double overlapLatency = BufferOverlapLatency(*readLatency, globalBuffer->readLatency + GhTree->readLatency*inputShare, 
+											globalBuffer->writeLatency + GhTree->readLatency*(1-inputShare), numInVector);
+			*coreLatencyOther -= (*readLatency) - overlapLatency;
+			*readLatency = overlapLatency;
+		}
+
+		if (LayerStoredActivation(netStructure[l])) {
+			// the stored GEMM operand is produced at run time: read it from the global buffer, carry it over the H-tree
+			// and program it into every copy of the matrix before the streamed operand comes in (tiles write in parallel)
+			double reprogramLatency, reprogramDynamicEnergy;
+			ChipCalculateWeightWrite(l, netStructure, markNM, numTileEachLayer, speedUpEachLayer, numPENM, desiredPESizeNM, desiredTileSizeCM, desiredPESizeCM,
+							&reprogramLatency, &reprogramDynamicEnergy);
+			double numBitToWrite = (double) mappedMatrixRow*mappedMatrixCol*param->cellBit;
+			globalBuffer->CalculateLatency(globalBuffer->interface_width, numBitToWrite/globalBuffer->interface_width, globalBuffer->interface_width, 0);
+			globalBuffer->CalculatePower(globalBuffer->interface_width, numBitToWrite/globalBuffer->interface_width, globalBuffer->interface_width, 0);
+			GhTree->CalculateLatency(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], CMTileheight, CMTilewidth, numBitToWrite/GhTree->busWidth);
+			GhTree->CalculatePower(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], CMTileheight, CMTilewidth, GhTree->busWidth, numBitToWrite/GhTree->busWidth);
+			ChipRecordDataMovement(numBitToWrite, numBitToWrite);
+
+			reprogramLatency += globalBuffer->readLatency + GhTree->readLatency;
+			reprogramDynamicEnergy += globalBuffer->readDynamicEnergy + GhTree->readDynamicEnergy;
+			*readLatency += reprogramLatency;
+			*readDynamicEnergy += reprogramDynamicEnergy;
+			*coreLatencyOther += reprogramLatency;
+			*coreEnergyOther += reprogramDynamicEnergy;
+			BreakdownAdd("reprogram", reprogramLatency, reprogramDynamicEnergy);
+			ReportSet(LayerScope(l+1), "reprogramLatency", reprogramLatency, "s");
+			ReportSet(LayerScope(l+1), "reprogramDynamicEnergy", reprogramDynamicEnergy, "J");
+		}
+
+	} else {   // novel Mapping
+		// the kernel-row PEs pass the input on to the next window, so only (stride of K) new input columns are loaded per window
+		double inputReuseNM = netStructure[l][3]/MIN(netStructure[l][7], netStructure[l][3]);
+		for (int i=0; i<numTileEachLayer[0][l]; i++) {       // # of tiles in row
+			for (int j=0; j<numTileEachLayer[1][l]; j++) {   // # of tiles in Column
+				
+				double tileReadLatency = 0;
+				double tileReadDynamicEnergy = 0;
+				double tilebufferLatency = 0;
+				double tilebufferDynamicEnergy = 0;
+				double tileicLatency = 0;
+				double tileicDynamicEnergy = 0;
+				double tileLatencyADC = 0;
+				double tileLatencyAccum = 0;
+				double tileLatencyOther = 0;
+				double tileEnergyADC = 0;
+				double tileEnergyAccum = 0;
+				double tileEnergyOther = 0;
+				
+				// novel mapping
+				int numtileEachLayerRow = ceil((double) netStructure[l][2]*(double) numRowPerSynapse/(double) desiredPESizeNM);
+				int numtileEachLayerCol = ceil((double) netStructure[l][5]*(double) numColPerSynapse/(double) desiredPESizeNM);
+				
+				int numRowMatrix = min(desiredPESizeNM*numPENM, weightMatrixRow-i*desiredPESizeNM*numPENM);
+				int numColMatrix = min(desiredPESizeNM, weightMatrixCol-j*desiredPESizeNM);
+				
+				// assign weight and input to specific tile
+				vector<vector<double> > tileMemory;
+				tileMemory = ReshapeArray(newMemory, i*desiredPESizeNM, j*desiredPESizeNM, (int) netStructure[l][2]*numRowPerSynapse/numtileEachLayerRow, 
+									(int) netStructure[l][5]*numColPerSynapse/numtileEachLayerCol, numPENM, (int) netStructure[l][2]*numRowPerSynapse);
+
+				vector<vector<double> > tileInput;
+				tileInput = ReshapeInput(inputVector, i*desiredPESizeNM, (int) outputHeight*outputWidth*param->numInputCycle, 
+									(int) netStructure[l][2]*numRowPerSynapse/numtileEachLayerRow, numPENM, (int) netStructure[l][2]*numRowPerSynapse);
+	
+				BreakdownPush("tile", i, j);
+				HeatmapBeginTile(l+1, i, j, firstTile+i*numTileEachLayer[1][l]+j);
+				TileCalculatePerformance(tileMemory, tileMemory, tileInput, markNM[l], numPENM, desiredPESizeNM, speedUpEachLayer[0][l], speedUpEachLayer[1][l],
+									numRowMatrix, numColMatrix, numInVector*param->numInputCycle, 0, SubInstance(vector<int>(1, l+1), i, j), cell, 
+									&tileReadLatency, &tileReadDynamicEnergy, &tileLeakage, &tilebufferLatency, &tilebufferDynamicEnergy, &tileicLatency, &tileicDynamicEnergy,
+									&tileLatencyADC, &tileLatencyAccum, &tileLatencyOther, &tileEnergyADC, &tileEnergyAccum, &tileEnergyOther);
+				BreakdownPop();
+				HeatmapEndTile(tileReadLatency, tileReadDynamicEnergy, (double) numRowMatrix*numColMatrix*speedUpEachLayer[0][l]*speedUpEachLayer[1][l],
+								numPENM*desiredPESizeNM*desiredPESizeNM);
+				
+				string tileScope = LayerScope(l+1) + "/tile" + to_string(i) + "_" + to_string(j);
+				ReportSetBreakdown(tileScope, tileReadLatency, tileReadDynamicEnergy, tilebufferLatency, tilebufferDynamicEnergy, tileicLatency, tileicDynamicEnergy,
+								tileLatencyADC, tileLatencyAccum, tileLatencyOther, tileEnergyADC, tileEnergyAccum, tileEnergyOther);
+				ReportSet(tileScope, "leakagePower", tileLeakage, "W");
+				ReportSet(tileScope, "area", NMTileheight*NMTilewidth, "m^2");
+
+				*readLatency = max(tileReadLatency, (*readLatency));
+				*readDynamicEnergy += tileReadDynamicEnergy;
+				*bufferLatency = max(tilebufferLatency, (*bufferLatency));
+				*bufferDynamicEnergy += tilebufferDynamicEnergy;
+				*icLatency = max(tileicLatency, (*icLatency));
+				*icDynamicEnergy += tileicDynamicEnergy;
+				
+				*coreLatencyADC = MAX(tileLatencyADC, (*coreLatencyADC));
+				*coreLatencyAccum = MAX(tileLatencyAccum, (*coreLatencyAccum));
+				*coreLatencyOther = MAX(tileLatencyOther, (*coreLatencyOther));
+				
+				*coreEnergyADC += tileEnergyADC;
+				*coreEnergyAccum += tileEnergyAccum;
+				*coreEnergyOther += tileEnergyOther;
+
+			}
+		}
+		
+		// tile part of the layer latency, the part that tiles duplicated at chip level (ChipOptimizeDuplication) split among their copies
+		tileLatency = (*readLatency) + (*bufferLatency) + (*icLatency);    // tile buffer and interconnect are added to the read latency below
+		
+		if (param->chipActivation && netStructure[l][11]) {
+			if (param->reLu) {
+				GreLu->CalculateLatency(ceil(outputHeight*outputWidth*netStructure[l][5]/(double) GreLu->numUnit));
+				GreLu->CalculatePower(ceil(outputHeight*outputWidth*netStructure[l][5]/(double) GreLu->numUnit));
+				*readLatency += GreLu->readLatency;
+				*readDynamicEnergy += GreLu->readDynamicEnergy;
+				GreLu->AddBreakdown("GreLu");
+				*coreLatencyOther += GreLu->readLatency;
+				*coreEnergyOther += GreLu->readDynamicEnergy;
+			} else {
+				Gsigmoid->CalculateLatency(ceil(outputHeight*outputWidth*netStructure[l][5]/Gsigmoid->numEntry));
+				Gsigmoid->CalculatePower(ceil(outputHeight*outputWidth*netStructure[l][5]/Gsigmoid->numEntry));
+				*readLatency += Gsigmoid->readLatency;
+				*readDynamicEnergy += Gsigmoid->readDynamicEnergy;
+				Gsigmoid->AddBreakdown("Gsigmoid");
+				*coreLatencyOther += Gsigmoid->readLatency;
+				*coreEnergyOther += Gsigmoid->readDynamicEnergy;
+			}
+		}
+		
+		if (numTileEachLayer[0][l] > 1) {   
+			Gaccumulation->CalculateLatency(numTileEachLayer[1][l]*netStructure[l][5]*(ceil(outputHeight*outputWidth/(double) Gaccumulation->numAdderTree)), numTileEachLayer[0][l], 0);
+			Gaccumulation->CalculatePower(numTileEachLayer[1][l]*netStructure[l][5]*(ceil(outputHeight*outputWidth/(double) Gaccumulation->numAdderTree)), numTileEachLayer[0][l]);
+			*readLatency += Gaccumulation->readLatency;
+			*readDynamicEnergy += Gaccumulation->readDynamicEnergy;
+			Gaccumulation->AddBreakdown("Gaccumulation");
+			*coreLatencyAccum += Gaccumulation->readLatency;
+			*coreEnergyAccum += Gaccumulation->readDynamicEnergy;
+		}
+		
+		// if this layer is followed by Max Pool (average pooling is modeled with the same 2x2 window unit)
+		if (followedByMaxPool) {
+			maxPool->CalculateLatency(1e20, 0, ceil((double) (outputHeight*outputWidth/(double) maxPool->window)/(double) desiredPESizeNM*sqrt((double) numPENM)));
+			maxPool->CalculatePower(ceil((double) (outputHeight*outputWidth/maxPool->window)/(double) desiredPESizeNM*sqrt((double) numPENM)));
+			*readLatency += maxPool->readLatency;
+			*readDynamicEnergy += maxPool->readDynamicEnergy;
+			maxPool->AddBreakdown("maxPool");
+			*coreLatencyOther += maxPool->readLatency;
+			*coreEnergyOther += maxPool->readDynamicEnergy;
+		}
+		
+		GhTree->CalculateLatency(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], NMTileheight, NMTilewidth, 
+								(weightMatrixRow+weightMatrixCol)*outputHeight*outputWidth/GhTree->busWidth/inputReuseNM);
+		GhTree->CalculatePower(0, 0, tileLocaEachLayer[0][l], tileLocaEachLayer[1][l], NMTileheight, NMTilewidth, GhTree->busWidth, 
+								(weightMatrixRow+weightMatrixCol)/(desiredPESizeNM)*outputHeight*outputWidth/GhTree->busWidth/inputReuseNM);
+
+		double numBitToLoadOut = weightMatrixRow*param->numBitInput*outputHeight*outputWidth/inputReuseNM;
+		double numBitToLoadIn = weightMatrixCol*param->numBitInput*outputHeight*outputWidth/inputReuseNM;
+		globalBuffer->CalculateLatency(globalBuffer->interface_width, numBitToLoadOut/globalBuffer->interface_width,
+								globalBuffer->interface_width, numBitToLoadIn/globalBuffer->interface_width);
+		globalBuffer->CalculatePower(globalBuffer->interface_width, numBitToLoadOut/globalBuffer->interface_width,
+								globalBuffer->interface_width, numBitToLoadIn/globalBuffer->interface_width);
+								
+		*bufferLatency += globalBuffer->readLatency + globalBuffer->writeLatency;
+		*bufferDynamicEnergy += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy;
+		*icLatency += GhTree->readLatency;
+		*icDynamicEnergy += GhTree->readDynamicEnergy;
+		
+		*readLatency += (*bufferLatency) + (*icLatency);
+		*readDynamicEnergy += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy + GhTree->readDynamicEnergy;
+		globalBuffer->AddBreakdown("globalBuffer", true);
+		GhTree->AddBreakdown("GhTree");
+		ChipRecordDataMovement(numBitToLoadOut+numBitToLoadIn, (weightMatrixRow+weightMatrixCol)*outputHeight*outputWidth/inputReuseNM);
+		
+		*coreLatencyOther += (*bufferLatency) + (*icLatency);
+		*coreEnergyOther += globalBuffer->readDynamicEnergy + globalBuffer->writeDynamicEnergy + GhTree->readDynamicEnergy;
+		if (param->numBufferStage > 1) {
+			double inputShare = (double) weightMatrixRow/(weightMatrixRow+weightMatrixCol);
+			double overlapLatency = BufferOverlapLatency(*readLatency, (*bufferLatency) - globalBuffer->writeLatency + (*icLatency)*inputShare, 
+											globalBuffer->writeLatency + (*icLatency)*(1-inputShare), numInVector);
+			*coreLatencyOther -= (*readLatency) - overlapLatency;
+			*readLatency = overlapLatency;
+		}
+	}
+	*leakage = tileLeakage;
+	BreakdownPop();
+	BreakdownPop();
+	return tileLatency;
+}
+
+
+
+void ChipCalculateWeightWrite(int layerNumber, const vector<vector<double> > &netStructure, const vector<int> &markNM, const vector<vector<double> > &numTileEachLayer, 
+							const vector<vector<double> > &speedUpEachLayer, double numPENM, double desiredPESizeNM, double desiredTileSizeCM, double desiredPESizeCM, 
+							double *writeLatency, double *writeDynamicEnergy) {
+	
+	// program the whole matrix of a layer into its tiles and every copy of them, all tiles write in parallel
+	int l = layerNumber;
+	double numCopy = speedUpEachLayer[0][l]*speedUpEachLayer[1][l];
+	*writeLatency = 0;
+	*writeDynamicEnergy = 0;
+	for (int i=0; i<numTileEachLayer[0][l]; i++) {
+		for (int j=0; j<numTileEachLayer[1][l]; j++) {
+			double tileWriteLatency, tileWriteDynamicEnergy;
+			if (markNM[l] == 0) {
+				int numRowMatrix = min(desiredTileSizeCM, LayerMatrixRow(netStructure[l])-i*desiredTileSizeCM);
+				int numColMatrix = min(desiredTileSizeCM, LayerMatrixCol(netStructure[l])-j*desiredTileSizeCM);
+				TileCalculateWrite(desiredPESizeCM, numRowMatrix, numColMatrix, &tileWriteLatency, &tileWriteDynamicEnergy);
+			} else {
+				// a novel-mapped tile has one PE per kernel position, each holding the same block of input and output channels
+				int numRowMatrix = min(desiredPESizeNM, netStructure[l][2]*param->numRowPerSynapse-i*desiredPESizeNM);
+				int numColMatrix = min(desiredPESizeNM, netStructure[l][5]*param->numColPerSynapse-j*desiredPESizeNM);
+				TileCalculateWrite(desiredPESizeNM, numRowMatrix, numColMatrix, &tileWriteLatency, &tileWriteDynamicEnergy);
+				tileWriteDynamicEnergy *= numPENM;
+			}
+			*writeLatency = max(tileWriteLatency, (*writeLatency));
+			*writeDynamicEnergy += tileWriteDynamicEnergy*numCopy;
+		}
+	}
+}
+
+
+
+void ChipCalculatePipeline(const vector<double> &stageLatency, const vector<double> &stageLeakage, int batchSize, int *bottleneckStage, double *bottleneckLatency,
+							double *imageLatency, double *batchLatency, double *fillDrainLatency, double *leakageEnergy) {
+	
+	// each layer is one pipeline stage on its own tiles, the stage latency is the layer readLatency from ChipCalculatePerformance
+	*bottleneckStage = 0;
+	*bottleneckLatency = 0;
+	*imageLatency = 0;
+	for (int i=0; i<stageLatency.size(); i++) {
+		if (stageLatency[i] > (*bottleneckLatency)) {
+			*bottleneckLatency = stageLatency[i];
+			*bottleneckStage = i;
+		}
+		*imageLatency += stageLatency[i];     // first image has to go through all stages
+	}
+	
+	// after the fill, one image leaves the pipeline every bottleneck period
+	*batchLatency = (*imageLatency) + (batchSize-1)*(*bottleneckLatency);
+	*fillDrainLatency = (*batchLatency) - batchSize*(*bottleneckLatency);
+	
+	// the tiles of a stage only leak when they are not computing (same convention as the layer-by-layer process)
+	*leakageEnergy = 0;
+	for (int i=0; i<stageLatency.size(); i++) {
+		double idleTime = MAX((*batchLatency) - batchSize*stageLatency[i], 0);
+		*leakageEnergy += stageLeakage[i]*idleTime;
+	}
+}
+
+
+
+void ChipCalculateRoofline(double numOperation, double readLatency, double bufferLatency, double icLatency, double numBitBuffer, double numBitIC, 
+							double *computeLatency, double *overlapLatency, double *computeRate, double *bufferBandwidth, double *icBandwidth, 
+							double *intensityBuffer, double *intensityIC, double *attainableRate, int *bound) {
+	
+	// readLatency is the serial sum of the three, whatever is not spent in the buffers or the interconnect is compute (subArrays, accumulation, activation, pooling)
+	*computeLatency = MAX(readLatency - bufferLatency - icLatency, 0);
+	
+	// ceilings of the roofline: the compute rate of the arrays, and the bandwidth the layer gets out of the buffers and the interconnect (in bytes/s)
+	*computeRate = ((*computeLatency) > 0)? numOperation/(*computeLatency) : 0;
+	*bufferBandwidth = (bufferLatency > 0)? numBitBuffer/8/bufferLatency : 0;
+	*icBandwidth = (icLatency > 0)? numBitIC/8/icLatency : 0;
+	*intensityBuffer = (numBitBuffer > 0)? numOperation/(numBitBuffer/8) : 0;
+	*intensityIC = (numBitIC > 0)? numOperation/(numBitIC/8) : 0;
+	
+	// with the data movement fully overlapped with compute, the slowest of the three sets the layer latency
+	*overlapLatency = (*computeLatency);
+	*bound = 0;
+	if (bufferLatency > (*overlapLatency)) {
+		*overlapLatency = bufferLatency;
+		*bound = 1;
+	}
+	if (icLatency > (*overlapLatency)) {
+		*overlapLatency = icLatency;
+		*bound = 2;
+	}
+	*attainableRate = ((*overlapLatency) > 0)? numOperation/(*overlapLatency) : 0;
+}
+
+
+
+vector<double> ChipOptimizeDuplication(const vector<double> &stageLatency, const vector<double> &stageTileLatency, const vector<double> &numTileStage, const vector<double> &tileAreaStage,
+							const vector<double> &maxDupStage, double chipArea, double numTileTotal, double areaBudget, double tileBudget) {
+	
+	// greedy: keep adding one more copy of the bottleneck layer's tiles until the budget is used up
+	// the tile part of the stage latency scales with 1/dup, the chip level part (accumulation, activation, global buffer and H-Tree) does not
+	// a budget <= 0 is no limit, then the greedy stops once a copy gains less than param->minDuplicationGain of the max stage latency;
+	// layers tied for the bottleneck get their copy together, otherwise a tie would look like no gain
+	vector<double> dup(stageLatency.size(), 1);
+	double area = chipArea;
+	double numTile = numTileTotal;
+	
+	while (true) {
+		double maxLatency = 0;
+		for (int i=0; i<stageLatency.size(); i++) {
+			maxLatency = MAX(maxLatency, stageLatency[i] - stageTileLatency[i] + stageTileLatency[i]/dup[i]);
+		}
+		vector<double> newDup(dup);
+		double extraTile = 0;
+		double extraArea = 0;
+		bool canSplit = true;
+		for (int i=0; i<stageLatency.size(); i++) {
+			double latency = stageLatency[i] - stageTileLatency[i] + stageTileLatency[i]/dup[i];
+			if (latency < maxLatency*(1-1e-9)) {
+				continue;
+			}
+			if (dup[i]+1 > maxDupStage[i] || stageTileLatency[i] <= 0) {
+				canSplit = false;      // cannot split the input vectors any further, or the bottleneck is not in the tiles
+			}
+			newDup[i] += 1;
+			extraTile += numTileStage[i];
+			extraArea += numTileStage[i]*tileAreaStage[i];
+		}
+		if (!canSplit) {
+			break;
+		}
+		if ((tileBudget > 0 && numTile+extraTile > tileBudget) || (areaBudget > 0 && area+extraArea > areaBudget)) {
+			break;
+		}
+		double newMaxLatency = 0;
+		for (int i=0; i<stageLatency.size(); i++) {
+			newMaxLatency = MAX(newMaxLatency, stageLatency[i] - stageTileLatency[i] + stageTileLatency[i]/newDup[i]);
+		}
+		if (newMaxLatency > maxLatency*(1-param->minDuplicationGain)) {
+			break;      // the chip level part of the bottleneck dominates, more copies hardly help
+		}
+		dup = newDup;
+		numTile += extraTile;
+		area += extraArea;
+	}
+	return dup;
+}
+
+
+
+vector<vector<double> > ChipPartition(const vector<double> &numTileStage, const vector<double> &tileAreaStage, double peripheryArea, double areaPerChip, int *numChip) {
+	
+	// the layers fill one chip after the other in layer order (the chips form a pipeline), each chip has its own periphery;
+	// a layer that does not fit into what is left of the current chip starts the next one, only a layer larger than a whole chip is split by tiles
+	vector<vector<double> > shard;      // one row per piece of a layer: chip, layer, # of tiles
+	double tileAreaPerChip = areaPerChip - peripheryArea;
+	double freeArea = 0;
+	*numChip = 0;
+	for (int i=0; i<numTileStage.size(); i++) {
+		if (floor(tileAreaPerChip/tileAreaStage[i]) < 1) {
+			*numChip = 0;
+			shard.clear();
+			return shard;       // not even one tile fits next to the periphery
+		}
+		double numTileLeft = numTileStage[i];
+		while (numTileLeft > 0) {
+			bool fitNewChip = numTileLeft*tileAreaStage[i] <= tileAreaPerChip;
+			if (floor(freeArea/tileAreaStage[i]) < 1 || (fitNewChip && numTileLeft*tileAreaStage[i] > freeArea)) {
+				(*numChip)++;
+				freeArea = tileAreaPerChip;
+			}
+			double numTile = MIN(floor(freeArea/tileAreaStage[i]), numTileLeft);
+			vector<double> piece;
+			piece.push_back((*numChip)-1);
+			piece.push_back(i);
+			piece.push_back(numTile);
+			shard.push_back(piece);
+			freeArea -= numTile*tileAreaStage[i];
+			numTileLeft -= numTile;
+		}
+	}
+	return shard;
+}
+
+
+
+double ChipPeripheryLeakage() {
+	// leakage power of the global modules, as set by their last CalculatePower (0 for the ones this design does not use)
+	return globalBuffer->leakage + GhTree->leakage + Gaccumulation->leakage + Gsigmoid->leakage + GreLu->leakage + maxPool->leakage;
+}
+
+
+
+void ChipCalculateMultiChip(const vector<vector<double> > &shard, int numChip, const vector<double> &stageLatency, const vector<double> &stageInputBit,
+							const vector<double> &stageLeakage, const vector<double> &numTileStage, double peripheryLeakage, vector<double> *chipLatency, 
+							vector<double> *linkBit, vector<double> *linkLatency, double *linkEnergy, double *bottleneckLatency, double *imageLatency, double *leakageEnergy) {
+	
+	// chips hosting each layer (contiguous, from ChipPartition)
+	int numLayer = stageLatency.size();
+	vector<int> firstChip(numLayer, numChip);
+	vector<int> lastChip(numLayer, -1);
+	chipLatency->assign(numChip, 0);
+	for (int s=0; s<shard.size(); s++) {
+		int chip = shard[s][0];
+		int layer = shard[s][1];
+		firstChip[layer] = MIN(firstChip[layer], chip);
+		lastChip[layer] = MAX(lastChip[layer], chip);
+		(*chipLatency)[chip] += stageLatency[layer];    // the tiles of a split layer still work in parallel, each piece takes the layer latency
+	}
+	
+	// activations crossing the chips at the input of each layer: the pieces of a split layer send their outputs to the chip of its last piece,
+	// which sends the whole IFM of the next layer to each of the other chips hosting it (the first layer gets its input from the host)
+	linkBit->assign(numLayer, 0);
+	linkLatency->assign(numLayer, 0);
+	*linkEnergy = 0;
+	*imageLatency = 0;
+	*bottleneckLatency = 0;
+	for (int l=0; l<numLayer; l++) {
+		if (l > 0) {
+			double numChipPrev = lastChip[l-1]-firstChip[l-1]+1;
+			double numChipReceive = lastChip[l]-firstChip[l]+1 - ((firstChip[l] == lastChip[l-1])? 1 : 0);
+			(*linkBit)[l] = stageInputBit[l]*(numChipPrev-1)/numChipPrev + stageInputBit[l]*numChipReceive;
+		}
+		if ((*linkBit)[l] > 0) {
+			(*linkLatency)[l] = param->linkLatency + (*linkBit)[l]/param->linkBandwidth;
+		}
+		*linkEnergy += (*linkBit)[l]*param->linkEnergyPerBit;
+		*imageLatency += stageLatency[l] + (*linkLatency)[l];
+		*bottleneckLatency = MAX(*bottleneckLatency, (*linkLatency)[l]);     // each link is a pipeline stage of its own
+	}
+	for (int c=0; c<numChip; c++) {
+		*bottleneckLatency = MAX(*bottleneckLatency, (*chipLatency)[c]);
+	}
+	
+	// leakage of one image in steady state: each piece of a layer leaks while its tiles wait for the bottleneck (as in ChipCalculatePipeline),
+	// the periphery of every chip leaks over the whole period
+	*leakageEnergy = numChip*peripheryLeakage*(*bottleneckLatency);
+	for (int s=0; s<shard.size(); s++) {
+		int layer = shard[s][1];
+		*leakageEnergy += stageLeakage[layer]*shard[s][2]/numTileStage[layer]*(*bottleneckLatency-stageLatency[layer]);
+	}
+}
+
+
+
+void ChipCalculateStreaming(const vector<double> &numTileStage, const vector<double> &tileAreaStage, const vector<double> &stageLatency, const vector<double> &stageWeightBit,
+							const vector<double> &stageWriteLatency, const vector<double> &stageWriteEnergy, const vector<double> &stageLeakage, double peripheryLeakage, 
+							double tileAreaBudget, vector<double> *resident, vector<double> *numPass, vector<double> *stageStreamLatency, double *dramBit, double *dramEnergy, 
+							double *writeEnergy, double *imageLatency, double *leakageEnergy) {
+	
+	// the chip holds tileAreaBudget of tiles: the layers that save the most DRAM traffic per tile area stay resident (programmed once before the first image),
+	// as long as one tile of each other layer still fits next to them; the area left is shared by the streamed layers, a streamed layer whose tiles do not fit
+	// is cut into passes of as many tiles as fit, each pass runs all the input vectors through its piece of the matrix (the tiles of a piece still work in parallel, 
+	// so each pass takes the layer latency)
+	int numLayer = stageLatency.size();
+	resident->assign(numLayer, 1);
+	numPass->assign(numLayer, 1);
+	stageStreamLatency->assign(stageLatency.begin(), stageLatency.end());
+	*dramBit = 0;
+	*dramEnergy = 0;
+	*writeEnergy = 0;
+	*imageLatency = 0;
+	double totalTileArea = 0;
+	for (int l=0; l<numLayer; l++) {
+		totalTileArea += numTileStage[l]*tileAreaStage[l];
+		*imageLatency += stageLatency[l];
+	}
+	// leakage of one image: the tiles leak while they do not compute (as in ChipCalculatePipeline), the periphery over the whole image
+	*leakageEnergy = peripheryLeakage*(*imageLatency);
+	for (int l=0; l<numLayer; l++) {
+		*leakageEnergy += stageLeakage[l]*(*imageLatency-stageLatency[l]);
+	}
+	if (totalTileArea <= tileAreaBudget) {
+		return;     // every weight stays resident
+	}
+	
+	// greedy by weight bits per tile area
+	resident->assign(numLayer, 0);
+	vector<bool> tried(numLayer, false);
+	double residentArea = 0;
+	while (true) {
+		int best = -1;
+		double bestDensity = -1;
+		for (int l=0; l<numLayer; l++) {
+			double density = stageWeightBit[l]/(numTileStage[l]*tileAreaStage[l]);
+			if (!tried[l] && density > bestDensity) {
+				best = l;
+				bestDensity = density;
+			}
+		}
+		if (best < 0) {
+			break;
+		}
+		tried[best] = true;
+		double maxStreamTileArea = 0;
+		for (int l=0; l<numLayer; l++) {
+			if (!(*resident)[l] && l != best) {
+				maxStreamTileArea = MAX(maxStreamTileArea, tileAreaStage[l]);
+			}
+		}
+		if (residentArea + numTileStage[best]*tileAreaStage[best] + maxStreamTileArea <= tileAreaBudget) {
+			(*resident)[best] = 1;
+			residentArea += numTileStage[best]*tileAreaStage[best];
+		}
+	}
+	double streamAreaBudget = tileAreaBudget - residentArea;
+	
+	// a resident layer is one step with nothing to load
+	vector<int> passLayer;
+	vector<double> passArea, passLoadLatency;
+	for (int l=0; l<numLayer; l++) {
+		if ((*resident)[l]) {
+			passLayer.push_back(l);
+			passArea.push_back(0);
+			passLoadLatency.push_back(0);
+			continue;
+		}
+		double maxTilePerPass = floor(streamAreaBudget/tileAreaStage[l]);
+		(*numPass)[l] = ceil(numTileStage[l]/maxTilePerPass);
+		for (int p=0; p<(*numPass)[l]; p++) {
+			double numTile = MIN(maxTilePerPass, numTileStage[l]-p*maxTilePerPass);
+			double numBit = stageWeightBit[l]*numTile/numTileStage[l];
+			passLayer.push_back(l);
+			passArea.push_back(numTile*tileAreaStage[l]);
+			// the tiles write while the weights stream in, whichever is slower paces the load (nothing to load for a GEMM operand produced on chip)
+			passLoadLatency.push_back((numBit > 0)? param->dramLatency + MAX(numBit/param->dramBandwidth, stageWriteLatency[l]) : 0);
+			*dramBit += numBit;
+			*dramEnergy += numBit*param->dramEnergyPerBit;
+			*writeEnergy += stageWriteEnergy[l]*numTile/numTileStage[l];
+		}
+	}
+	
+	// double-buffered schedule: while one step computes, the next pass (of the next image after the last one) is written into the streamed area left free,
+	// the part of it that does not fit there is only loaded once the compute is done
+	*imageLatency = 0;
+	for (int l=0; l<numLayer; l++) {
+		(*stageStreamLatency)[l] = 0;
+	}
+	for (int k=0; k<passLayer.size(); k++) {
+		int next = (k+1) % passLayer.size();
+		double prefetch = (passArea[next] > 0)? MIN(MAX(streamAreaBudget-passArea[k], 0)/passArea[next], 1) : 1;
+		double stepLatency = MAX(stageLatency[passLayer[k]], prefetch*passLoadLatency[next]) + (1-prefetch)*passLoadLatency[next];
+		(*stageStreamLatency)[passLayer[k]] += stepLatency;
+		*imageLatency += stepLatency;
+	}
+	
+	// the streamed area is filled with the tiles of the densest-leaking streamed layer, the part of it a pass does not use stays idle
+	double streamLeakage = 0;
+	for (int l=0; l<numLayer; l++) {
+		if (!(*resident)[l]) {
+			streamLeakage = MAX(streamLeakage, stageLeakage[l]/(numTileStage[l]*tileAreaStage[l])*streamAreaBudget);
+		}
+	}
+	*leakageEnergy = (peripheryLeakage + streamLeakage)*(*imageLatency);
+	for (int k=0; k<passLayer.size(); k++) {
+		int l = passLayer[k];
+		if ((*resident)[l]) {
+			*leakageEnergy += stageLeakage[l]*(*imageLatency-stageLatency[l]);
+		} else {
+			*leakageEnergy -= stageLeakage[l]/(numTileStage[l]*tileAreaStage[l])*passArea[k]*stageLatency[l];
+		}
+	}
+}
+
+
+
+vector<double> TileDesignCM(double tileSize, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse) {
+	double numTileTotal = 0;
+	double matrixTotalCM = 0;
+	double utilization = 0;
+	for (int i=0; i<netStructure.size(); i++) {
+		if (markNM[i] == 0) {
+			numTileTotal += ceil(LayerMatrixRow(netStructure[i])/(double) tileSize) * ceil(LayerMatrixCol(netStructure[i])/tileSize);
+			matrixTotalCM += LayerMatrixRow(netStructure[i])*LayerMatrixCol(netStructure[i]);
+		}
+	}
+	utilization = matrixTotalCM/(numTileTotal*tileSize*tileSize);
+	
+	vector<double> tileDesignCM;
+	tileDesignCM.push_back(numTileTotal);
+	// tileDesignCM[0] = numTileTotal; tileDesignCM[1] = matrixTotalCM; tileDesignCM = utilization
+	tileDesignCM.push_back(matrixTotalCM);
+	tileDesignCM.push_back(utilization);
+	return tileDesignCM;
+	tileDesignCM.clear();
+}
+
+vector<double> TileDesignNM(double peSize, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse, double numPENM){
+	double numTileTotal = 0;
+	double matrixTotalNM = 0;
+	double utilization = 0;
+	for (int i=0; i<netStructure.size(); i++) {
+		if (markNM[i] == 1) {
+			numTileTotal += ceil((double) netStructure[i][2]*(double) numRowPerSynapse/(double) peSize) * ceil((double) netStructure[i][5]*(double) numColPerSynapse/(double) peSize);
+			matrixTotalNM += netStructure[i][2]*netStructure[i][3]*netStructure[i][4]*numRowPerSynapse*netStructure[i][5]*numColPerSynapse;
+		}
+	}
+	utilization = matrixTotalNM/(numTileTotal*peSize*peSize*numPENM);
+	vector<double> tileDesignNM;
+	tileDesignNM.push_back(numTileTotal);
+	tileDesignNM.push_back(matrixTotalNM);
+	tileDesignNM.push_back(utilization);
+	return tileDesignNM;
+	tileDesignNM.clear();
+}
+
+vector<vector<double> > PEDesign(bool Design, double peSize, double desiredTileSize, double numTileTotal, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse) {
+	double matrixTotalCM = 0;
+	double utilization = 0;
+	vector<double> peDupRow;
+	vector<double> peDupCol;
+	for (int i=0; i<netStructure.size(); i++) {
+		int actualDupRow = 0;
+		int actualDupCol = 0;
+		if (markNM[i] ==0) {
+			if ( (LayerMatrixRow(netStructure[i]) <= desiredTileSize)||(LayerMatrixCol(netStructure[i]) <= desiredTileSize) ) {
+				int peForOneMatrixRow = ceil(LayerMatrixRow(netStructure[i])/(double) peSize);
+				int peForOneMatrixCol = ceil(LayerMatrixCol(netStructure[i])/(double) peSize);
+				int numPERow = ceil((double) desiredTileSize/(double) peSize);
+				int numPECol = ceil((double) desiredTileSize/(double) peSize);
+				actualDupRow = floor(numPERow/peForOneMatrixRow)==0? 1:floor(numPERow/peForOneMatrixRow);
+				actualDupCol = floor(numPECol/peForOneMatrixCol)==0? 1:floor(numPECol/peForOneMatrixCol);
+				matrixTotalCM += actualDupRow*actualDupCol*LayerMatrixRow(netStructure[i])*LayerMatrixCol(netStructure[i]);
+			} else {
+				actualDupRow = 1;
+				actualDupCol = 1;
+				matrixTotalCM += actualDupRow*actualDupCol*LayerMatrixRow(netStructure[i])*LayerMatrixCol(netStructure[i]);
+			}
+		} else {
+			actualDupRow = 1;
+			actualDupCol = 1;
+		}
+		peDupRow.push_back(actualDupRow);
+		peDupCol.push_back(actualDupCol);
+	}
+	utilization = matrixTotalCM/(numTileTotal*desiredTileSize*desiredTileSize);
+	
+	vector<double> matrixTotal;
+	matrixTotal.push_back(matrixTotalCM);
+	vector<double> utiliz;
+	utiliz.push_back(utilization);
+	vector<vector<double> > peDesignCM;
+	peDesignCM.push_back(matrixTotal);
+	peDesignCM.push_back(utiliz);
+	matrixTotal.clear();
+	utiliz.clear();
+	
+	vector<vector<double> > peDup;
+	peDup.push_back(peDupRow);
+	peDup.push_back(peDupCol);
+	peDupRow.clear();
+	peDupCol.clear();
+	if (Design) {
+		return peDesignCM;
+	} else {
+		return peDup;
+	}
+	peDesignCM.clear();
+	peDup.clear();
+}
+
+vector<vector<double> > SubArrayDup(double desiredPESizeCM, double desiredPESizeNM, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse) {
+	vector<double> subArrayDupRow;
+	vector<double> subArrayDupCol;
+	
+	for (int i=0; i<netStructure.size(); i++) {
+		int actualDupRow = 0;
+		int actualDupCol = 0;
+		if (markNM[i] == 0){
+			if ( (LayerMatrixRow(netStructure[i]) <= desiredPESizeCM)||(LayerMatrixCol(netStructure[i]) <= desiredPESizeCM) ) {
+				int arrayForOneMatrixRow = ceil(LayerMatrixRow(netStructure[i])/(double) param->numRowSubArray);
+				int arrayForOneMatrixCol = ceil(LayerMatrixCol(netStructure[i])/(double) param->numColSubArray);
+				int numSubArrayRow = ceil((double) desiredPESizeCM/(double) param->numRowSubArray);
+				int numSubArrayCol = ceil((double) desiredPESizeCM/(double) param->numColSubArray);
+				actualDupRow = floor(numSubArrayRow/arrayForOneMatrixRow)==0? 1:floor(numSubArrayRow/arrayForOneMatrixRow);
+				actualDupCol = floor(numSubArrayCol/arrayForOneMatrixCol)==0? 1:floor(numSubArrayCol/arrayForOneMatrixCol);
+			} else {
+				actualDupRow = 1;
+				actualDupCol = 1;
+			}
+		} else {
+			if ( (netStructure[i][2]*numRowPerSynapse <= desiredPESizeNM)||(netStructure[i][5]*numColPerSynapse <= desiredPESizeNM) ) {
+				int arrayForOneMatrixRow = ceil((double) netStructure[i][2]*(double) numRowPerSynapse/(double) param->numRowSubArray);
+				int arrayForOneMatrixCol = ceil((double) netStructure[i][5]*(double) numColPerSynapse/(double) param->numColSubArray);
+				int numSubArrayRow = ceil((double) desiredPESizeNM/(double) param->numRowSubArray);
+				int numSubArrayCol = ceil((double) desiredPESizeNM/(double) param->numColSubArray);
+				actualDupRow = floor(numSubArrayRow/arrayForOneMatrixRow)==0? 1:floor(numSubArrayRow/arrayForOneMatrixRow);
+				actualDupCol = floor(numSubArrayCol/arrayForOneMatrixCol)==0? 1:floor(numSubArrayCol/arrayForOneMatrixCol);
+			} else {
+				actualDupRow = 1;
+				actualDupCol = 1;
+			}
+		}
+		subArrayDupRow.push_back(actualDupRow);
+		subArrayDupCol.push_back(actualDupCol);
+	}
+	vector<vector<double> > subArrayDup;
+	subArrayDup.push_back(subArrayDupRow);
+	subArrayDup.push_back(subArrayDupCol);
+	subArrayDupRow.clear();
+	subArrayDupCol.clear();
+	return subArrayDup;
+	subArrayDup.clear();
+}
+
+vector<vector<double> > OverallEachLayer(bool utilization, bool speedUp, const vector<vector<double> > &peDup, const vector<vector<double> > &subArrayDup, double desiredTileSizeCM, double desiredPESizeNM, 
+										const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse, double numPENM) {
+	vector<double> numTileEachLayerRow;
+	vector<double> numTileEachLayerCol;
+	vector<vector<double> > utilizationEachLayer;	
+	vector<double> speedUpEachLayerRow;
+	vector<double> speedUpEachLayerCol;
+	
+	for (int i=0; i<netStructure.size(); i++) {
+		vector<double> utilization;
+		
+		double numtileEachLayerRow, numtileEachLayerCol, utilizationEach;
+		if (markNM[i] == 0) {
+			// conventional mapping
+			numtileEachLayerRow = ceil(LayerMatrixRow(netStructure[i])/desiredTileSizeCM);
+			numtileEachLayerCol = ceil(LayerMatrixCol(netStructure[i])/(double) desiredTileSizeCM);
+			utilizationEach = (peDup[0][i]*peDup[1][i]*subArrayDup[0][i]*subArrayDup[1][i]*LayerMatrixRow(netStructure[i])
+										*LayerMatrixCol(netStructure[i]))/(numtileEachLayerRow*numtileEachLayerCol*desiredTileSizeCM*desiredTileSizeCM);
+
+			utilization.push_back(utilizationEach);
+		} else {
+			// novel mapping
+			numtileEachLayerRow = ceil((double) netStructure[i][2]*(double) numRowPerSynapse/(double) desiredPESizeNM);
+			numtileEachLayerCol = ceil((double) netStructure[i][5]*(double) numColPerSynapse/(double) desiredPESizeNM);
+			utilizationEach = (peDup[0][i]*peDup[1][i]*subArrayDup[0][i]*subArrayDup[1][i]*netStructure[i][2]*numPENM*numRowPerSynapse*netStructure[i][5]
+										*numColPerSynapse)/(numtileEachLayerRow*numtileEachLayerCol*desiredPESizeNM*desiredPESizeNM*numPENM);
+			
+			utilization.push_back(utilizationEach);
+		}
+		numTileEachLayerRow.push_back(numtileEachLayerRow);
+		numTileEachLayerCol.push_back(numtileEachLayerCol);
+		utilizationEachLayer.push_back(utilization);
+		speedUpEachLayerRow.push_back(peDup[0][i]*subArrayDup[0][i]);
+		speedUpEachLayerCol.push_back(peDup[1][i]*subArrayDup[1][i]);
+		utilization.clear();
+	}
+
+	vector<vector<double> > numTileEachLayer;
+	numTileEachLayer.push_back(numTileEachLayerRow);
+	numTileEachLayer.push_back(numTileEachLayerCol);
+	numTileEachLayerRow.clear();
+	numTileEachLayerCol.clear();
+	
+	vector<vector<double> > speedUpEachLayer;
+	speedUpEachLayer.push_back(speedUpEachLayerRow);
+	speedUpEachLayer.push_back(speedUpEachLayerCol);
+	speedUpEachLayerRow.clear();
+	speedUpEachLayerCol.clear();
+
+	if (utilization) {
+		return utilizationEachLayer;
+	} else if (speedUp) {
+		return speedUpEachLayer;
+	} else {
+		return numTileEachLayer;
+	}
+	utilizationEachLayer.clear();
+	speedUpEachLayer.clear();
+	numTileEachLayer.clear();
+}
+
+
+
+vector<vector<double> > LoadInWeightData(const string &weightfile, int numRowPerSynapse, int numColPerSynapse, double maxConductance, double minConductance, int numGroup, int groupPerBand, int bandRow) {
+	PROFILE_SCOPE_TRACE("LoadInWeightData", 1);
+	
+	ifstream fileone(weightfile.c_str());                           
+	string lineone;
+	string valone;
+	
+	int ROW = 0;
+	int COL = 0;
+	
+	if (!fileone.good()) {                                       
+		cerr << "Error: the fileone cannot be opened!" << endl;
+		exit(1);
+	}else{
+		while (getline(fileone, lineone, '\n')) {                   
+			ROW++;                                             
+		}
+		fileone.clear();
+		fileone.seekg(0, ios::beg);                               
+		if (getline(fileone, lineone, '\n')) {                      
+			istringstream iss (lineone);                         
+			while (getline(iss, valone, ',')) {                   
+				COL++;
+			}
+		}	
+	}
+	fileone.clear();
+	fileone.seekg(0, ios::beg);                   
+	
+	
+	double NormalizedMin = 0;
+	double NormalizedMax = pow(2, param->synapseBit);
+	
+	double RealMax = param->algoWeightMax;
+	double RealMin = param->algoWeightMin;
+	
+	// a grouped layer: the file holds the weights of all groups side by side (ROW = IFM channels/groups x kernel), 
+	// they are placed block-diagonally into the IFM channels x kernel rows of the dense matrix, the rest are zero weights,
+	// or with groupPerBand > 0 packed: groupPerBand groups share the bandRow rows and groupPerBand x (COL/numGroup) columns of each band (LayerGroupPacking)
+	int groupCol = COL/numGroup;
+	vector<vector<double> > weightValue;
+	if (groupPerBand > 0) {
+		weightValue.assign(ceil((double) numGroup/groupPerBand)*bandRow, vector<double>(groupPerBand*groupCol, 0));
+	} else {
+		weightValue.resize(ROW*numGroup);
+	}
+	for (int row=0; row<ROW; row++) {
+		getline(fileone, lineone, '\n');
+		istringstream iss;
+		iss.str(lineone);
+		int col = 0;
+		while(getline(iss, valone, ',')){
+			istringstream fs;
+			fs.str(valone);
+			double f=0;
+			fs >> f;
+			int group = (numGroup > 1)? col/groupCol : 0;
+			if (groupPerBand > 0) {
+				int slot = group%groupPerBand;
+				weightValue[group/groupPerBand*bandRow+slot*ROW+row][slot*groupCol+col%groupCol] = f;
+			} else {
+				for (int g=0; g<numGroup; g++) {
+					weightValue[g*ROW+row].push_back((g == group)? f : 0);
+				}
+			}
+			col++;
+		}
+	}
+	
+	vector<vector<double> > weight;            
+	// load the data into a weight matrix ...
+	for (int row=0; row<weightValue.size(); row++) {	
+		vector<double> weightrow;
+		vector<double> weightrowb;
+		for (int col=0; col<weightValue[row].size(); col++) {
+			double f = weightValue[row][col];
+			//normalize weight to integer
+			double newdata = ((NormalizedMax-NormalizedMin)/(RealMax-RealMin)*(f-RealMax)+NormalizedMax);
+			if (newdata >= 0) {
+				newdata += 0.5;
+			}else {
+				newdata -= 0.5;
+			}
+			// map and expend the weight in memory array
+			int cellrange = pow(2, param->cellBit);
+			vector<double> synapsevector(numColPerSynapse);       
+			int value = newdata; 
+			if (param->BNNparallelMode) {
+				if (value == 1) {
+					weightrow.push_back(maxConductance);
+					weightrow.push_back(minConductance);
+				} else {
+					weightrow.push_back(minConductance);
+					weightrow.push_back(maxConductance);
+				}
+			} else if (param->XNORparallelMode || param->XNORsequentialMode) {
+				if (value == 1) {
+					weightrow.push_back(maxConductance);
+					weightrowb.push_back(minConductance);
+				} else {
+					weightrow.push_back(minConductance);
+					weightrowb.push_back(maxConductance);
+				}
+			} else {
+				int remainder;   
+				for (int z=0; z<numColPerSynapse; z++) {   
+					remainder = ceil((double)(value%cellrange));
+					value = ceil((double)(value/cellrange));
+					synapsevector.insert(synapsevector.begin(), remainder);
+				}
+				for (int u=0; u<numColPerSynapse; u++) {
+					double cellvalue = synapsevector[u];
+					double conductance = cellvalue/(cellrange-1) * (maxConductance-minConductance) + minConductance;
+					weightrow.push_back(conductance);
+				}
+			}
+		}
+		if (param->XNORparallelMode || param->XNORsequentialMode) {
+			weight.push_back(weightrow);
+			weightrow.clear();
+			weight.push_back(weightrowb);
+			weightrowb.clear();
+		} else {
+			weight.push_back(weightrow);
+			weightrow.clear();
+		}
+	}
+	fileone.close();
+	
+	return weight;
+	weight.clear();
+}
+
+
+
+vector<vector<double> > CopyArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol) {
+	
+	vector<vector<double> > copy;
+	for (int i=0; i<numRow; i++) {
+		vector<double> copyRow;
+		for (int j=0; j<numCol; j++) {
+			copyRow.push_back(orginal[positionRow+i][positionCol+j]);
+		}
+		copy.push_back(copyRow);
+		copyRow.clear();
+	}
+	
+	return copy;
+	copy.clear();
+} 
+
+
+
+vector<vector<double> > ReshapeArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol, int numPE, int weightMatrixRow) {
+	
+	vector<vector<double> > copy;
+
+	for (int k=0; k<numPE; k++) {
+		for (int i=0; i<numRow; i++) {
+			vector<double> copyRow;
+			for (int j=0; j<numCol; j++) {
+				copyRow.push_back(orginal[positionRow+k*weightMatrixRow+i][positionCol+j]);
+			}
+			copy.push_back(copyRow);
+			copyRow.clear();
+		}
+	}
+	
+	return copy;
+	copy.clear();
+} 
+
+
+
+vector<vector<double> > LoadInInputData(const string &inputfile) {
+	PROFILE_SCOPE_TRACE("LoadInInputData", 1);
+	
+	ifstream infile(inputfile.c_str());     
+	string inputline;
+	string inputval;
+	
+	int ROWin=0, COLin=0;      
+	if (!infile.good()) {       
+		cerr << "Error: the input file cannot be opened!" << endl;
+		exit(1);
+	}else{
+		while (getline(infile, inputline, '\n')) {      
+			ROWin++;                               
+		}
+		infile.clear();
+		infile.seekg(0, ios::beg);    
+		if (getline(infile, inputline, '\n')) {        
+			istringstream iss (inputline);      
+			while (getline(iss, inputval, ',')) {       
+				COLin++;
+			}
+		}	
+	}
+	infile.clear();
+	infile.seekg(0, ios::beg);          
+	
+	vector<vector<double> > inputvector;              
+	// load the data into inputvector ...
+	for (int row=0; row<ROWin; row++) {	
+		vector<double> inputvectorrow;
+		vector<double> inputvectorrowb;
+		getline(infile, inputline, '\n');             
+		istringstream iss;
+		iss.str(inputline);
+		for (int col=0; col<COLin; col++) {
+			while(getline(iss, inputval, ',')){	
+				istringstream fs;
+				fs.str(inputval);
+				double f=0;
+				fs >> f;
+				
+				if (param->BNNparallelMode) {
+					if (f == 1) {
+						inputvectorrow.push_back(1);
+					} else {
+						inputvectorrow.push_back(0);
+					}
+				} else if (param->XNORparallelMode || param->XNORsequentialMode) {
+					if (f == 1) {
+						inputvectorrow.push_back(1);
+						inputvectorrowb.push_back(0);
+					} else {
+						inputvectorrow.push_back(0);
+						inputvectorrowb.push_back(1);
+					}
+				} else {
+					inputvectorrow.push_back(f);
+				}
+			}
+		}
+		if (param->XNORparallelMode || param->XNORsequentialMode) {
+			inputvector.push_back(inputvectorrow);
+			inputvectorrow.clear();
+			inputvector.push_back(inputvectorrowb);
+			inputvectorrowb.clear();
+		} else {
+			inputvector.push_back(inputvectorrow);
+			inputvectorrow.clear();
+		}
+	}
+	// close the input file ...
+	infile.close();
+	
+	return inputvector;
+	inputvector.clear();
+}
+
+
+
+
+vector<vector<double> > CopyInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow) {
+	
+	vector<vector<double> > copy;
+	for (int i=0; i<numRow; i++) {
+		vector<double> copyRow;
+		for (int j=0; j<numInputVector; j++) {
+			copyRow.push_back(orginal[positionRow+i][j]);
+		}
+		copy.push_back(copyRow);
+		copyRow.clear();
+	}
+	
+	return copy;
+	copy.clear();
+	
+}
+
+
+vector<vector<double> > PackGroupInput(const vector<vector<double> > &orginal, int numGroup, int groupPerBand, int bandRow) {
+	// the input rows of a packed grouped layer (LayerGroupPacking): each band takes the rows of its groupPerBand groups in order, 
+	// the rows left over at the bottom of a band get no input
+	int groupRow = orginal.size()/numGroup;
+	int numBand = ceil((double) numGroup/groupPerBand);
+	vector<vector<double> > packed(numBand*bandRow, vector<double>(orginal[0].size(), 0));
+	for (int band=0; band<numBand; band++) {
+		for (int i=0; i<groupPerBand*groupRow && band*groupPerBand*groupRow+i<orginal.size(); i++) {
+			packed[band*bandRow+i] = orginal[band*groupPerBand*groupRow+i];
+		}
+	}
+	return packed;
+} 
+
+
+vector<vector<double> > MergeInputBitPlane(const vector<vector<double> > &orginal, int numBitInput, int numBitPerCycle) {
+	// the trace holds numBitInput bit-planes per input vector (MSB first), a multi-level wordline driver applies numBitPerCycle of them at once:
+	// each group of bit-planes becomes one input level in [0, 2^numBitPerCycle-1] (the last group is shorter if numBitPerCycle does not divide numBitInput)
+	int numCycle = ceil((double) numBitInput/numBitPerCycle);
+	int numVector = orginal[0].size()/numBitInput;
+	vector<vector<double> > merged(orginal.size(), vector<double>(numVector*numCycle, 0));
+	for (int i=0; i<orginal.size(); i++) {
+		for (int k=0; k<numVector; k++) {
+			for (int b=0; b<numBitInput; b++) {
+				int cycle = b/numBitPerCycle;
+				int lastBit = MIN((cycle+1)*numBitPerCycle, numBitInput) - 1;
+				merged[i][k*numCycle+cycle] += orginal[i][k*numBitInput+b]*pow(2, lastBit-b);
+			}
+		}
+	}
+	return merged;
+}
+
+
+
+vector<vector<double> > ReshapeInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow, int numPE, int weightMatrixRow) {
+	
+	vector<vector<double> > copy;
+
+	for (int k=0; k<numPE; k++) {
+		for (int i=0; i<numRow; i++) {
+			vector<double> copyRow;
+			for (int j=0; j<numInputVector; j++) {
+				copyRow.push_back(orginal[positionRow+k*weightMatrixRow+i][j]);
+			}
+			copy.push_back(copyRow);
+			copyRow.clear();
+		}
+	}
+	
+	return copy;
+	copy.clear();
+} 
+
+
+
+
+
+
+
+
+
+
+
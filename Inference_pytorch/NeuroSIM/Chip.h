@@ -1,77 +1,132 @@
-/*******************************************************************************
-* Copyright (c) 2015-2017
-* School of Electrical, Computer and Energy Engineering, Arizona State University
-* PI: Prof. Shimeng Yu
-* All rights reserved.
-*   
-* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
-* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
-* Copyright of the model is maintained by the developers, and the model is distributed under 
-* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
-* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
-* The source code is free and you can redistribute and/or modify it
-* by providing that the following conditions are met:
-*   
-*  1) Redistributions of source code must retain the above copyright notice,
-*     this list of conditions and the following disclaimer. 
-*   
-*  2) Redistributions in binary form must reproduce the above copyright notice,
-*     this list of conditions and the following disclaimer in the documentation
-*     and/or other materials provided with the distribution.
-*   
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-* 
-* Developer list: 
-*   Pai-Yu Chen     Email: pchen72 at asu dot edu 
-*                     
-*   Xiaochen Peng   Email: xpeng15 at asu dot edu
-********************************************************************************/
-
-#ifndef CHIP_H_
-#define CHIP_H_
-
-/*** Functions ***/
-vector<int> ChipDesignInitialize(InputParameter& inputParameter, Technology& tech, MemCell& cell, const vector<vector<double> > &netStructure,
-					double *maxPESizeNM, double *maxTileSizeCM, double *numPENM);
-					
-vector<vector<double> > ChipFloorPlan(bool findNumTile, bool findUtilization, bool findSpeedUp, const vector<vector<double> > &netStructure, const vector<int > &markNM, 
-					double maxPESizeNM, double maxTileSizeCM, double numPENM, 
-					double *desiredNumTileNM, double *desiredPESizeNM, double *desiredNumTileCM, double *desiredTileSizeCM, double *desiredPESizeCM, int *numTileRow, int *numTileCol);
-					
-void ChipInitialize(InputParameter& inputParameter, Technology& tech, MemCell& cell, const vector<vector<double> > &netStructure, const vector<int > &markNM, const vector<vector<double> > &numTileEachLayer,
-					double numPENM, double desiredNumTileNM, double desiredPESizeNM, double desiredNumTileCM, double desiredTileSizeCM, double desiredPESizeCM, int numTileRow, int numTileCol);
-					
-vector<double> ChipCalculateArea(InputParameter& inputParameter, Technology& tech, MemCell& cell, double desiredNumTileNM, double numPENM, double desiredPESizeNM, double desiredNumTileCM, double desiredTileSizeCM, double desiredPESizeCM, 
-						int numTileRow, double *height, double *width, double *CMTileheight, double *CMTilewidth, double *NMTileheight, double *NMTilewidth);
-						
-double ChipCalculatePerformance(MemCell& cell, int layerNumber, const string &newweightfile, const string &oldweightfile, const string &inputfile, bool followedByMaxPool, const vector<vector<double> > &netStructure, 
-							const vector<int> &markNM, const vector<vector<double> > &numTileEachLayer, const vector<vector<double> > &utilizationEachLayer, const vector<vector<double> > &speedUpEachLayer, 
-							const vector<vector<double> > &tileLocaEachLayer, double numPENM, double desiredPESizeNM, double desiredTileSizeCM, double desiredPESizeCM, 
-							double CMTileheight, double CMTilewidth, double NMTileheight, double NMTilewidth, double *readLatency, double *readDynamicEnergy, 
-							double *leakage, double *bufferLatency, double *bufferDynamicEnergy, double *icLatency, double *icDynamicEnergy,
-							double *coreLatencyADC, double *coreLatencyAccum, double *coreLatencyOther, double *coreEnergyADC, double *coreEnergyAccum, double *coreEnergyOther);
-							
-vector<double> TileDesignCM(double tileSize, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse);
-vector<double> TileDesignNM(double peSize, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse, double numPENM);
-vector<vector<double> > PEDesign(bool Design, double peSize, double desiredTileSize, double numTileTotal, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse);
-vector<vector<double> > SubArrayDup(double desiredPESizeCM, double desiredPESizeNM, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse);
-vector<vector<double> > OverallEachLayer(bool utilization, bool speedUp, const vector<vector<double> > &peDup, const vector<vector<double> > &subArrayDup, double desiredTileSizeCM, double desiredPESizeNM, 
-										const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse, double numPENM);
-
-vector<vector<double> > LoadInWeightData(const string &weightfile, int numRowPerSynapse, int numColPerSynapse, double maxConductance, double minConductance);
-vector<vector<double> > CopyArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol);
-vector<vector<double> > ReshapeArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol, int numPE, int weightMatrixRow);
-vector<vector<double> > LoadInInputData(const string &inputfile);
-vector<vector<double> > CopyInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow);
-vector<vector<double> > ReshapeInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow, int numPE, int weightMatrixRow);
-
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+*   
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+*   
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer. 
+*   
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+*   
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen     Email: pchen72 at asu dot edu 
+*                     
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#ifndef CHIP_H_
+#define CHIP_H_
+
+/*** Data movement of the current layer through the global buffer and the global H-tree, for the roofline analysis ***/
+struct RooflineStats {
+	double numBitBuffer;            // bits read from and written back to the global buffer
+	double numBitIC;                // bits carried by the global H-tree
+	double bufferPeakBandwidth;     // bits/s of the global buffer streaming interface_width bits per line access
+	double icPeakBandwidth;         // bits/s of the global H-tree moving busWidth bits per transfer
+};
+extern RooflineStats rooflineStats;
+
+/*** Layer descriptor: one row of the network file (NetWork.csv) ***/
+// 0: IFM height, 1: IFM width, 2: IFM channels, 3: kernel height, 4: kernel width, 5: OFM channels, 6: pooling after the layer (0: none, 1: max, 2: average),
+// optional: 7: stride (1), 8: zero padding on each side (0), 9: groups (1), 10: dilation (1), 11: activation (1: the ReLU/sigmoid unit of Param.cpp, 0: none)
+// a grouped layer still takes the IFM channels x kernel rows of input, its weight file holds the (IFM channels/groups x kernel) x OFM channels weights of all groups side by side
+// with param->groupPacking the groups are packed into bands of whole subarrays (LayerGroupPacking), so the mapped matrix is LayerMatrixRow x LayerMatrixCol
+// optional: 12: layer type (0: convolution/FC, 1: GEMM activation x weight, 2: GEMM activation x activation), 13: stored GEMM operand (0: the K x N right operand, 1: the M x K left operand)
+// a GEMM (M x K) x (K x N) is written as the 1x1 layer M,1,K,1,1,N: the weight file holds the stored operand, the input file the streamed one
+// (LayerNormalize swaps M and N when the left operand is stored, i.e. activation-stationary for type 1); a stored activation is programmed into the arrays at run time (LayerStoredActivation)
+const int numLayerDescriptor = 14;
+
+/*** Functions ***/
+void LayerNormalize(vector<double> *layer);
+double LayerOutputHeight(const vector<double> &layer);
+double LayerOutputWidth(const vector<double> &layer);
+double LayerNumOperation(const vector<double> &layer);
+bool LayerGroupPacked(const vector<double> &layer);
+void LayerGroupPacking(const vector<double> &layer, int *groupPerBand, int *bandRow);
+double LayerMatrixRow(const vector<double> &layer);
+double LayerMatrixCol(const vector<double> &layer);
+bool LayerStoredActivation(const vector<double> &layer);
+
+vector<int> ChipDesignInitialize(InputParameter& inputParameter, Technology& tech, MemCell& cell, const vector<vector<double> > &netStructure,
+					double *maxPESizeNM, double *maxTileSizeCM, double *numPENM);
+					
+vector<vector<double> > ChipFloorPlan(bool findNumTile, bool findUtilization, bool findSpeedUp, const vector<vector<double> > &netStructure, const vector<int > &markNM, 
+					double maxPESizeNM, double maxTileSizeCM, double numPENM, 
+					double *desiredNumTileNM, double *desiredPESizeNM, double *desiredNumTileCM, double *desiredTileSizeCM, double *desiredPESizeCM, int *numTileRow, int *numTileCol);
+					
+void ChipInitialize(InputParameter& inputParameter, Technology& tech, MemCell& cell, const vector<vector<double> > &netStructure, const vector<int > &markNM, const vector<vector<double> > &numTileEachLayer,
+					double numPENM, double desiredNumTileNM, double desiredPESizeNM, double desiredNumTileCM, double desiredTileSizeCM, double desiredPESizeCM, int numTileRow, int numTileCol);
+					
+vector<double> ChipCalculateArea(InputParameter& inputParameter, Technology& tech, MemCell& cell, double desiredNumTileNM, double numPENM, double desiredPESizeNM, double desiredNumTileCM, double desiredTileSizeCM, double desiredPESizeCM, 
+						int numTileRow, double *height, double *width, double *CMTileheight, double *CMTilewidth, double *NMTileheight, double *NMTilewidth);
+						
+void ChipRecordDataMovement(double numBitBuffer, double numBitIC);
+
+double ChipCalculatePerformance(MemCell& cell, int layerNumber, const string &newweightfile, const string &oldweightfile, const string &inputfile, bool followedByMaxPool, const vector<vector<double> > &netStructure, 
+							const vector<int> &markNM, const vector<vector<double> > &numTileEachLayer, const vector<vector<double> > &utilizationEachLayer, const vector<vector<double> > &speedUpEachLayer, 
+							const vector<vector<double> > &tileLocaEachLayer, double numPENM, double desiredPESizeNM, double desiredTileSizeCM, double desiredPESizeCM, 
+							double CMTileheight, double CMTilewidth, double NMTileheight, double NMTilewidth, double *readLatency, double *readDynamicEnergy, 
+							double *leakage, double *bufferLatency, double *bufferDynamicEnergy, double *icLatency, double *icDynamicEnergy,
+							double *coreLatencyADC, double *coreLatencyAccum, double *coreLatencyOther, double *coreEnergyADC, double *coreEnergyAccum, double *coreEnergyOther);
+							
+void ChipCalculateWeightWrite(int layerNumber, const vector<vector<double> > &netStructure, const vector<int> &markNM, const vector<vector<double> > &numTileEachLayer, 
+							const vector<vector<double> > &speedUpEachLayer, double numPENM, double desiredPESizeNM, double desiredTileSizeCM, double desiredPESizeCM, 
+							double *writeLatency, double *writeDynamicEnergy);
+void ChipCalculatePipeline(const vector<double> &stageLatency, const vector<double> &stageLeakage, int batchSize, int *bottleneckStage, double *bottleneckLatency,
+							double *imageLatency, double *batchLatency, double *fillDrainLatency, double *leakageEnergy);
+							
+void ChipCalculateRoofline(double numOperation, double readLatency, double bufferLatency, double icLatency, double numBitBuffer, double numBitIC, 
+							double *computeLatency, double *overlapLatency, double *computeRate, double *bufferBandwidth, double *icBandwidth, 
+							double *intensityBuffer, double *intensityIC, double *attainableRate, int *bound);
+							
+vector<double> ChipOptimizeDuplication(const vector<double> &stageLatency, const vector<double> &stageTileLatency, const vector<double> &numTileStage, const vector<double> &tileAreaStage,
+							const vector<double> &maxDupStage, double chipArea, double numTileTotal, double areaBudget, double tileBudget);
+vector<vector<double> > ChipPartition(const vector<double> &numTileStage, const vector<double> &tileAreaStage, double peripheryArea, double areaPerChip, int *numChip);
+double ChipPeripheryLeakage();
+void ChipCalculateMultiChip(const vector<vector<double> > &shard, int numChip, const vector<double> &stageLatency, const vector<double> &stageInputBit,
+							const vector<double> &stageLeakage, const vector<double> &numTileStage, double peripheryLeakage, vector<double> *chipLatency, 
+							vector<double> *linkBit, vector<double> *linkLatency, double *linkEnergy, double *bottleneckLatency, double *imageLatency, double *leakageEnergy);
+void ChipCalculateStreaming(const vector<double> &numTileStage, const vector<double> &tileAreaStage, const vector<double> &stageLatency, const vector<double> &stageWeightBit,
+							const vector<double> &stageWriteLatency, const vector<double> &stageWriteEnergy, const vector<double> &stageLeakage, double peripheryLeakage, 
+							double tileAreaBudget, vector<double> *resident, vector<double> *numPass, vector<double> *stageStreamLatency, double *dramBit, double *dramEnergy, 
+							double *writeEnergy, double *imageLatency, double *leakageEnergy);
+							
+vector<double> TileDesignCM(double tileSize, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse);
+vector<double> TileDesignNM(double peSize, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse, double numPENM);
+vector<vector<double> > PEDesign(bool Design, double peSize, double desiredTileSize, double numTileTotal, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse);
+vector<vector<double> > SubArrayDup(double desiredPESizeCM, double desiredPESizeNM, const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse);
+vector<vector<double> > OverallEachLayer(bool utilization, bool speedUp, const vector<vector<double> > &peDup, const vector<vector<double> > &subArrayDup, double desiredTileSizeCM, double desiredPESizeNM, 
+										const vector<int > &markNM, const vector<vector<double> > &netStructure, int numRowPerSynapse, int numColPerSynapse, double numPENM);
+
+vector<vector<double> > LoadInWeightData(const string &weightfile, int numRowPerSynapse, int numColPerSynapse, double maxConductance, double minConductance, int numGroup, int groupPerBand, int bandRow);
+vector<vector<double> > CopyArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol);
+vector<vector<double> > ReshapeArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol, int numPE, int weightMatrixRow);
+vector<vector<double> > LoadInInputData(const string &inputfile);
+vector<vector<double> > CopyInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow);
+vector<vector<double> > PackGroupInput(const vector<vector<double> > &orginal, int numGroup, int groupPerBand, int bandRow);
+vector<vector<double> > MergeInputBitPlane(const vector<vector<double> > &orginal, int numBitInput, int numBitPerCycle);
+vector<vector<double> > ReshapeInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow, int numPE, int weightMatrixRow);
+
 #endif /* CHIP_H_ */
\ No newline at end of file
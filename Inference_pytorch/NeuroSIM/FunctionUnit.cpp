@@ -39,6 +39,7 @@
 #include <iostream>
 #include <fstream>
 #include "FunctionUnit.h"
+#include "Breakdown.h"
 
 using namespace std;
 
@@ -115,3 +116,11 @@ void FunctionUnit::OverrideLayout() {
 	area = height * width;
 }
 
+void FunctionUnit::AddBreakdown(const char* name, bool withWrite) {
+	// contribution of the last access of this instance under the current breakdown path (withWrite: buffers, which are filled and drained)
+	if (withWrite) {
+		BreakdownAdd(name, readLatency + writeLatency, readDynamicEnergy + writeDynamicEnergy);
+	} else {
+		BreakdownAdd(name, readLatency, readDynamicEnergy);
+	}
+}
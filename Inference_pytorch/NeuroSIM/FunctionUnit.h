@@ -49,6 +49,7 @@ public:
 	virtual void SaveOutput(const char* str);
 	virtual void MagicLayout();
 	virtual void OverrideLayout();
+	void AddBreakdown(const char* name, bool withWrite=false);
 
 	/* Properties */
 	double height;		/* Unit: m */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "Heatmap.h"
+#include "Param.h"
+
+using namespace std;
+
+extern Param *param;
+
+struct HeatmapCell {
+	int layer, tileRow, tileCol;
+	int peRow, peCol;               // -1: the whole tile
+	int chipIndex;                  // position of the tile on the chip grid
+	double latency, energy, utilization;
+};
+
+vector<HeatmapCell> heatmap;
+HeatmapCell heatmapTile;            // tile being simulated, its PEs are added with the same layer/tile/chipIndex
+
+void HeatmapClear(int layer) {
+	// the layer may be simulated again (e.g. with more duplication)
+	if (!param->heatmap) {
+		return;
+	}
+	int numKeep = 0;
+	for (int i=0; i<heatmap.size(); i++) {
+		if (heatmap[i].layer != layer) {
+			heatmap[numKeep++] = heatmap[i];
+		}
+	}
+	heatmap.resize(numKeep);
+}
+
+
+void HeatmapBeginTile(int layer, int tileRow, int tileCol, int chipIndex) {
+	if (!param->heatmap) {
+		return;
+	}
+	heatmapTile.layer = layer;
+	heatmapTile.tileRow = tileRow;
+	heatmapTile.tileCol = tileCol;
+	heatmapTile.chipIndex = chipIndex;
+}
+
+
+void HeatmapAddPE(int peRow, int peCol, double latency, double energy, double numMappedCell, double numCell) {
+	if (!param->heatmap) {
+		return;
+	}
+	HeatmapCell cell = heatmapTile;
+	cell.peRow = peRow;
+	cell.peCol = peCol;
+	cell.latency = latency;
+	cell.energy = energy;
+	cell.utilization = numCell > 0? min(numMappedCell/numCell, 1.0) : 0;
+	heatmap.push_back(cell);
+}
+
+
+void HeatmapEndTile(double latency, double energy, double numMappedCell, double numCell) {
+	HeatmapAddPE(-1, -1, latency, energy, numMappedCell, numCell);
+}
+
+
+bool HeatmapLayerOrder(const HeatmapCell &a, const HeatmapCell &b) {
+	return a.layer < b.layer;
+}
+
+
+void HeatmapWrite(const string &filename, int numTileRow, int numTileCol) {
+	// one line per tile (peRow = peCol = -1) and per PE, PE latency includes the speedup of its duplication inside the tile
+	ofstream file(filename.c_str());
+	if (!file.is_open()) {
+		cout << "ERROR: cannot write the heatmap to " << filename << endl;
+		return;
+	}
+	vector<HeatmapCell> sorted = heatmap;
+	stable_sort(sorted.begin(), sorted.end(), HeatmapLayerOrder);
+	file.precision(17);
+	file << "layer,tileRow,tileCol,peRow,peCol,chipRow,chipCol,readLatency,readDynamicEnergy,utilization" << endl;
+	for (int i=0; i<sorted.size(); i++) {
+		const HeatmapCell &c = sorted[i];
+		file << c.layer << "," << c.tileRow << "," << c.tileCol << "," << c.peRow << "," << c.peCol << ","
+			<< c.chipIndex/numTileCol << "," << c.chipIndex%numTileCol << "," << c.latency << "," << c.energy << "," << c.utilization << endl;
+	}
+	cout << "Heatmap of " << sorted.size() << " tiles and PEs (" << numTileRow << "x" << numTileCol << " tile grid) written to " << filename << endl;
+}
@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "SubArray.h"
+#include "MultilevelSenseAmp.h"
+#include "ProcessingUnit.h"
+#include "formula.h"
+#include "MonteCarlo.h"
+#include "Param.h"
+
+using namespace std;
+
+extern Param *param;
+
+MonteCarloStats monteCarloStats;
+
+void SubArrayMonteCarlo(SubArray *subArray, const vector<vector<double> > &subArrayMemory, const vector<vector<double> > &subArrayInput, int numInVector, 
+						const vector<int> &instance, MemCell& cell,
+						const vector<double> &senseAmpLatency, const vector<double> &senseAmpEnergy, 
+						const vector<double> &nominalLatency, const vector<double> &nominalEnergy, double readLatency) {
+	
+	// senseAmpLatency/senseAmpEnergy: multilevelSenseAmp terms of each input vector in the nominal simulation (already scaled by numColMuxed and # of reads),
+	// nominalLatency/nominalEnergy: the same terms unscaled (one read of one column group), all recorded by the nominal pass of SubArrayCalculatePerformance
+	// each trial programs the array once (device-to-device variation and stuck-at faults), then reads all the input vectors;
+	// only the multilevelSenseAmp terms depend on the column resistance, so each trial rescales them by the unscaled column latency/energy ratio
+	// instance = (layer, tile, PE, subArray) indices: every subArray and trial gets its own stream, the result depends neither on the # of threads nor on the simulation order
+	vector<unsigned int> seedData = InstanceSeed(param->monteCarloSeed, instance);
+	
+	int numTrial = param->numTrialMonteCarlo;
+	if (monteCarloStats.latency.size() != numTrial) {
+		monteCarloStats.latency.assign(numTrial, 0);
+		monteCarloStats.energyDelta.assign(numTrial, 0);
+	}
+	monteCarloStats.numSubArray += 1;
+	monteCarloStats.nominalLatency = MAX(monteCarloStats.nominalLatency, readLatency);
+	
+	if (cell.memCellType == Type::SRAM) {
+		// SRAM column resistance does not depend on the weight
+		for (int t=0; t<numTrial; t++) {
+			monteCarloStats.latency[t] = MAX(monteCarloStats.latency[t], readLatency);
+		}
+		return;
+	}
+	
+	vector<double> trialLatency(numTrial, 0);
+	vector<double> trialEnergyDelta(numTrial, 0);
+	#pragma omp parallel for schedule(dynamic)
+	for (int t=0; t<numTrial; t++) {
+		vector<unsigned int> trialSeedData(seedData);
+		trialSeedData.push_back(t);
+		seed_seq seed(trialSeedData.begin(), trialSeedData.end());
+		mt19937 gen(seed);
+		normal_distribution<double> variation(0, param->sigmaConductance);
+		uniform_real_distribution<double> fault(0, 1);
+		
+		vector<vector<double> > memory(subArrayMemory);
+		for (int i=0; i<memory.size(); i++) {
+			for (int j=0; j<memory[i].size(); j++) {
+				double p = fault(gen);
+				if (p < param->stuckAtOffRate) {
+					memory[i][j] = param->minConductance;
+				} else if (p < param->stuckAtOffRate + param->stuckAtOnRate) {
+					memory[i][j] = param->maxConductance;
+				} else {
+					memory[i][j] *= exp(variation(gen));     // lognormal conductance variation
+				}
+			}
+		}
+		
+		MultilevelSenseAmp multilevelSenseAmp(subArray->multilevelSenseAmp);
+		double latency = readLatency;
+		double energyDelta = 0;
+		vector<double> input;               // scratch of this thread, reused by all the input vectors of the trial
+		vector<double> columnResistance;
+		for (int k=0; k<numInVector; k++) {
+			double activityRowRead = 0;
+			GetInputVector(subArrayInput, k, &input, &activityRowRead);
+			GetColumnResistance(input, memory, cell, param->parallelRead, subArray->resCellAccess, &columnResistance);
+			multilevelSenseAmp.CalculateLatency(columnResistance, 1, 1);
+			multilevelSenseAmp.CalculatePower(columnResistance, 1);
+			if (nominalLatency[k] > 0) {
+				latency += senseAmpLatency[k]*(multilevelSenseAmp.readLatency/nominalLatency[k] - 1);
+			}
+			if (nominalEnergy[k] > 0) {
+				energyDelta += senseAmpEnergy[k]*(multilevelSenseAmp.readDynamicEnergy/nominalEnergy[k] - 1);
+			}
+		}
+		trialLatency[t] = latency;
+		trialEnergyDelta[t] = energyDelta;
+	}
+	
+	for (int t=0; t<numTrial; t++) {
+		monteCarloStats.latency[t] = MAX(monteCarloStats.latency[t], trialLatency[t]);
+		monteCarloStats.energyDelta[t] += trialEnergyDelta[t];
+	}
+}
+
+
+void ResetMonteCarloStats() {
+	monteCarloStats.numSubArray = 0;
+	monteCarloStats.nominalLatency = 0;
+	monteCarloStats.latency.assign(param->numTrialMonteCarlo, 0);
+	monteCarloStats.energyDelta.assign(param->numTrialMonteCarlo, 0);
+}
+
+
+void MonteCarloSummary(const vector<double> &sample, double *mean, double *stdDev, double *low, double *high) {
+	// mean, standard deviation and the 5%/95% percentiles of the trials
+	*mean = 0;
+	*stdDev = 0;
+	*low = 0;
+	*high = 0;
+	if (sample.empty()) {
+		return;
+	}
+	double n = sample.size();
+	for (int t=0; t<sample.size(); t++) {
+		*mean += sample[t]/n;
+	}
+	for (int t=0; t<sample.size(); t++) {
+		*stdDev += (sample[t]-(*mean))*(sample[t]-(*mean));
+	}
+	*stdDev = (n > 1)? sqrt((*stdDev)/(n-1)) : 0;
+	
+	vector<double> sorted(sample);
+	sort(sorted.begin(), sorted.end());
+	*low = sorted[(int) floor(0.05*(n-1))];
+	*high = sorted[(int) ceil(0.95*(n-1))];
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#ifndef MONTECARLO_H_
+#define MONTECARLO_H_
+
+#include <vector>
+#include "MemCell.h"
+#include "SubArray.h"
+
+using namespace std;
+
+/*** Monte-Carlo statistics, accumulated over the subArrays of the current layer, one entry per trial ***/
+struct MonteCarloStats {
+	double numSubArray;             // # of subArrays simulated with device variation
+	double nominalLatency;          // critical path (max subArray readLatency) without variation
+	vector<double> latency;         // critical path (max subArray readLatency) of each trial
+	vector<double> energyDelta;     // change of readDynamicEnergy (summed over subArrays) of each trial
+};
+extern MonteCarloStats monteCarloStats;
+
+/*** Functions ***/
+void SubArrayMonteCarlo(SubArray *subArray, const vector<vector<double> > &subArrayMemory, const vector<vector<double> > &subArrayInput, int numInVector, 
+						const vector<int> &instance, MemCell& cell,
+						const vector<double> &senseAmpLatency, const vector<double> &senseAmpEnergy, 
+						const vector<double> &nominalLatency, const vector<double> &nominalEnergy, double readLatency);
+void ResetMonteCarloStats();
+void MonteCarloSummary(const vector<double> &sample, double *mean, double *stdDev, double *low, double *high);
+
+#endif /* MONTECARLO_H_ */
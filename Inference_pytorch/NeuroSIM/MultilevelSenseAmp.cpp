@@ -1,484 +1,415 @@
-/*******************************************************************************
-* Copyright (c) 2015-2017
-* School of Electrical, Computer and Energy Engineering, Arizona State University
-* PI: Prof. Shimeng Yu
-* All rights reserved.
-* 
-* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
-* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
-* Copyright of the model is maintained by the developers, and the model is distributed under 
-* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
-* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
-* The source code is free and you can redistribute and/or modify it
-* by providing that the following conditions are met:
-* 
-*  1) Redistributions of source code must retain the above copyright notice,
-*     this list of conditions and the following disclaimer.
-* 
-*  2) Redistributions in binary form must reproduce the above copyright notice,
-*     this list of conditions and the following disclaimer in the documentation
-*     and/or other materials provided with the distribution.
-* 
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-* 
-* Developer list: 
-*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
-*                    
-*   Xiaochen Peng   Email: xpeng15 at asu dot edu
-********************************************************************************/
-
-#include <cmath>
-#include <iostream>
-#include <vector>
-#include "constant.h"
-#include "formula.h"
-#include "Param.h"
-#include "MultilevelSenseAmp.h"
-
-using namespace std;
-
-extern Param *param;
-
-MultilevelSenseAmp::MultilevelSenseAmp(const InputParameter& _inputParameter, const Technology& _tech, const MemCell& _cell): inputParameter(_inputParameter), tech(_tech), cell(_cell), currentSenseAmp(_inputParameter, _tech, _cell), FunctionUnit() {
-	initialized = false;
-}
-
-void MultilevelSenseAmp::Initialize(int _numCol, int _levelOutput, double _clkFreq, int _numReadCellPerOperationNeuro, bool _parallel) {
-	if (initialized) {
-		cout << "[MultilevelSenseAmp] Warning: Already initialized!" << endl;
-    } else {
-
-	numCol = _numCol;
-	levelOutput = _levelOutput;                // # of bits for A/D output ... 
-	clkFreq = _clkFreq;
-	numReadCellPerOperationNeuro = _numReadCellPerOperationNeuro;
-	parallel = _parallel;
-	
-	if (parallel) {
-		for (int i=0; i<levelOutput-1; i++){
-			double R_start = (double) param->resistanceOn / param->numRowSubArray;
-			double R_index = (double) param->resistanceOff / param->numRowSubArray;
-			double R_this = R_start + (double) (i+1)*R_index/levelOutput;
-			Rref.push_back(R_this);
-		} // TODO: Nonlinear Quantize
-	} else {
-		for (int i=0; i<levelOutput-1; i++){
-			double R_start = (double) param->resistanceOn;
-			double R_index = (double) param->resistanceOff;
-			double R_this = R_start + (double) (i+1)*R_index/levelOutput;
-			Rref.push_back(R_this);
-		} // TODO: Nonlinear Quantize
-	}
-	widthNmos = MIN_NMOS_SIZE * tech.featureSize;
-	widthPmos = tech.pnSizeRatio * MIN_NMOS_SIZE * tech.featureSize;
-	// Initialize SenseAmp
-	currentSenseAmp.Initialize((levelOutput-1)*numCol, false, false, clkFreq, numReadCellPerOperationNeuro);        // use real-traced mode ... 
-	initialized = true;
-	}
-}
-
-void MultilevelSenseAmp::CalculateArea(double heightArray, double widthArray, AreaModify _option) {
-	if (!initialized) {
-		cout << "[MultilevelSenseAmp] Error: Require initialization first!" << endl;
-	} else {
-		
-		area = 0;
-		height = 0;
-		width = 0;
-		
-		double hNmos, wNmos, hPmos, wPmos;
-		CalculateGateArea(INV, 1, widthNmos, 0, tech.featureSize*MAX_TRANSISTOR_HEIGHT, tech, &hNmos, &wNmos);
-		CalculateGateArea(INV, 1, 0, widthPmos, tech.featureSize*MAX_TRANSISTOR_HEIGHT, tech, &hPmos, &wPmos);
-		
-		if (widthArray && _option==NONE) {
-			currentSenseAmp.CalculateUnitArea();
-			currentSenseAmp.CalculateArea(widthArray);
-			area = currentSenseAmp.area;
-			area += ((hNmos*wNmos)*9 + (hPmos*wPmos)*9)*(levelOutput-1)*numCol;
-			width = widthArray;
-			height = area / width;
-		} else if (heightArray && _option==NONE) {
-			currentSenseAmp.CalculateUnitArea();
-			currentSenseAmp.CalculateArea(heightArray);
-			area = currentSenseAmp.area;
-			area += ((hNmos*wNmos)*9 + (hPmos*wPmos)*9)*(levelOutput-1)*numCol;
-			height = heightArray;
-			width = area / height;
-		} else {
-			cout << "[MultilevelSenseAmp] Error: No width or height assigned for the multiSenseAmp circuit" << endl;
-			exit(-1);
-		}
-		// Assume the Current Mirrors are on the same row and the total width of them is smaller than the adder or DFF
-		
-		// Modify layout
-		newHeight = heightArray;
-		newWidth = widthArray;
-		switch (_option) {
-			case MAGIC:
-				MagicLayout();
-				break;
-			case OVERRIDE:
-				OverrideLayout();
-				break;  
-			default:    // NONE
-				break;
-		}
-
-	}
-}
-
-void MultilevelSenseAmp::CalculateLatency(const vector<double> &columnResistance, double numColMuxed, double numRead) {
-	if (!initialized) {
-		cout << "[MultilevelSenseAmp] Error: Require initialization first!" << endl;
-	} else {
-		readLatency = 0;
-		double LatencyCol = 0;
-		for (double j=0; j<columnResistance.size(); j++){
-			double T_Col = 0;
-			T_Col = GetColumnLatency(columnResistance[j]);
-			if (columnResistance[j] == columnResistance[j]) {
-				LatencyCol = max(LatencyCol, T_Col);
-			} else {
-				LatencyCol = LatencyCol;
-			}
-			if (LatencyCol < 1e-9) {
-				LatencyCol = 1e-9;
-			} else if (LatencyCol > 10e-9) {
-				LatencyCol = 10e-9;
-			}
-		}
-		readLatency += LatencyCol*numColMuxed;
-		readLatency *= numRead;
-	}
-}
-
-void MultilevelSenseAmp::CalculatePower(const vector<double> &columnResistance, double numRead) {
-	if (!initialized) {
-		cout << "[MultilevelSenseAmp] Error: Require initialization first!" << endl;
-	} else {
-		leakage = 0;
-		readDynamicEnergy = 0;
-		for (double i=0; i<columnResistance.size(); i++) {
-			double E_Col = 0;
-			E_Col = GetColumnPower(columnResistance[i]);
-			if (columnResistance[i] == columnResistance[i]) {
-				readDynamicEnergy += E_Col;
-			} else {
-				readDynamicEnergy += 0;
-			}
-		}
-		readDynamicEnergy *= numRead;
-	}
-} 
-
-void MultilevelSenseAmp::PrintProperty(const char* str) {
-	FunctionUnit::PrintProperty(str);
-}
-
-
-double MultilevelSenseAmp::GetColumnLatency(double columnRes) {
-	double Column_Latency = 0;
-	double up_bound = 3, mid_bound = 1.1, low_bound = 0.9;
-	double T_max = 0;
-	
-	if (((double) 1/columnRes == 0) || (columnRes == 0)) {
-		Column_Latency = 0;
-	} else {
-		if (param->deviceroadmap == 1) {  // HP
-			Column_Latency = 1e-9;
-		} else {                         // LP
-			if (param->technode == 130) {
-				T_max = (0.2679*log(columnRes/1000)+0.0478)*1e-9;   // T_max = (0.2679*log(R_BL/1000)+0.0478)*10^-9;
-
-				for (int i=1; i<levelOutput-1; i++){
-					double ratio = Rref[i]/columnRes;
-					double T = 0;
-					if (ratio >= 20 || ratio <= 0.05) {
-						T = 1e-9;
-					} else {
-						if (ratio <= low_bound){
-							T = T_max * (3.915*pow(ratio,3)-5.3996*pow(ratio,2)+2.4653*ratio+0.3856);  // y = 3.915*x^3-5.3996*x^2+2.4653*x+0.3856;
-						} else if (mid_bound <= ratio <= up_bound){
-							T = T_max * (0.0004*pow(ratio,4)-0.0087*pow(ratio,3)+0.0742*pow(ratio,2)-0.2725*ratio+1.2211);  // y = 0.0004*x^4-0.0087*x^3+0.0742*x^2-0.2725*x+1.2211;
-						} else if (ratio>up_bound){
-							T = T_max * (0.0004*pow(ratio,4)-0.0087*pow(ratio,3)+0.0742*pow(ratio,2)-0.2725*ratio+1.2211);
-						} else {
-							T = T_max;
-						}
-					}
-					Column_Latency = max(Column_Latency, T);
-				}
-			} else if (param->technode == 90) {
-				T_max = (0.0586*log(columnRes/1000)+1.41)*1e-9;   // T_max = (0.0586*log(R_BL/1000)+1.41)*10^-9;
-
-				for (int i=1; i<levelOutput-1; i++){
-					double ratio = Rref[i]/columnRes;
-					double T = 0;
-					if (ratio >= 20 || ratio <= 0.05) {
-						T = 1e-9;
-					} else {
-						if (ratio <= low_bound){
-							T = T_max * (3.726*pow(ratio,3)-5.651*pow(ratio,2)+2.8249*ratio+0.3574);    // y = 3.726*x^3-5.651*x^2+2.8249*x+0.3574;
-						} else if (mid_bound <= ratio <= up_bound){
-							T = T_max * (0.0000008*pow(ratio,4)-0.00007*pow(ratio,3)+0.0017*pow(ratio,2)-0.0188*ratio+0.9835);  // y = 0.0000008*x^4-0.00007*x^3+0.0017*x^2-0.0188*x+0.9835;
-						} else if (ratio>up_bound){
-							T = T_max * (0.0000008*pow(ratio,4)-0.00007*pow(ratio,3)+0.0017*pow(ratio,2)-0.0188*ratio+0.9835);
-						} else {
-							T = T_max;
-						}
-					}
-					Column_Latency = max(Column_Latency, T);
-				}
-			} else if (param->technode == 65) {
-				T_max = (0.1239*log(columnRes/1000)+0.6642)*1e-9;   // T_max = (0.1239*log(R_BL/1000)+0.6642)*10^-9;
-
-				for (int i=1; i<levelOutput-1; i++){
-					double ratio = Rref[i]/columnRes;
-					double T = 0;
-					if (ratio >= 20 || ratio <= 0.05) {
-						T = 1e-9;
-					} else {
-						if (ratio <= low_bound){
-							T = T_max * (1.3899*pow(ratio,3)-2.6913*pow(ratio,2)+2.0483*ratio+0.3202);    // y = 1.3899*x^3-2.6913*x^2+2.0483*x+0.3202;
-						} else if (mid_bound <= ratio <= up_bound){
-							T = T_max * (0.0036*pow(ratio,4)-0.0363*pow(ratio,3)+0.1043*pow(ratio,2)-0.0346*ratio+1.0512);   // y = 0.0036*x^4-0.0363*x^3+0.1043*x^2-0.0346*x+1.0512;
-						} else if (ratio>up_bound){
-							T = T_max * (0.0036*pow(ratio,4)-0.0363*pow(ratio,3)+0.1043*pow(ratio,2)-0.0346*ratio+1.0512);
-						} else {
-							T = T_max;
-						}
-					}
-					Column_Latency = max(Column_Latency, T);
-				}
-			} else if (param->technode == 45 || param->technode == 32) {
-				T_max = (0.0714*log(columnRes/1000)+0.7651)*1e-9;    // T_max = (0.0714*log(R_BL/1000)+0.7651)*10^-9;
-
-				for (int i=1; i<levelOutput-1; i++){
-					double ratio = Rref[i]/columnRes;
-					double T = 0;
-					if (ratio >= 20 || ratio <= 0.05) {
-						T = 1e-9;
-					} else {
-						if (ratio <= low_bound){
-							T = T_max * (3.7949*pow(ratio,3)-5.6685*pow(ratio,2)+2.6492*ratio+0.4807);    // y = 3.7949*x^3-5.6685*x^2+2.6492*x+0.4807
-						} else if (mid_bound <= ratio <= up_bound){
-							T = T_max * (0.000001*pow(ratio,4)-0.00006*pow(ratio,3)+0.0001*pow(ratio,2)-0.0171*ratio+1.0057);   // 0.000001*x^4-0.00006*x^3+0.0001*x^2-0.0171*x+1.0057;
-						} else if (ratio>up_bound){
-							T = T_max * (0.000001*pow(ratio,4)-0.00006*pow(ratio,3)+0.0001*pow(ratio,2)-0.0171*ratio+1.0057);
-						} else {
-							T = T_max;
-						}
-					}
-					Column_Latency = max(Column_Latency, T);
-				}
-			} else {   // technode below and equal to 22nm
-				Column_Latency = 1e-9;
-			}
-		}
-	}
-	return Column_Latency;
-}
-
-
-
-double MultilevelSenseAmp::GetColumnPower(double columnRes) {
-	double Column_Power = 0;
-	double Column_Energy = 0;
-
-	if ((double) 1/columnRes == 0) { 
-		Column_Power = 1e-6;
-	} else if (columnRes == 0) {
-		Column_Power = 0;
-	} else {
-		if (param->deviceroadmap == 1) {  // HP
-			if (param->technode == 130) {
-				Column_Power = 19.898*1e-6;
-			} else if (param->technode == 90) {
-				Column_Power = 13.09*1e-6;
-			} else if (param->technode == 65) {
-				Column_Power = 9.9579*1e-6;
-			} else if (param->technode == 45) {
-				Column_Power = 7.7017*1e-6;
-			} else if (param->technode == 32){  
-				Column_Power = 3.9648*1e-6;
-			} else if (param->technode == 22){   
-				Column_Power = 1.8939*1e-6;
-			} else if (param->technode == 14){  
-				Column_Power = 1.2*1e-6;
-			} else if (param->technode == 10){  
-				Column_Power = 0.8*1e-6;
-			} else {   // 7nm
-				Column_Power = 0.5*1e-6;
-			}
-		} else {                         // LP
-			if (param->technode == 130) {
-				Column_Power = 18.09*1e-6;
-			} else if (param->technode == 90) {
-				Column_Power = 12.612*1e-6;
-			} else if (param->technode == 65) {
-				Column_Power = 8.4147*1e-6;
-			} else if (param->technode == 45) {
-				Column_Power = 6.3162*1e-6;
-			} else if (param->technode == 32){  
-				Column_Power = 3.0875*1e-6;
-			} else if (param->technode == 22){   
-				Column_Power = 1.7*1e-6;
-			} else if (param->technode == 14){   
-				Column_Power = 1.0*1e-6;
-			} else if (param->technode == 10){   
-				Column_Power = 0.55*1e-6;
-			} else {   // 7nm
-				Column_Power = 0.35*1e-6;
-			}
-		}
-	}
-	
-	double up_bound = 3, mid_bound = 1.1, low_bound = 0.9;
-	double T_max = 0;
-	if (((double) 1/columnRes == 0) || (columnRes == 0)) {
-		Column_Energy += 0;
-	} else {
-		if (param->deviceroadmap == 1) {  // HP
-			Column_Energy = Column_Power*1e-9*(levelOutput-1);
-		} else {                         // LP
-			if (param->technode == 130) {
-				T_max = (0.2679*log(columnRes/1000)+0.0478)*1e-9;   // T_max = (0.2679*log(R_BL/1000)+0.0478)*10^-9;
-
-				for (int i=1; i<levelOutput-1; i++){
-					double ratio = Rref[i]/columnRes;
-					double T = 0;
-					if (ratio >= 20 || ratio <= 0.05) {
-						T = 1e-9;
-					} else {
-						if (ratio <= low_bound){
-							T = T_max * (3.915*pow(ratio,3)-5.3996*pow(ratio,2)+2.4653*ratio+0.3856);  // y = 3.915*x^3-5.3996*x^2+2.4653*x+0.3856;
-						} else if (mid_bound <= ratio <= up_bound){
-							T = T_max * (0.0004*pow(ratio,4)-0.0087*pow(ratio,3)+0.0742*pow(ratio,2)-0.2725*ratio+1.2211);  // y = 0.0004*x^4-0.0087*x^3+0.0742*x^2-0.2725*x+1.2211;
-						} else if (ratio>up_bound){
-							T = T_max * (0.0004*pow(ratio,4)-0.0087*pow(ratio,3)+0.0742*pow(ratio,2)-0.2725*ratio+1.2211);
-						} else {
-							T = T_max;
-						}
-					}
-					Column_Energy += Column_Power*T;
-				}
-			} else if (param->technode == 90) {
-				T_max = (0.0586*log(columnRes/1000)+1.41)*1e-9;   // T_max = (0.0586*log(R_BL/1000)+1.41)*10^-9;
-
-				for (int i=1; i<levelOutput-1; i++){
-					double ratio = Rref[i]/columnRes;
-					double T = 0;
-					if (ratio >= 20 || ratio <= 0.05) {
-						T = 1e-9;
-					} else {
-						if (ratio <= low_bound){
-							T = T_max * (3.726*pow(ratio,3)-5.651*pow(ratio,2)+2.8249*ratio+0.3574);    // y = 3.726*x^3-5.651*x^2+2.8249*x+0.3574;
-						} else if (mid_bound <= ratio <= up_bound){
-							T = T_max * (0.0000008*pow(ratio,4)-0.00007*pow(ratio,3)+0.0017*pow(ratio,2)-0.0188*ratio+0.9835);  // y = 0.0000008*x^4-0.00007*x^3+0.0017*x^2-0.0188*x+0.9835;
-						} else if (ratio>up_bound){
-							T = T_max * (0.0000008*pow(ratio,4)-0.00007*pow(ratio,3)+0.0017*pow(ratio,2)-0.0188*ratio+0.9835);
-						} else {
-							T = T_max;
-						}
-					}
-					Column_Energy += Column_Power*T;
-				}
-			} else if (param->technode == 65) {
-				T_max = (0.1239*log(columnRes/1000)+0.6642)*1e-9;   // T_max = (0.1239*log(R_BL/1000)+0.6642)*10^-9;
-
-				for (int i=1; i<levelOutput-1; i++){
-					double ratio = Rref[i]/columnRes;
-					double T = 0;
-					if (ratio >= 20 || ratio <= 0.05) {
-						T = 1e-9;
-					} else {
-						if (ratio <= low_bound){
-							T = T_max * (1.3899*pow(ratio,3)-2.6913*pow(ratio,2)+2.0483*ratio+0.3202);    // y = 1.3899*x^3-2.6913*x^2+2.0483*x+0.3202;
-						} else if (mid_bound <= ratio <= up_bound){
-							T = T_max * (0.0036*pow(ratio,4)-0.0363*pow(ratio,3)+0.1043*pow(ratio,2)-0.0346*ratio+1.0512);   // y = 0.0036*x^4-0.0363*x^3+0.1043*x^2-0.0346*x+1.0512;
-						} else if (ratio>up_bound){
-							T = T_max * (0.0036*pow(ratio,4)-0.0363*pow(ratio,3)+0.1043*pow(ratio,2)-0.0346*ratio+1.0512);
-						} else {
-							T = T_max;
-						}
-					}
-					Column_Energy += Column_Power*T;
-				}
-			} else if (param->technode == 45 || param->technode == 32) {
-				T_max = (0.0714*log(columnRes/1000)+0.7651)*1e-9;    // T_max = (0.0714*log(R_BL/1000)+0.7651)*10^-9;
-
-				for (int i=1; i<levelOutput-1; i++){
-					double ratio = Rref[i]/columnRes;
-					double T = 0;
-					if (ratio >= 20 || ratio <= 0.05) {
-						T = 1e-9;
-					} else {
-						if (ratio <= low_bound){
-							T = T_max * (3.7949*pow(ratio,3)-5.6685*pow(ratio,2)+2.6492*ratio+0.4807);    // y = 3.7949*x^3-5.6685*x^2+2.6492*x+0.4807
-						} else if (mid_bound <= ratio <= up_bound){
-							T = T_max * (0.000001*pow(ratio,4)-0.00006*pow(ratio,3)+0.0001*pow(ratio,2)-0.0171*ratio+1.0057);   // 0.000001*x^4-0.00006*x^3+0.0001*x^2-0.0171*x+1.0057;
-						} else if (ratio>up_bound){
-							T = T_max * (0.000001*pow(ratio,4)-0.00006*pow(ratio,3)+0.0001*pow(ratio,2)-0.0171*ratio+1.0057);
-						} else {
-							T = T_max;
-						}
-					}
-					Column_Energy += Column_Power*T;
-				}
-			} else {   // technode below and equal to 22nm
-				Column_Energy += Column_Power*1e-9*(levelOutput-1);
-			}
-		}
-	}
-	if (param->deviceroadmap == 1) {  // HP			
-		if (param->technode == 130) {
-			Column_Energy += 0.207452*exp(-2.367*log10(columnRes))*1e-9;
-		} else if (param->technode == 90) {
-			Column_Energy += 0.164900*exp(-2.345*log10(columnRes))*1e-9;
-		} else if (param->technode == 65) {
-			Column_Energy += 0.128483*exp(-2.321*log10(columnRes))*1e-9;
-		} else if (param->technode == 45) {
-			Column_Energy += 0.097754*exp(-2.296*log10(columnRes))*1e-9;
-		} else if (param->technode == 32){  
-			Column_Energy += 0.083709*exp(-2.313*log10(columnRes))*1e-9;
-		} else if (param->technode == 22){   
-			Column_Energy += 0.084273*exp(-2.311*log10(columnRes))*1e-9;
-		} else if (param->technode == 14){  
-			Column_Energy += 0.060584*exp(-2.311*log10(columnRes))*1e-9;
-		} else if (param->technode == 10){  
-			Column_Energy += 0.049418*exp(-2.311*log10(columnRes))*1e-9;
-		} else {   // 7nm
-			Column_Energy += 0.040310*exp(-2.311*log10(columnRes))*1e-9;
-		}
-	} else {                         // LP
-		if (param->technode == 130) {
-			Column_Energy += 0.169380*exp(-2.303*log10(columnRes))*1e-9;
-		} else if (param->technode == 90) {
-			Column_Energy += 0.144323*exp(-2.303*log10(columnRes))*1e-9;
-		} else if (param->technode == 65) {
-			Column_Energy += 0.121272*exp(-2.303*log10(columnRes))*1e-9;
-		} else if (param->technode == 45) {
-			Column_Energy += 0.100225*exp(-2.303*log10(columnRes))*1e-9;
-		} else if (param->technode == 32){  
-			Column_Energy += 0.079449*exp(-2.297*log10(columnRes))*1e-9;
-		} else if (param->technode == 22){   
-			Column_Energy += 0.072341*exp(-2.303*log10(columnRes))*1e-9;
-		} else if (param->technode == 14){   
-			Column_Energy += 0.061085*exp(-2.303*log10(columnRes))*1e-9;
-		} else if (param->technode == 10){   
-			Column_Energy += 0.051580*exp(-2.303*log10(columnRes))*1e-9;
-		} else {   // 7nm
-			Column_Energy += 0.043555*exp(-2.303*log10(columnRes))*1e-9;
-		}
-	}	
-	return Column_Energy;
-}
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "constant.h"
+#include "formula.h"
+#include "Param.h"
+#include "MultilevelSenseAmp.h"
+
+using namespace std;
+
+extern Param *param;
+
+MultilevelSenseAmp::MultilevelSenseAmp(const InputParameter& _inputParameter, const Technology& _tech, const MemCell& _cell): inputParameter(_inputParameter), tech(_tech), cell(_cell), currentSenseAmp(_inputParameter, _tech, _cell), FunctionUnit() {
+	initialized = false;
+}
+
+void MultilevelSenseAmp::Initialize(int _numCol, int _levelOutput, double _clkFreq, int _numReadCellPerOperationNeuro, bool _parallel) {
+	if (initialized) {
+		cout << "[MultilevelSenseAmp] Warning: Already initialized!" << endl;
+    } else {
+
+	numCol = _numCol;
+	levelOutput = _levelOutput;                // # of bits for A/D output ... 
+	clkFreq = _clkFreq;
+	numReadCellPerOperationNeuro = _numReadCellPerOperationNeuro;
+	parallel = _parallel;
+	
+	if (parallel) {
+		// a multi-level input drives up to 2^numInputBitPerCycle-1 times the cell current, so the ladder spans a proportionally lower column resistance
+		double maxInputLevel = pow(2, param->numInputBitPerCycle) - 1;
+		for (int i=0; i<levelOutput-1; i++){
+			double R_start = (double) param->resistanceOn / (param->numRowSubArray*maxInputLevel);
+			double R_index = (double) param->resistanceOff / (param->numRowSubArray*maxInputLevel);
+			double R_this = R_start + (double) (i+1)*R_index/levelOutput;
+			Rref.push_back(R_this);
+		} // TODO: Nonlinear Quantize
+	} else {
+		for (int i=0; i<levelOutput-1; i++){
+			double R_start = (double) param->resistanceOn;
+			double R_index = (double) param->resistanceOff;
+			double R_this = R_start + (double) (i+1)*R_index/levelOutput;
+			Rref.push_back(R_this);
+		} // TODO: Nonlinear Quantize
+	}
+	widthNmos = MIN_NMOS_SIZE * tech.featureSize;
+	widthPmos = tech.pnSizeRatio * MIN_NMOS_SIZE * tech.featureSize;
+	
+	// resolve the technology-specific fits once, GetColumnLatency/GetColumnPower only evaluate them
+	double low[4] = {0, 0, 0, 0};
+	double high[5] = {0, 0, 0, 0, 0};
+	fitLatency = false;
+	coeffTmax[0] = 0;
+	coeffTmax[1] = 0;
+	if (param->deviceroadmap != 1) {   // LP
+		if (param->technode == 130) {
+			fitLatency = true;
+			coeffTmax[0] = 0.2679; coeffTmax[1] = 0.0478;                       // T_max = (0.2679*log(R_BL/1000)+0.0478)*10^-9;
+			double l[4] = {0.3856, 2.4653, -5.3996, 3.915};                     // y = 3.915*x^3-5.3996*x^2+2.4653*x+0.3856;
+			double h[5] = {1.2211, -0.2725, 0.0742, -0.0087, 0.0004};          // y = 0.0004*x^4-0.0087*x^3+0.0742*x^2-0.2725*x+1.2211;
+			copy(l, l+4, low); copy(h, h+5, high);
+		} else if (param->technode == 90) {
+			fitLatency = true;
+			coeffTmax[0] = 0.0586; coeffTmax[1] = 1.41;                         // T_max = (0.0586*log(R_BL/1000)+1.41)*10^-9;
+			double l[4] = {0.3574, 2.8249, -5.651, 3.726};                      // y = 3.726*x^3-5.651*x^2+2.8249*x+0.3574;
+			double h[5] = {0.9835, -0.0188, 0.0017, -0.00007, 0.0000008};      // y = 0.0000008*x^4-0.00007*x^3+0.0017*x^2-0.0188*x+0.9835;
+			copy(l, l+4, low); copy(h, h+5, high);
+		} else if (param->technode == 65) {
+			fitLatency = true;
+			coeffTmax[0] = 0.1239; coeffTmax[1] = 0.6642;                       // T_max = (0.1239*log(R_BL/1000)+0.6642)*10^-9;
+			double l[4] = {0.3202, 2.0483, -2.6913, 1.3899};                    // y = 1.3899*x^3-2.6913*x^2+2.0483*x+0.3202;
+			double h[5] = {1.0512, -0.0346, 0.1043, -0.0363, 0.0036};          // y = 0.0036*x^4-0.0363*x^3+0.1043*x^2-0.0346*x+1.0512;
+			copy(l, l+4, low); copy(h, h+5, high);
+		} else if (param->technode == 45 || param->technode == 32) {
+			fitLatency = true;
+			coeffTmax[0] = 0.0714; coeffTmax[1] = 0.7651;                       // T_max = (0.0714*log(R_BL/1000)+0.7651)*10^-9;
+			double l[4] = {0.4807, 2.6492, -5.6685, 3.7949};                    // y = 3.7949*x^3-5.6685*x^2+2.6492*x+0.4807
+			double h[5] = {1.0057, -0.0171, 0.0001, -0.00006, 0.000001};       // y = 0.000001*x^4-0.00006*x^3+0.0001*x^2-0.0171*x+1.0057;
+			copy(l, l+4, low); copy(h, h+5, high);
+		}                                                                       // technode below and equal to 22nm: 1ns per reference
+	}
+	copy(low, low+4, coeffLow);
+	copy(high, high+5, coeffHigh);
+	
+	if (param->deviceroadmap == 1) {  // HP
+		double power[9] = {19.898, 13.09, 9.9579, 7.7017, 3.9648, 1.8939, 1.2, 0.8, 0.5};
+		double energyA[9] = {0.207452, 0.164900, 0.128483, 0.097754, 0.083709, 0.084273, 0.060584, 0.049418, 0.040310};
+		double energyB[9] = {-2.367, -2.345, -2.321, -2.296, -2.313, -2.311, -2.311, -2.311, -2.311};
+		int n = TechnodeIndex(param->technode);
+		columnPower = power[n]*1e-6;
+		coeffEnergy[0] = energyA[n];
+		coeffEnergy[1] = energyB[n];
+	} else {                         // LP
+		double power[9] = {18.09, 12.612, 8.4147, 6.3162, 3.0875, 1.7, 1.0, 0.55, 0.35};
+		double energyA[9] = {0.169380, 0.144323, 0.121272, 0.100225, 0.079449, 0.072341, 0.061085, 0.051580, 0.043555};
+		double energyB[9] = {-2.303, -2.303, -2.303, -2.303, -2.297, -2.303, -2.303, -2.303, -2.303};
+		int n = TechnodeIndex(param->technode);
+		columnPower = power[n]*1e-6;
+		coeffEnergy[0] = energyA[n];
+		coeffEnergy[1] = energyB[n];
+	}
+	
+	// prefix sums of Rref^p over the ladder Rref[1 ... levelOutput-2], sumRref[p][i] = sum of Rref[j]^p for 1 <= j < i
+	sumRref.assign(5, vector<double>(MAX(levelOutput, 2), 0));
+	for (int p=0; p<5; p++) {
+		for (int i=1; i<levelOutput-1; i++) {
+			sumRref[p][i+1] = sumRref[p][i] + pow(Rref[i], p);
+		}
+	}
+	
+	// critical points of the fits (in ratio), the largest T over the ladder can only be next to these or at the end of a range
+	criticalRatio.clear();
+	if (fitLatency) {
+		for (int n=0; n<1000; n++) {
+			double x0 = 0.05 + (20-0.05)*n/1000.0;
+			double x1 = 0.05 + (20-0.05)*(n+1)/1000.0;
+			double d0 = FitSlope(x0);
+			double d1 = FitSlope(x1);
+			if (d0 == 0) {
+				criticalRatio.push_back(x0);
+			} else if ((d0 < 0) != (d1 < 0) && d1 != 0) {
+				for (int k=0; k<60; k++) {     // bisection
+					double xm = (x0+x1)/2;
+					if ((FitSlope(xm) < 0) == (d0 < 0)) {
+						x0 = xm;
+					} else {
+						x1 = xm;
+					}
+				}
+				criticalRatio.push_back((x0+x1)/2);
+			}
+		}
+	}
+	
+	// Initialize SenseAmp
+	currentSenseAmp.Initialize((levelOutput-1)*numCol, false, false, clkFreq, numReadCellPerOperationNeuro);        // use real-traced mode ... 
+	initialized = true;
+	}
+}
+
+void MultilevelSenseAmp::CalculateArea(double heightArray, double widthArray, AreaModify _option) {
+	if (!initialized) {
+		cout << "[MultilevelSenseAmp] Error: Require initialization first!" << endl;
+	} else {
+		
+		area = 0;
+		height = 0;
+		width = 0;
+		
+		double hNmos, wNmos, hPmos, wPmos;
+		CalculateGateArea(INV, 1, widthNmos, 0, tech.featureSize*MAX_TRANSISTOR_HEIGHT, tech, &hNmos, &wNmos);
+		CalculateGateArea(INV, 1, 0, widthPmos, tech.featureSize*MAX_TRANSISTOR_HEIGHT, tech, &hPmos, &wPmos);
+		
+		if (widthArray && _option==NONE) {
+			currentSenseAmp.CalculateUnitArea();
+			currentSenseAmp.CalculateArea(widthArray);
+			area = currentSenseAmp.area;
+			area += ((hNmos*wNmos)*9 + (hPmos*wPmos)*9)*(levelOutput-1)*numCol;
+			width = widthArray;
+			height = area / width;
+		} else if (heightArray && _option==NONE) {
+			currentSenseAmp.CalculateUnitArea();
+			currentSenseAmp.CalculateArea(heightArray);
+			area = currentSenseAmp.area;
+			area += ((hNmos*wNmos)*9 + (hPmos*wPmos)*9)*(levelOutput-1)*numCol;
+			height = heightArray;
+			width = area / height;
+		} else {
+			cout << "[MultilevelSenseAmp] Error: No width or height assigned for the multiSenseAmp circuit" << endl;
+			exit(-1);
+		}
+		// Assume the Current Mirrors are on the same row and the total width of them is smaller than the adder or DFF
+		
+		// Modify layout
+		newHeight = heightArray;
+		newWidth = widthArray;
+		switch (_option) {
+			case MAGIC:
+				MagicLayout();
+				break;
+			case OVERRIDE:
+				OverrideLayout();
+				break;  
+			default:    // NONE
+				break;
+		}
+
+	}
+}
+
+void MultilevelSenseAmp::CalculateLatency(const vector<double> &columnResistance, double numColMuxed, double numRead) {
+	if (!initialized) {
+		cout << "[MultilevelSenseAmp] Error: Require initialization first!" << endl;
+	} else {
+		readLatency = 0;
+		double LatencyCol = 0;
+		for (double j=0; j<columnResistance.size(); j++){
+			double T_Col = 0;
+			T_Col = GetColumnLatency(columnResistance[j]);
+			if (columnResistance[j] == columnResistance[j]) {
+				LatencyCol = max(LatencyCol, T_Col);
+			} else {
+				LatencyCol = LatencyCol;
+			}
+			if (LatencyCol < 1e-9) {
+				LatencyCol = 1e-9;
+			} else if (LatencyCol > 10e-9) {
+				LatencyCol = 10e-9;
+			}
+		}
+		readLatency += LatencyCol*numColMuxed;
+		readLatency *= numRead;
+	}
+}
+
+void MultilevelSenseAmp::CalculatePower(const vector<double> &columnResistance, double numRead) {
+	if (!initialized) {
+		cout << "[MultilevelSenseAmp] Error: Require initialization first!" << endl;
+	} else {
+		leakage = 0;
+		readDynamicEnergy = 0;
+		for (double i=0; i<columnResistance.size(); i++) {
+			double E_Col = 0;
+			E_Col = GetColumnPower(columnResistance[i]);
+			if (columnResistance[i] == columnResistance[i]) {
+				readDynamicEnergy += E_Col;
+			} else {
+				readDynamicEnergy += 0;
+			}
+		}
+		readDynamicEnergy *= numRead;
+	}
+} 
+
+void MultilevelSenseAmp::PrintProperty(const char* str) {
+	FunctionUnit::PrintProperty(str);
+}
+
+
+double MultilevelSenseAmp::GetColumnLatency(double columnRes) {
+	if (((double) 1/columnRes == 0) || (columnRes == 0)) {
+		return 0;
+	}
+	if (!fitLatency) {
+		return 1e-9;
+	}
+	
+	// Rref[1 ... levelOutput-2] is ascending, so is the ratio Rref[i]/columnRes: the fits split the ladder into at most 4 ranges
+	// [1, a): ratio <= 0.05, [a, b): cubic fit, [b, c): quartic fit, [c, levelOutput-1): ratio >= 20
+	int a, b, c;
+	GetLadderRange(columnRes, &a, &b, &c);
+	double T_max = (coeffTmax[0]*log(columnRes/1000)+coeffTmax[1])*1e-9;
+	
+	// the largest T over the ladder is at the end of a range or next to a critical point of the fit
+	double Column_Latency = 0;
+	if (a > 1 || c < levelOutput-1) {
+		Column_Latency = 1e-9;
+	}
+	// candidates are evaluated in place, this runs for every column of every read
+	Column_Latency = max(Column_Latency, GetLadderLatency(columnRes, T_max, a, a, b, c));
+	Column_Latency = max(Column_Latency, GetLadderLatency(columnRes, T_max, b-1, a, b, c));
+	Column_Latency = max(Column_Latency, GetLadderLatency(columnRes, T_max, b, a, b, c));
+	Column_Latency = max(Column_Latency, GetLadderLatency(columnRes, T_max, c-1, a, b, c));
+	for (int n=0; n<criticalRatio.size(); n++) {
+		int j = LadderUpperBound(columnRes, criticalRatio[n], false);
+		Column_Latency = max(Column_Latency, GetLadderLatency(columnRes, T_max, j-1, a, b, c));
+		Column_Latency = max(Column_Latency, GetLadderLatency(columnRes, T_max, j, a, b, c));
+	}
+	return Column_Latency;
+}
+
+
+
+double MultilevelSenseAmp::GetLadderLatency(double columnRes, double T_max, int i, int a, int b, int c) {
+	// latency of reference i of the ladder, 0 outside the fitted ranges [a, c)
+	if (i < a || i >= c) {
+		return 0;
+	}
+	double ratio = Rref[i]/columnRes;
+	if (i < b) {
+		return T_max * (coeffLow[3]*pow(ratio,3)+coeffLow[2]*pow(ratio,2)+coeffLow[1]*ratio+coeffLow[0]);
+	} else {
+		return T_max * (coeffHigh[4]*pow(ratio,4)+coeffHigh[3]*pow(ratio,3)+coeffHigh[2]*pow(ratio,2)+coeffHigh[1]*ratio+coeffHigh[0]);
+	}
+}
+
+
+
+double MultilevelSenseAmp::GetColumnPower(double columnRes) {
+	double Column_Power = columnPower;
+	double Column_Energy = 0;
+
+	if ((double) 1/columnRes == 0) { 
+		Column_Power = 1e-6;
+	} else if (columnRes == 0) {
+		Column_Power = 0;
+	}
+	
+	if (((double) 1/columnRes == 0) || (columnRes == 0)) {
+		Column_Energy += 0;
+	} else if (!fitLatency) {
+		Column_Energy = Column_Power*1e-9*(levelOutput-1);
+	} else {
+		// sum of T over the ladder: the polynomial fits are summed with the prefix sums of Rref^p
+		int a, b, c;
+		GetLadderRange(columnRes, &a, &b, &c);
+		double T_max = (coeffTmax[0]*log(columnRes/1000)+coeffTmax[1])*1e-9;
+		double sumLow = 0, sumHigh = 0;
+		for (int p=4; p>=0; p--) {
+			if (p < 4) {
+				sumLow = sumLow/columnRes + coeffLow[p]*(sumRref[p][b]-sumRref[p][a]);
+			}
+			sumHigh = sumHigh/columnRes + coeffHigh[p]*(sumRref[p][c]-sumRref[p][b]);
+		}
+		double numClamped = (a-1) + (levelOutput-1-c);
+		Column_Energy = Column_Power*(1e-9*numClamped + T_max*(sumLow+sumHigh));
+	}
+	Column_Energy += coeffEnergy[0]*exp(coeffEnergy[1]*log10(columnRes))*1e-9;
+	return Column_Energy;
+}
+
+
+int MultilevelSenseAmp::TechnodeIndex(int technode) {
+	// 130, 90, 65, 45, 32, 22, 14, 10, 7nm
+	if (technode == 130) {
+		return 0;
+	} else if (technode == 90) {
+		return 1;
+	} else if (technode == 65) {
+		return 2;
+	} else if (technode == 45) {
+		return 3;
+	} else if (technode == 32) {
+		return 4;
+	} else if (technode == 22) {
+		return 5;
+	} else if (technode == 14) {
+		return 6;
+	} else if (technode == 10) {
+		return 7;
+	} else {
+		return 8;
+	}
+}
+
+
+double MultilevelSenseAmp::FitSlope(double ratio) {
+	// derivative of the latency fit (cubic below 0.9, quartic above)
+	if (ratio <= 0.9) {
+		return 3*coeffLow[3]*ratio*ratio + 2*coeffLow[2]*ratio + coeffLow[1];
+	} else {
+		return 4*coeffHigh[4]*ratio*ratio*ratio + 3*coeffHigh[3]*ratio*ratio + 2*coeffHigh[2]*ratio + coeffHigh[1];
+	}
+}
+
+
+void MultilevelSenseAmp::GetLadderRange(double columnRes, int *a, int *b, int *c) {
+	*a = LadderUpperBound(columnRes, 0.05, false);
+	*b = MAX(LadderUpperBound(columnRes, 0.9, false), *a);
+	*c = MAX(LadderUpperBound(columnRes, 20, true), *b);
+}
+
+
+int MultilevelSenseAmp::LadderUpperBound(double columnRes, double bound, bool inclusive) {
+	// first i in [1, levelOutput-2] with Rref[i]/columnRes > bound (>= bound if inclusive), levelOutput-1 if none
+	int low = 1, high = levelOutput-1;
+	while (low < high) {
+		int mid = (low+high)/2;
+		double ratio = Rref[mid]/columnRes;
+		if (ratio > bound || (inclusive && ratio == bound)) {
+			high = mid;
+		} else {
+			low = mid+1;
+		}
+	}
+	return low;
+}
@@ -1,87 +1,103 @@
-/*******************************************************************************
-* Copyright (c) 2015-2017
-* School of Electrical, Computer and Energy Engineering, Arizona State University
-* PI: Prof. Shimeng Yu
-* All rights reserved.
-* 
-* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
-* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
-* Copyright of the model is maintained by the developers, and the model is distributed under 
-* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
-* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
-* The source code is free and you can redistribute and/or modify it
-* by providing that the following conditions are met:
-* 
-*  1) Redistributions of source code must retain the above copyright notice,
-*     this list of conditions and the following disclaimer.
-* 
-*  2) Redistributions in binary form must reproduce the above copyright notice,
-*     this list of conditions and the following disclaimer in the documentation
-*     and/or other materials provided with the distribution.
-* 
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-* 
-* Developer list: 
-*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
-*                    
-*   Xiaochen Peng   Email: xpeng15 at asu dot edu
-********************************************************************************/
-
-#ifndef MULTILEVELSENSEAMP_H_
-#define MULTILEVELSENSEAMP_H_
-
-#include <vector>
-#include "typedef.h"
-#include "InputParameter.h"
-#include "Technology.h"
-#include "MemCell.h"
-#include "FunctionUnit.h"
-#include "CurrentSenseAmp.h"
-
-using namespace std;
-
-class MultilevelSenseAmp: public FunctionUnit {
-public:
-	MultilevelSenseAmp(const InputParameter& _inputParameter, const Technology& _tech, const MemCell& _cell);
-	virtual ~MultilevelSenseAmp() {}
-	const InputParameter& inputParameter;
-	const Technology& tech;
-	const MemCell& cell;
-
-	/* Functions */
-	void PrintProperty(const char* str);
-	void Initialize(int _numCol, int _levelOutput, double _clkFreq, int _numReadCellPerOperationNeuro, bool _parallel);
-	void CalculateArea(double heightArray, double widthArray, AreaModify _option);
-	void CalculateLatency(const vector<double> &columnResistance, double numColMuxed, double numRead);
-	void CalculatePower(const vector<double> &columnResistance, double numRead);
-	double GetColumnLatency(double columnRes);
-	double GetColumnPower(double columnRes);
-
-	/* Properties */
-	bool initialized;		/* Initialization flag */
-	int numCol;				/* Number of columns */
-	
-    int levelOutput;
-	
-	bool FPGA;
-	bool parallel;
-	bool neuro;
-	double clkFreq;
-	int numReadCellPerOperationNeuro;
-	vector<double> Rref;
-
-	CurrentSenseAmp currentSenseAmp;
-};
-
-#endif /* MULTILEVELSENSEAMP_H_ */
-
-
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#ifndef MULTILEVELSENSEAMP_H_
+#define MULTILEVELSENSEAMP_H_
+
+#include <vector>
+#include "typedef.h"
+#include "InputParameter.h"
+#include "Technology.h"
+#include "MemCell.h"
+#include "FunctionUnit.h"
+#include "CurrentSenseAmp.h"
+
+using namespace std;
+
+class MultilevelSenseAmp: public FunctionUnit {
+public:
+	MultilevelSenseAmp(const InputParameter& _inputParameter, const Technology& _tech, const MemCell& _cell);
+	virtual ~MultilevelSenseAmp() {}
+	const InputParameter& inputParameter;
+	const Technology& tech;
+	const MemCell& cell;
+
+	/* Functions */
+	void PrintProperty(const char* str);
+	void Initialize(int _numCol, int _levelOutput, double _clkFreq, int _numReadCellPerOperationNeuro, bool _parallel);
+	void CalculateArea(double heightArray, double widthArray, AreaModify _option);
+	void CalculateLatency(const vector<double> &columnResistance, double numColMuxed, double numRead);
+	void CalculatePower(const vector<double> &columnResistance, double numRead);
+	double GetColumnLatency(double columnRes);
+	double GetLadderLatency(double columnRes, double T_max, int i, int a, int b, int c);
+	double GetColumnPower(double columnRes);
+	void GetLadderRange(double columnRes, int *a, int *b, int *c);
+	int LadderUpperBound(double columnRes, double bound, bool inclusive);
+	int TechnodeIndex(int technode);
+	double FitSlope(double ratio);
+
+	/* Properties */
+	bool initialized;		/* Initialization flag */
+	int numCol;				/* Number of columns */
+	
+    int levelOutput;
+	
+	bool FPGA;
+	bool parallel;
+	bool neuro;
+	double clkFreq;
+	int numReadCellPerOperationNeuro;
+	vector<double> Rref;
+	double widthNmos, widthPmos;
+	
+	/* technology-specific fits, resolved in Initialize */
+	bool fitLatency;                  // true: LP 32nm and above, latency of each reference depends on Rref/columnRes; false: 1ns per reference
+	double coeffTmax[2];              // T_max = (coeffTmax[0]*log(R_BL/1000)+coeffTmax[1])*1e-9
+	double coeffLow[4];               // latency fit for Rref/columnRes <= 0.9, coeffLow[p]*x^p
+	double coeffHigh[5];              // latency fit for Rref/columnRes > 0.9, coeffHigh[p]*x^p
+	double columnPower;
+	double coeffEnergy[2];            // Column_Energy += coeffEnergy[0]*exp(coeffEnergy[1]*log10(R_BL))*1e-9
+	vector<vector<double> > sumRref;  // prefix sums of Rref^p, p = 0 ... 4
+	vector<double> criticalRatio;     // critical points of the latency fits
+
+	CurrentSenseAmp currentSenseAmp;
+};
+
+#endif /* MULTILEVELSENSEAMP_H_ */
+
+
@@ -1,213 +1,297 @@
-/*******************************************************************************
-* Copyright (c) 2015-2017
-* School of Electrical, Computer and Energy Engineering, Arizona State University
-* PI: Prof. Shimeng Yu
-* All rights reserved.
-*   
-* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
-* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
-* Copyright of the model is maintained by the developers, and the model is distributed under 
-* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
-* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
-* The source code is free and you can redistribute and/or modify it
-* by providing that the following conditions are met:
-*   
-*  1) Redistributions of source code must retain the above copyright notice,
-*     this list of conditions and the following disclaimer. 
-*   
-*  2) Redistributions in binary form must reproduce the above copyright notice,
-*     this list of conditions and the following disclaimer in the documentation
-*     and/or other materials provided with the distribution.
-*   
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-* 
-* Developer list: 
-*   Pai-Yu Chen     Email: pchen72 at asu dot edu 
-*                     
-*   Xiaochen Peng   Email: xpeng15 at asu dot edu
-********************************************************************************/
-
-#include <cmath>
-#include <iostream>
-#include <fstream>
-#include <string>
-#include <stdlib.h>
-#include <vector>
-#include <sstream>
-#include "math.h"
-#include "Param.h"
-
-Param::Param() {
-	/***************************************** user defined design options and parameters *****************************************/
-	operationmode = 2;     		// 1: conventionalSequential (Use several multi-bit RRAM as one synapse)
-								// 2: conventionalParallel (Use several multi-bit RRAM as one synapse)
-	
-	memcelltype = 2;        	// 1: cell.memCellType = Type::SRAM
-								// 2: cell.memCellType = Type::RRAM
-								// 3: cell.memCellType = Type::FeFET
-	
-	accesstype = 1;         	// 1: cell.accessType = CMOS_access
-								// 2: cell.accessType = BJT_access
-								// 3: cell.accessType = diode_access
-								// 4: cell.accessType = none_access (Crossbar Array)
-	
-	transistortype = 1;     	// 1: inputParameter.transistorType = conventional
-								// 2: inputParameter.transistorType = FET_2D
-								// 3: inputParameter.transistorType = TFET
-	
-	deviceroadmap = 2;      	// 1: inputParameter.deviceRoadmap = HP
-								// 2: inputParameter.deviceRoadmap = LSTP
-								
-	globalBufferType = false;    // false: register file
-								// true: SRAM
-								
-	tileBufferType = false;      // false: register file
-								// true: SRAM
-								
-	peBufferType = false;        // false: register file
-								// true: SRAM
-	
-	chipActivation = true;      // false: activation (reLu/sigmoid) inside Tile
-								// true: activation outside Tile
-								
-	reLu = true;                // false: sigmoid
-								// true: reLu
-								
-	novelMapping = true;        // false: conventional mapping
-								// true: novel mapping
-	
-	/*** algorithm weight range, the default wrapper (based on WAGE) has fixed weight range of (-1, 1) ***/
-	algoWeightMax = 1;
-	algoWeightMin = -1;
-	
-	/*** conventional hardware design options ***/
-	clkFreq = 1e9;                      // Clock frequency
-	featuresize = 40e-9;                // Wire width for subArray simulation
-	temp = 301;                         // Temperature (K)
-	technode = 32;                      // Technology
-	wireWidth = 40;                     // wireWidth of the cell for Accuracy calculation
-	globalBusDelayTolerance = 0.1;      // to relax bus delay for global H-Tree (chip level: communication among tiles), if tolerance is 0.1, the latency will be relax to (1+0.1)*optimalLatency (trade-off with energy)
-	localBusDelayTolerance = 0.1;       // to relax bus delay for global H-Tree (tile level: communication among PEs), if tolerance is 0.1, the latency will be relax to (1+0.1)*optimalLatency (trade-off with energy)
-	treeFoldedRatio = 4;                // the H-Tree is assumed to be able to folding in layout (save area)
-	maxGlobalBusWidth = 2048;           // the max buswidth allowed on chip level (just a upper_bound, the actual bus width is defined according to the auto floorplan)
-
-	numRowSubArray = 128;               // # of rows in single subArray
-	numColSubArray = 128;               // # of columns in single subArray
-	
-	/*** option to relax subArray layout ***/
-	relaxArrayCellHeight = 0;           // relax ArrayCellHeight or not
-	relaxArrayCellWidth = 0;            // relax ArrayCellWidth or not
-	
-	numColMuxed = 8;                    // How many columns share 1 ADC (for eNVM and FeFET) or parallel SRAM
-	levelOutput = 32;                   // # of levels of the multilevelSenseAmp output, should be in 2^N forms; e.g. 32 levels --> 5-bit ADC
-	cellBit = 4;                        // precision of memory device 
-	
-	/*** parameters for SRAM ***/
-	heightInFeatureSizeSRAM = 8;        // SRAM Cell height in feature size
-	widthInFeatureSizeSRAM = 20;        // SRAM Cell width in feature size
-	widthSRAMCellNMOS = 2.08;                              
-	widthSRAMCellPMOS = 1.23;
-	widthAccessCMOS = 1.31;
-	minSenseVoltage = 0.1;
-	
-	/*** parameters for analog synaptic devices ***/
-	heightInFeatureSize1T1R = 4;        // 1T1R Cell height in feature size
-	widthInFeatureSize1T1R = 4;         // 1T1R Cell width in feature size
-	heightInFeatureSizeCrossbar = 2;    // Crossbar Cell height in feature size
-	widthInFeatureSizeCrossbar = 2;     // Crossbar Cell width in feature size
-	
-	resistanceOn = 100e3;               // Ron resistance at Vr in the reported measurement data (need to recalculate below if considering the nonlinearity)
-	resistanceOff = 100e3*10;           // Roff resistance at Vr in the reported measurement dat (need to recalculate below if considering the nonlinearity)
-	maxConductance = (double) 1/resistanceOn;
-	minConductance = (double) 1/resistanceOff;
-	
-	readVoltage = 0.5;	                // On-chip read voltage for memory cell
-	readPulseWidth = 10e-9;             // read pulse width in sec
-	accessVoltage = 1.1;                // Gate voltage for the transistor in 1T1R
-	resistanceAccess = 15e3;            // resistance of access CMOS in 1T1R
-	
-	/***************************************** user defined design options and parameters *****************************************/
-	
-	
-	
-	/***************************************** Initialization of parameters NO need to modify *****************************************/
-	
-	if (memcelltype == 1) {
-		cellBit = 1;             // force cellBit = 1 for all SRAM cases
-	} 
-	
-
-	/*** initialize operationMode as default ***/
-	conventionalParallel = 0;
-	conventionalSequential = 0;
-	BNNparallelMode = 0;                // parallel BNN
-	BNNsequentialMode = 0;              // sequential BNN
-	XNORparallelMode = 0;           	// parallel XNOR
-	XNORsequentialMode = 0;         	// sequential XNOR
-	switch(operationmode) {
-		case 6:	    XNORparallelMode = 1;               break;     
-		case 5:	    XNORsequentialMode = 1;             break;     
-		case 4:	    BNNparallelMode = 1;                break;     
-		case 3:	    BNNsequentialMode = 1;              break;    
-		case 2:	    conventionalParallel = 1;           break;     
-		case 1:	    conventionalSequential = 1;         break;    
-		case -1:	break;
-		default:	exit(-1);
-	}
-	
-	
-	/*** parallel read ***/
-	parallelRead = 0;
-	if(conventionalParallel || BNNparallelMode || XNORparallelMode) {
-		parallelRead = 1;
-	} else {
-		parallelRead = 0;
-	}
-	
-	/*** Initialize interconnect wires ***/
-	switch(wireWidth) {
-		case 200: 	AR = 2.10; Rho = 2.42e-8; break;
-		case 100:	AR = 2.30; Rho = 2.73e-8; break;
-		case 50:	AR = 2.34; Rho = 3.91e-8; break;
-		case 40:	AR = 1.90; Rho = 4.03e-8; break;
-		case 32:	AR = 1.90; Rho = 4.51e-8; break;
-		case 22:	AR = 2.00; Rho = 5.41e-8; break;
-		case 14:	AR = 2.10; Rho = 7.43e-8; break;
-		case -1:	break;	// Ignore wire resistance or user define
-		default:	exit(-1); puts("Wire width out of range"); 
-	}
-	
-	if (memcelltype == 1) {
-		wireLengthRow = wireWidth * 1e-9 * heightInFeatureSizeSRAM;
-		wireLengthCol = wireWidth * 1e-9 * widthInFeatureSizeSRAM;
-	} else {
-		if (accesstype == 1) {
-			wireLengthRow = wireWidth * 1e-9 * heightInFeatureSize1T1R;
-			wireLengthCol = wireWidth * 1e-9 * widthInFeatureSize1T1R;
-		} else {
-			wireLengthRow = wireWidth * 1e-9 * heightInFeatureSizeCrossbar;
-			wireLengthCol = wireWidth * 1e-9 * widthInFeatureSizeCrossbar;
-		}
-	}
-	
-	if (wireWidth == -1) {
-		unitLengthWireResistance = 1.0;	// Use a small number to prevent numerical error for NeuroSim
-		wireResistanceRow = 0;
-		wireResistanceCol = 0;
-	} else {
-		unitLengthWireResistance =  Rho / ( wireWidth*1e-9 * wireWidth*1e-9 * AR );
-		wireResistanceRow = unitLengthWireResistance * wireLengthRow;
-		wireResistanceCol = unitLengthWireResistance * wireLengthCol;
-	}
-	/***************************************** Initialization of parameters NO need to modify *****************************************/
-}
-
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+*   
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+*   
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer. 
+*   
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+*   
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen     Email: pchen72 at asu dot edu 
+*                     
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <stdlib.h>
+#include <vector>
+#include <sstream>
+#include "math.h"
+#include "Param.h"
+
+using namespace std;
+
+Param::Param() {
+	/***************************************** user defined design options and parameters *****************************************/
+	operationmode = 2;     		// 1: conventionalSequential (Use several multi-bit RRAM as one synapse)
+								// 2: conventionalParallel (Use several multi-bit RRAM as one synapse)
+	
+	memcelltype = 2;        	// 1: cell.memCellType = Type::SRAM
+								// 2: cell.memCellType = Type::RRAM
+								// 3: cell.memCellType = Type::FeFET
+	
+	accesstype = 1;         	// 1: cell.accessType = CMOS_access
+								// 2: cell.accessType = BJT_access
+								// 3: cell.accessType = diode_access
+								// 4: cell.accessType = none_access (Crossbar Array)
+	
+	transistortype = 1;     	// 1: inputParameter.transistorType = conventional
+								// 2: inputParameter.transistorType = FET_2D
+								// 3: inputParameter.transistorType = TFET
+	
+	deviceroadmap = 2;      	// 1: inputParameter.deviceRoadmap = HP
+								// 2: inputParameter.deviceRoadmap = LSTP
+								
+	globalBufferType = false;    // false: register file
+								// true: SRAM
+								
+	tileBufferType = false;      // false: register file
+								// true: SRAM
+								
+	peBufferType = false;        // false: register file
+								// true: SRAM
+	
+	chipActivation = true;      // false: activation (reLu/sigmoid) inside Tile
+								// true: activation outside Tile
+								
+	reLu = true;                // false: sigmoid
+								// true: reLu
+								
+	novelMapping = true;        // false: conventional mapping
+								// true: novel mapping
+	
+	groupPacking = true;        // false: a grouped/depthwise layer is mapped as its dense block-diagonal matrix
+								// true: the blocks of the groups are packed block-diagonally into subarrays (always conventional mapping)
+	
+	pipeline = false;           // false: layer-by-layer process only
+								// true: also report the pipelined process (layers on their own tiles work on consecutive images)
+	
+	batchSize = 1;              // # of images streamed through the pipeline
+	
+	optimizeDuplication = false; // true: duplicate the tiles of the bottleneck layers to balance the pipeline, within the budget below
+	maxNumTile = 0;              // tile budget of the whole chip for the duplication (0: no limit)
+	maxChipArea = 0;             // area budget of the whole chip for the duplication, in m^2 (0: no limit)
+								// both 0: each layer is duplicated up to one copy per input vector (output position)
+	minDuplicationGain = 0.01;   // stop once one more copy of the bottleneck tiles lowers the max stage latency by less than this (relative)
+	
+	multiChip = false;           // true: also partition the layers over several chips of at most maxAreaPerChip each (chips form a pipeline)
+	maxAreaPerChip = 0;          // area cap of each chip in m^2, every chip has its own global buffer, accumulation, activation and H-tree
+	linkBandwidth = 128e9;       // bit/s of the inter-chip link carrying the activations from one chip to the next
+	linkLatency = 50e-9;         // fixed latency of each transfer over the link (SerDes and flight time), in s
+	linkEnergyPerBit = 1.5e-12;  // J/bit over the link
+	weightStreaming = false;     // true: also model a smaller chip that streams the weights of every layer from off-chip DRAM and reprograms its arrays for each image
+	streamChipArea = 0;          // area of that chip in m^2, the same periphery as the all-resident chip plus fewer tiles (0: half the tile area of the all-resident chip)
+	dramBandwidth = 102.4e9;     // bit/s of the DRAM interface (e.g. one 32-bit LPDDR4-3200 channel)
+	dramLatency = 100e-9;        // access latency of each weight load from the DRAM, in s
+	dramEnergyPerBit = 20e-12;   // J/bit to read the weights from the DRAM and carry them to the chip
+	
+	numBufferStage = 1;          // # of copies of each PE/tile/global buffer: 1 is the serial process (load, compute, store one after another)
+								 // 2: double-buffered, the next input block is loaded (and the last one stored) while the current one is computed
+								 // 3 or more: load, compute and store all overlap, each extra copy adds its buffer area and leakage
+	
+	/*** sampling-based simulation, to speed up layers with a huge number of input vectors ***/
+	sampling = false;                   // false: simulate every input vector
+										// true: stratified sampling of the input vectors, latency and energy are extrapolated
+	samplingTargetError = 0.01;         // stop sampling once the relative half-width of the confidence interval (latency and energy) is below this
+	samplingConfidence = 0.95;          // confidence level of the reported interval
+	samplingMinVector = 64;             // subArrays with fewer input vectors are always fully simulated, also the size of the first sample
+	samplingSeed = 0;                   // seed of the sampling order, each subArray draws from its own stream seeded by (seed, layer, tile, PE, subArray)
+	
+	/*** Monte-Carlo device variation, applied to the conductance mapped into the arrays ***/
+	monteCarlo = false;                 // true: report the latency and energy distribution under device variation (sampling is not used for the variation trials)
+	numTrialMonteCarlo = 100;           // # of independent trials (each trial programs every array once), run in parallel
+	monteCarloSeed = 0;                 // seed of the trials, streams seeded by (seed, layer, tile, PE, subArray, trial): same result regardless of the # of threads and layer order
+	sigmaConductance = 0.1;             // device-to-device variation, sigma of the lognormal conductance
+	stuckAtOffRate = 0;                 // probability of a cell stuck at minConductance
+	stuckAtOnRate = 0;                  // probability of a cell stuck at maxConductance
+	
+	/*** per-instance latency and energy breakdown (Breakdown.h), also turned on by the --folded option ***/
+	breakdown = false;                  // true: every circuit instance reports into the breakdown tree (chip;layer;tile;pe;subArray;circuit)
+	
+	/*** self-profiling of the simulator run time (Profile.h), also turned on by the --profile option ***/
+	profile = false;                    // true: print the wall time and call count of each simulation phase
+	
+	/*** per-tile and per-PE latency, energy and utilization of each layer (Heatmap.h), also turned on by the --heatmap option ***/
+	heatmap = false;                    // true: keep the tile/PE values that are otherwise only combined into the layer totals
+	
+	/*** per-subArray activity counters (Activity.h), also turned on by the --activity option ***/
+	activity = false;                   // true: count the reads, all-zero input vectors, row activity histogram, ADC conversions and column conductance of every subArray
+	
+	/*** roofline analysis of each layer: compute vs. buffer vs. interconnect bound ***/
+	roofline = false;                   // true: also report the arithmetic intensity, the bandwidth and compute ceilings and the latency with data movement overlapped
+										// (splits the readLatency of the serial process, so meant for numBufferStage = 1)
+	
+	/*** gate characterization cache (formula.cpp), the hit rate is printed with --profile ***/
+	gateCache = true;                   // true: CalculateGateArea/CalculateGateCapacitance reuse the result of an earlier call with the same gate, widths, cell height and technology
+	
+	/*** algorithm weight range, the default wrapper (based on WAGE) has fixed weight range of (-1, 1) ***/
+	algoWeightMax = 1;
+	algoWeightMin = -1;
+	
+	/*** conventional hardware design options ***/
+	clkFreq = 1e9;                      // Clock frequency
+	featuresize = 40e-9;                // Wire width for subArray simulation
+	temp = 301;                         // Temperature (K)
+	technode = 32;                      // Technology
+	wireWidth = 40;                     // wireWidth of the cell for Accuracy calculation
+	globalBusDelayTolerance = 0.1;      // to relax bus delay for global H-Tree (chip level: communication among tiles), if tolerance is 0.1, the latency will be relax to (1+0.1)*optimalLatency (trade-off with energy)
+	localBusDelayTolerance = 0.1;       // to relax bus delay for global H-Tree (tile level: communication among PEs), if tolerance is 0.1, the latency will be relax to (1+0.1)*optimalLatency (trade-off with energy)
+	treeFoldedRatio = 4;                // the H-Tree is assumed to be able to folding in layout (save area)
+	maxGlobalBusWidth = 2048;           // the max buswidth allowed on chip level (just a upper_bound, the actual bus width is defined according to the auto floorplan)
+
+	numRowSubArray = 128;               // # of rows in single subArray
+	numColSubArray = 128;               // # of columns in single subArray
+	
+	/*** option to relax subArray layout ***/
+	relaxArrayCellHeight = 0;           // relax ArrayCellHeight or not
+	relaxArrayCellWidth = 0;            // relax ArrayCellWidth or not
+	
+	numColMuxed = 8;                    // How many columns share 1 ADC (for eNVM and FeFET) or parallel SRAM
+	levelOutput = 32;                   // # of levels of the multilevelSenseAmp output, should be in 2^N forms; e.g. 32 levels --> 5-bit ADC
+	numBitInput = 8;                    // precision of input neural activation (main takes it from the wrapper, then calls Initialize again)
+	numInputBitPerCycle = 1;            // # of input bits applied per read cycle by multi-level wordline drivers (1: bit-serial), each input takes ceil(numBitInput/numInputBitPerCycle) cycles
+									// (each row then drives 2^numInputBitPerCycle-1 levels: SubArray charges the wordline DACs that many times the latency and energy of the 1-bit drive, their area is not modeled)
+	cellBit = 4;                        // precision of memory device 
+	
+	/*** parameters for SRAM ***/
+	heightInFeatureSizeSRAM = 8;        // SRAM Cell height in feature size
+	widthInFeatureSizeSRAM = 20;        // SRAM Cell width in feature size
+	widthSRAMCellNMOS = 2.08;                              
+	widthSRAMCellPMOS = 1.23;
+	widthAccessCMOS = 1.31;
+	minSenseVoltage = 0.1;
+	
+	/*** parameters for analog synaptic devices ***/
+	heightInFeatureSize1T1R = 4;        // 1T1R Cell height in feature size
+	widthInFeatureSize1T1R = 4;         // 1T1R Cell width in feature size
+	heightInFeatureSizeCrossbar = 2;    // Crossbar Cell height in feature size
+	widthInFeatureSizeCrossbar = 2;     // Crossbar Cell width in feature size
+	
+	resistanceOn = 100e3;               // Ron resistance at Vr in the reported measurement data (need to recalculate below if considering the nonlinearity)
+	resistanceOff = 100e3*10;           // Roff resistance at Vr in the reported measurement dat (need to recalculate below if considering the nonlinearity)
+	maxConductance = (double) 1/resistanceOn;
+	minConductance = (double) 1/resistanceOff;
+	
+	readVoltage = 0.5;	                // On-chip read voltage for memory cell
+	readPulseWidth = 10e-9;             // read pulse width in sec
+	writeVoltage = 2;                   // On-chip write voltage for memory cell
+	writePulseWidth = 10e-9;            // write pulse width in sec
+	numWritePulse = 1;                  // average # of write pulses to program a cell (only used to reprogram arrays at run time)
+	accessVoltage = 1.1;                // Gate voltage for the transistor in 1T1R
+	resistanceAccess = 15e3;            // resistance of access CMOS in 1T1R
+	
+	/***************************************** user defined design options and parameters *****************************************/
+	
+	Initialize();
+}
+
+
+void Param::Initialize() {
+	// parameters derived from the options above, call again after changing operationmode/memcelltype/accesstype/wireWidth/numBitInput/numInputBitPerCycle on a fresh Param
+	
+	/***************************************** Initialization of parameters NO need to modify *****************************************/
+	
+	if (memcelltype == 1) {
+		cellBit = 1;             // force cellBit = 1 for all SRAM cases
+	} 
+	
+
+	/*** initialize operationMode as default ***/
+	conventionalParallel = 0;
+	conventionalSequential = 0;
+	BNNparallelMode = 0;                // parallel BNN
+	BNNsequentialMode = 0;              // sequential BNN
+	XNORparallelMode = 0;           	// parallel XNOR
+	XNORsequentialMode = 0;         	// sequential XNOR
+	switch(operationmode) {
+		case 6:	    XNORparallelMode = 1;               break;     
+		case 5:	    XNORsequentialMode = 1;             break;     
+		case 4:	    BNNparallelMode = 1;                break;     
+		case 3:	    BNNsequentialMode = 1;              break;    
+		case 2:	    conventionalParallel = 1;           break;     
+		case 1:	    conventionalSequential = 1;         break;    
+		case -1:	break;
+		default:	exit(-1);
+	}
+	
+	
+	/*** input cycles ***/
+	if (numInputBitPerCycle > numBitInput) {
+		cout << "ERROR!: More input bits per cycle than input precision, please modify 'numInputBitPerCycle' in Param.cpp!" << endl;
+		numInputBitPerCycle = numBitInput;
+	}
+	numInputCycle = ceil((double)numBitInput/(double)numInputBitPerCycle);
+	
+	/*** parallel read ***/
+	parallelRead = 0;
+	if(conventionalParallel || BNNparallelMode || XNORparallelMode) {
+		parallelRead = 1;
+	} else {
+		parallelRead = 0;
+	}
+	
+	/*** Initialize interconnect wires ***/
+	switch(wireWidth) {
+		case 200: 	AR = 2.10; Rho = 2.42e-8; break;
+		case 100:	AR = 2.30; Rho = 2.73e-8; break;
+		case 50:	AR = 2.34; Rho = 3.91e-8; break;
+		case 40:	AR = 1.90; Rho = 4.03e-8; break;
+		case 32:	AR = 1.90; Rho = 4.51e-8; break;
+		case 22:	AR = 2.00; Rho = 5.41e-8; break;
+		case 14:	AR = 2.10; Rho = 7.43e-8; break;
+		case -1:	break;	// Ignore wire resistance or user define
+		default:	exit(-1); puts("Wire width out of range"); 
+	}
+	
+	if (memcelltype == 1) {
+		wireLengthRow = wireWidth * 1e-9 * heightInFeatureSizeSRAM;
+		wireLengthCol = wireWidth * 1e-9 * widthInFeatureSizeSRAM;
+	} else {
+		if (accesstype == 1) {
+			wireLengthRow = wireWidth * 1e-9 * heightInFeatureSize1T1R;
+			wireLengthCol = wireWidth * 1e-9 * widthInFeatureSize1T1R;
+		} else {
+			wireLengthRow = wireWidth * 1e-9 * heightInFeatureSizeCrossbar;
+			wireLengthCol = wireWidth * 1e-9 * widthInFeatureSizeCrossbar;
+		}
+	}
+	
+	if (wireWidth == -1) {
+		unitLengthWireResistance = 1.0;	// Use a small number to prevent numerical error for NeuroSim
+		wireResistanceRow = 0;
+		wireResistanceCol = 0;
+	} else {
+		unitLengthWireResistance =  Rho / ( wireWidth*1e-9 * wireWidth*1e-9 * AR );
+		wireResistanceRow = unitLengthWireResistance * wireLengthRow;
+		wireResistanceCol = unitLengthWireResistance * wireLengthCol;
+	}
+	/***************************************** Initialization of parameters NO need to modify *****************************************/
+}
+
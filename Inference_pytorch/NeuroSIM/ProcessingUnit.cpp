@@ -1,585 +1,801 @@
-/*******************************************************************************
-* Copyright (c) 2015-2017
-* School of Electrical, Computer and Energy Engineering, Arizona State University
-* PI: Prof. Shimeng Yu
-* All rights reserved.
-* 
-* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
-* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
-* Copyright of the model is maintained by the developers, and the model is distributed under 
-* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
-* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
-* The source code is free and you can redistribute and/or modify it
-* by providing that the following conditions are met:
-* 
-*  1) Redistributions of source code must retain the above copyright notice,
-*     this list of conditions and the following disclaimer.
-* 
-*  2) Redistributions in binary form must reproduce the above copyright notice,
-*     this list of conditions and the following disclaimer in the documentation
-*     and/or other materials provided with the distribution.
-* 
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-* 
-* Developer list: 
-*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
-*                    
-*   Xiaochen Peng   Email: xpeng15 at asu dot edu
-********************************************************************************/
-
-#include <cmath>
-#include <iostream>
-#include <fstream>
-#include <string>
-#include <stdlib.h>
-#include <vector>
-#include <sstream>
-#include "Bus.h"
-#include "SubArray.h"
-#include "constant.h"
-#include "formula.h"
-#include "ProcessingUnit.h"
-#include "Param.h"
-#include "AdderTree.h"
-#include "Bus.h"
-#include "DFF.h"
-
-using namespace std;
-
-extern Param *param;
-
-AdderTree *adderTree;
-Bus *busInput;
-Bus *busOutput;
-DFF *bufferInput;
-DFF *bufferOutput;
-
-void ProcessingUnitInitialize(SubArray *& subArray, InputParameter& inputParameter, Technology& tech, MemCell& cell, int _numSubArrayRow, int _numSubArrayCol) {
-
-	/*** circuit level parameters ***/
-	switch(param->memcelltype) {
-		case 3:     cell.memCellType = Type::FeFET; break;
-		case 2:	    cell.memCellType = Type::RRAM; break;
-		case 1:	    cell.memCellType = Type::SRAM; break;
-		case -1:	break;
-		default:	exit(-1);
-	}
-	switch(param->accesstype) {
-		case 4:	    cell.accessType = none_access;  break;
-		case 3:	    cell.accessType = diode_access; break;
-		case 2:	    cell.accessType = BJT_access;   break;
-		case 1:	    cell.accessType = CMOS_access;  break;
-		case -1:	break;
-		default:	exit(-1);
-	}				
-					
-	switch(param->transistortype) {
-		case 3:	    inputParameter.transistorType = TFET;          break;
-		case 2:	    inputParameter.transistorType = FET_2D;        break;
-		case 1:	    inputParameter.transistorType = conventional;  break;
-		case -1:	break;
-		default:	exit(-1);
-	}
-	
-	switch(param->deviceroadmap) {
-		case 2:	    inputParameter.deviceRoadmap = LSTP;  break;
-		case 1:	    inputParameter.deviceRoadmap = HP;    break;
-		case -1:	break;
-		default:	exit(-1);
-	}
-	
-	subArray = new SubArray(inputParameter, tech, cell);
-	adderTree = new AdderTree(inputParameter, tech, cell);
-	busInput = new Bus(inputParameter, tech, cell);
-	busOutput = new Bus(inputParameter, tech, cell);
-	bufferInput = new DFF(inputParameter, tech, cell);
-	bufferOutput = new DFF(inputParameter, tech, cell);
-		
-	/* Create SubArray object and link the required global objects (not initialization) */
-	inputParameter.temperature = param->temp;   // Temperature (K)
-	inputParameter.processNode = param->technode;    // Technology node
-	tech.Initialize(inputParameter.processNode, inputParameter.deviceRoadmap, inputParameter.transistorType);
-	
-	cell.resistanceOn = param->resistanceOn;	                                // Ron resistance at Vr in the reported measurement data (need to recalculate below if considering the nonlinearity)
-	cell.resistanceOff = param->resistanceOff;	                                // Roff resistance at Vr in the reported measurement dat (need to recalculate below if considering the nonlinearity)
-	cell.resistanceAvg = (cell.resistanceOn + cell.resistanceOff)/2;            // Average resistance (for energy estimation)
-	cell.readVoltage = param->readVoltage;	                                    // On-chip read voltage for memory cell
-	cell.readPulseWidth = param->readPulseWidth;
-	cell.accessVoltage = param->accessVoltage;                                       // Gate voltage for the transistor in 1T1R
-	cell.resistanceAccess = param->resistanceAccess;
-	cell.featureSize = param->featuresize; 
-
-	if (cell.memCellType == Type::SRAM) {   // SRAM
-		cell.heightInFeatureSize = param->heightInFeatureSizeSRAM;                   // Cell height in feature size
-		cell.widthInFeatureSize = param->widthInFeatureSizeSRAM;                     // Cell width in feature size
-		cell.widthSRAMCellNMOS = param->widthSRAMCellNMOS;
-		cell.widthSRAMCellPMOS = param->widthSRAMCellPMOS;
-		cell.widthAccessCMOS = param->widthAccessCMOS;
-		cell.minSenseVoltage = param->minSenseVoltage;
-	} else {
-		cell.heightInFeatureSize = (cell.accessType==CMOS_access)? param->heightInFeatureSize1T1R : param->heightInFeatureSizeCrossbar;         // Cell height in feature size
-		cell.widthInFeatureSize = (cell.accessType==CMOS_access)? param->widthInFeatureSize1T1R : param->widthInFeatureSizeCrossbar;            // Cell width in feature size
-	}
-
-	subArray->XNORparallelMode = param->XNORparallelMode;               
-	subArray->XNORsequentialMode = param->XNORsequentialMode;             
-	subArray->BNNparallelMode = param->BNNparallelMode;                
-	subArray->BNNsequentialMode = param->BNNsequentialMode;              
-	subArray->conventionalParallel = param->conventionalParallel;                  
-	subArray->conventionalSequential = param->conventionalSequential;                 
-	subArray->numRow = param->numRowSubArray;
-	subArray->numCol = param->numRowSubArray;
-	subArray->levelOutput = param->levelOutput;
-	subArray->numColMuxed = param->numColMuxed;               // How many columns share 1 read circuit (for neuro mode with analog RRAM) or 1 S/A (for memory mode or neuro mode with digital RRAM)
-    subArray->clkFreq = param->clkFreq;                       // Clock frequency
-	subArray->relaxArrayCellHeight = param->relaxArrayCellHeight;
-	subArray->relaxArrayCellWidth = param->relaxArrayCellWidth;
-	subArray->numReadPulse = param->numBitInput;
-	subArray->avgWeightBit = param->cellBit;
-	subArray->numCellPerSynapse = param->numColPerSynapse;
-	
-	int numRow = param->numRowSubArray;
-	int numCol = param->numColSubArray;
-	
-	if (subArray->numColMuxed > numCol) {                      // Set the upperbound of numColMuxed
-		subArray->numColMuxed = numCol;
-	}
-
-	subArray->numReadCellPerOperationFPGA = numCol;	           // Not relevant for IMEC
-	subArray->numWriteCellPerOperationFPGA = numCol;	       // Not relevant for IMEC
-	subArray->numReadCellPerOperationMemory = numCol;          // Define # of SRAM read cells in memory mode because SRAM does not have S/A sharing (not relevant for IMEC)
-	subArray->numWriteCellPerOperationMemory = numCol/8;       // # of write cells per operation in SRAM memory or the memory mode of multifunctional memory (not relevant for IMEC)
-	subArray->numReadCellPerOperationNeuro = numCol;           // # of SRAM read cells in neuromorphic mode
-	subArray->numWriteCellPerOperationNeuro = numCol;	       // For SRAM or analog RRAM in neuro mode
-    subArray->maxNumWritePulse = MAX(cell.maxNumLevelLTP, cell.maxNumLevelLTD);
-
-	int numSubArrayRow = _numSubArrayRow;
-	int numSubArrayCol = _numSubArrayCol;
-
-	/*** initialize modules ***/
-	subArray->Initialize(numRow, numCol, param->unitLengthWireResistance);        // initialize subArray
-	if (param->parallelRead) {
-		adderTree->Initialize(numSubArrayRow, log2((double)param->levelOutput)+param->numBitInput+1, ceil((double)numSubArrayCol*(double)numCol/(double)param->numColMuxed));
-	} else {
-		adderTree->Initialize(numSubArrayRow, (log2((double)numRow)+param->cellBit-1)+param->numBitInput+1, ceil((double)numSubArrayCol*(double)numCol/(double)param->numColMuxed));
-	}
-	
-	bufferInput->Initialize(param->numBitInput*numRow, param->clkFreq);
-	if (param->parallelRead) {
-		bufferOutput->Initialize((numCol/param->numColMuxed)*(log2((double)param->levelOutput)+param->numBitInput+adderTree->numStage), param->clkFreq);
-	} else {
-		bufferOutput->Initialize((numCol/param->numColMuxed)*((log2((double)numRow)+param->cellBit-1)+param->numBitInput+adderTree->numStage), param->clkFreq);
-	}
-	
-	subArray->CalculateArea();
-	busInput->Initialize(HORIZONTAL, numSubArrayRow, numSubArrayCol, 0, numRow, subArray->height, subArray->width);
-	busOutput->Initialize(VERTICAL, numSubArrayRow, numSubArrayCol, 0, numCol, subArray->height, subArray->width);
-}
-
-
-vector<double> ProcessingUnitCalculateArea(SubArray *subArray, int numSubArrayRow, int numSubArrayCol, double *height, double *width, double *bufferArea) {
-	vector<double> areaResults;
-	*height = 0;
-	*width = 0;
-	*bufferArea = 0;
-	double area = 0;
-	
-	subArray->CalculateArea();
-	adderTree->CalculateArea(NULL, subArray->width, NONE);
-	bufferInput->CalculateArea(numSubArrayRow*subArray->height, NULL, NONE);
-	bufferOutput->CalculateArea(NULL, numSubArrayCol*subArray->width, NONE);
-	
-	busInput->CalculateArea(1, true); 
-	busOutput->CalculateArea(1, true);	
-	area += subArray->usedArea * (numSubArrayRow*numSubArrayCol) + adderTree->area + bufferInput->area + bufferOutput->area;
-	
-	*height = sqrt(area);
-	*width = area/(*height);
-	
-	areaResults.push_back(area);
-	areaResults.push_back(subArray->areaADC*(numSubArrayRow*numSubArrayCol));
-	areaResults.push_back(subArray->areaAccum*(numSubArrayRow*numSubArrayCol)+adderTree->area);
-	areaResults.push_back(subArray->areaOther*(numSubArrayRow*numSubArrayCol)+ bufferInput->area + bufferOutput->area);
-	
-	return areaResults;
-}
-
-
-double ProcessingUnitCalculatePerformance(SubArray *subArray, const vector<vector<double> > &newMemory, const vector<vector<double> > &oldMemory, 
-											const vector<vector<double> > &inputVector,
-											int arrayDupRow, int arrayDupCol, int numSubArrayRow, int numSubArrayCol, int weightMatrixRow,
-											int weightMatrixCol, int numInVector, MemCell& cell, double *readLatency, double *readDynamicEnergy, double *leakage, 
-											double *bufferLatency, double *bufferDynamicEnergy, double *icLatency, double *icDynamicEnergy,
-											double *coreLatencyADC, double *coreLatencyAccum, double *coreLatencyOther, double *coreEnergyADC, 
-											double *coreEnergyAccum, double *coreEnergyOther) {
-	
-	/*** define how many subArray are used to map the whole layer ***/
-	*readLatency = 0;
-	*readDynamicEnergy = 0;
-	*leakage = 0;
-	*bufferLatency = 0;
-	*bufferDynamicEnergy = 0;
-	*icLatency = 0;
-	*icDynamicEnergy = 0;
-	*coreEnergyADC = 0;
-	*coreEnergyAccum = 0;
-	*coreEnergyOther = 0;
-	*coreLatencyADC = 0;
-	*coreLatencyAccum = 0;
-	*coreLatencyOther = 0;
-	
-	double subArrayReadLatency, subArrayReadDynamicEnergy, subArrayLeakage, subArrayLatencyADC, subArrayLatencyAccum, subArrayLatencyOther;
-
-	if (arrayDupRow*arrayDupCol > 1) {
-		// weight matrix is duplicated among subArray
-		if (arrayDupRow < numSubArrayRow || arrayDupCol < numSubArrayCol) {
-			// a couple of subArrays are mapped by the matrix
-			// need to redefine the data-grab start-point
-			for (int i=0; i<ceil((double) weightMatrixRow/(double) param->numRowSubArray); i++) {
-				for (int j=0; j<ceil((double) weightMatrixCol/(double) param->numColSubArray); j++) {
-					int numRowMatrix = min(param->numRowSubArray, weightMatrixRow-i*param->numRowSubArray);
-					int numColMatrix = min(param->numColSubArray, weightMatrixCol-j*param->numColSubArray);
-					
-					if ((i*param->numRowSubArray < weightMatrixRow) && (j*param->numColSubArray < weightMatrixCol) && (i*param->numRowSubArray < weightMatrixRow) ) {
-						// assign weight and input to specific subArray
-						vector<vector<double> > subArrayMemory;
-						subArrayMemory = CopySubArray(newMemory, i*param->numRowSubArray, j*param->numColSubArray, numRowMatrix, numColMatrix);
-						vector<vector<double> > subArrayInput;
-						subArrayInput = CopySubInput(inputVector, i*param->numRowSubArray, numInVector, numRowMatrix);
-						
-						subArrayReadLatency = 0;
-						subArrayLatencyADC = 0;
-						subArrayLatencyAccum = 0;
-						subArrayLatencyOther = 0;
-
-						for (int k=0; k<numInVector; k++) {                 // calculate single subArray through the total input vectors
-							double activityRowRead = 0;
-							vector<double> input; 
-							input = GetInputVector(subArrayInput, k, &activityRowRead);
-							subArray->activityRowRead = activityRowRead;
-							
-							int cellRange = pow(2, param->cellBit);
-							if (param->parallelRead) {
-								subArray->levelOutput = param->levelOutput;               // # of levels of the multilevelSenseAmp output
-							} else {
-								subArray->levelOutput = cellRange;
-							}
-							
-							vector<double> columnResistance;
-							columnResistance = GetColumnResistance(input, subArrayMemory, cell, param->parallelRead, subArray->resCellAccess);
-							
-							subArray->CalculateLatency(1e20, columnResistance);
-							subArray->CalculatePower(columnResistance);
-							
-							subArrayReadLatency += subArray->readLatency;
-							*readDynamicEnergy += subArray->readDynamicEnergy;
-							subArrayLeakage = subArray->leakage;
-
-							subArrayLatencyADC += subArray->readLatencyADC;
-							subArrayLatencyAccum += subArray->readLatencyAccum;
-							subArrayLatencyOther += subArray->readLatencyOther;
-							
-							*coreEnergyADC += subArray->readDynamicEnergyADC;
-							*coreEnergyAccum += subArray->readDynamicEnergyAccum;
-							*coreEnergyOther += subArray->readDynamicEnergyOther;
-						}
-						adderTree->CalculateLatency((int)(numInVector/param->numBitInput)*param->numColMuxed, ceil((double) weightMatrixRow/(double) param->numRowSubArray), 0);
-						adderTree->CalculatePower((int)(numInVector/param->numBitInput)*param->numColMuxed, ceil((double) weightMatrixRow/(double) param->numRowSubArray));
-						
-						*readLatency = max(subArrayReadLatency + adderTree->readLatency, (*readLatency));
-						*readDynamicEnergy += adderTree->readDynamicEnergy;
-						
-						*coreLatencyADC = MAX(subArrayLatencyADC, (*coreLatencyADC));
-						*coreLatencyAccum = MAX(subArrayLatencyAccum + adderTree->readLatency, (*coreLatencyAccum));
-						*coreLatencyOther = MAX(subArrayLatencyOther, (*coreLatencyOther));
-		
-						*coreEnergyAccum += adderTree->readDynamicEnergy;
-					}
-				}
-			}
-			// considering speedup, the latency of processing each layer is decreased
-			*readLatency = (*readLatency)/(arrayDupRow*arrayDupCol);
-			*coreLatencyADC = (*coreLatencyADC)/(arrayDupRow*arrayDupCol);
-			*coreLatencyAccum = (*coreLatencyAccum)/(arrayDupRow*arrayDupCol);
-			*coreLatencyOther = (*coreLatencyOther)/(arrayDupRow*arrayDupCol);
-		} else {
-			// assign weight and input to specific subArray
-			vector<vector<double> > subArrayMemory;
-			subArrayMemory = CopySubArray(newMemory, 0, 0, weightMatrixRow, weightMatrixCol);
-			vector<vector<double> > subArrayInput;
-			subArrayInput = CopySubInput(inputVector, 0, numInVector, weightMatrixRow);
-
-			subArrayReadLatency = 0;
-			subArrayLatencyADC = 0;
-			subArrayLatencyAccum = 0;
-			subArrayLatencyOther = 0;
-
-			for (int k=0; k<numInVector; k++) {                 // calculate single subArray through the total input vectors
-				double activityRowRead = 0;
-				vector<double> input;
-				input = GetInputVector(subArrayInput, k, &activityRowRead);
-				subArray->activityRowRead = activityRowRead;
-				int cellRange = pow(2, param->cellBit);
-				
-				if (param->parallelRead) {
-					subArray->levelOutput = param->levelOutput;               // # of levels of the multilevelSenseAmp output
-				} else {
-					subArray->levelOutput = cellRange;
-				}
-				
-				vector<double> columnResistance;
-				columnResistance = GetColumnResistance(input, subArrayMemory, cell, param->parallelRead, subArray->resCellAccess);
-				
-				subArray->CalculateLatency(1e20, columnResistance);
-				subArray->CalculatePower(columnResistance);
-				
-				subArrayReadLatency += subArray->readLatency;
-				*readDynamicEnergy += subArray->readDynamicEnergy;
-				subArrayLeakage = subArray->leakage;
-				
-				subArrayLatencyADC += subArray->readLatencyADC;
-				subArrayLatencyAccum += subArray->readLatencyAccum;
-				subArrayLatencyOther += subArray->readLatencyOther;
-				
-				*coreEnergyADC += subArray->readDynamicEnergyADC;
-				*coreEnergyAccum += subArray->readDynamicEnergyAccum;
-				*coreEnergyOther += subArray->readDynamicEnergyOther;
-			}
-			
-			// do not pass adderTree 
-			*readLatency = subArrayReadLatency/(arrayDupRow*arrayDupCol);
-			*coreLatencyADC = subArrayLatencyADC/(arrayDupRow*arrayDupCol);
-			*coreLatencyAccum = subArrayLatencyAccum/(arrayDupRow*arrayDupCol);
-			*coreLatencyOther = subArrayLatencyOther/(arrayDupRow*arrayDupCol);
-		}
-	} else {
-		// weight matrix is further partitioned inside PE (among subArray) --> no duplicated
-		for (int i=0; i<numSubArrayRow/*ceil((double) weightMatrixRow/(double) param->numRowSubArray)*/; i++) {
-			for (int j=0; j<numSubArrayCol/*ceil((double) weightMatrixCol/(double) param->numColSubArray)*/; j++) {
-				if ((i*param->numRowSubArray < weightMatrixRow) && (j*param->numColSubArray < weightMatrixCol) && (i*param->numRowSubArray < weightMatrixRow) ) {
-					int numRowMatrix = min(param->numRowSubArray, weightMatrixRow-i*param->numRowSubArray);
-					int numColMatrix = min(param->numColSubArray, weightMatrixCol-j*param->numColSubArray);
-					// assign weight and input to specific subArray
-					vector<vector<double> > subArrayMemory;
-					subArrayMemory = CopySubArray(newMemory, i*param->numRowSubArray, j*param->numColSubArray, numRowMatrix, numColMatrix);
-					vector<vector<double> > subArrayInput;
-					subArrayInput = CopySubInput(inputVector, i*param->numRowSubArray, numInVector, numRowMatrix);
-					
-					subArrayReadLatency = 0;
-					subArrayLatencyADC = 0;
-					subArrayLatencyAccum = 0;
-					subArrayLatencyOther = 0;
-					
-					for (int k=0; k<numInVector; k++) {                 // calculate single subArray through the total input vectors
-						double activityRowRead = 0;
-						vector<double> input;
-						input = GetInputVector(subArrayInput, k, &activityRowRead);
-						subArray->activityRowRead = activityRowRead;
-						
-						int cellRange = pow(2, param->cellBit);
-						if (param->parallelRead) {
-							subArray->levelOutput = param->levelOutput;               // # of levels of the multilevelSenseAmp output
-						} else {
-							subArray->levelOutput = cellRange;
-						}
-						
-						vector<double> columnResistance;
-						columnResistance = GetColumnResistance(input, subArrayMemory, cell, param->parallelRead, subArray->resCellAccess);
-
-						subArray->CalculateLatency(1e20, columnResistance);
-						subArray->CalculatePower(columnResistance);
-						
-						subArrayReadLatency += subArray->readLatency;
-						*readDynamicEnergy += subArray->readDynamicEnergy;
-						subArrayLeakage = subArray->leakage;
-						
-						subArrayLatencyADC += subArray->readLatencyADC;
-						subArrayLatencyAccum += subArray->readLatencyAccum;
-						subArrayLatencyOther += subArray->readLatencyOther;
-						
-						*coreEnergyADC += subArray->readDynamicEnergyADC;
-						*coreEnergyAccum += subArray->readDynamicEnergyAccum;
-						*coreEnergyOther += subArray->readDynamicEnergyOther;
-						
-					}
-					*readLatency = max(subArrayReadLatency, (*readLatency));
-					*coreLatencyADC = MAX(subArrayLatencyADC, (*coreLatencyADC));
-					*coreLatencyAccum = MAX(subArrayLatencyAccum, (*coreLatencyAccum));
-					*coreLatencyOther = MAX(subArrayLatencyOther, (*coreLatencyOther));
-				}
-			}
-		}
-		adderTree->CalculateLatency((int)(numInVector/param->numBitInput)*param->numColMuxed, ceil((double) weightMatrixRow/(double) param->numRowSubArray), 0);
-		adderTree->CalculatePower((int)(numInVector/param->numBitInput)*param->numColMuxed, ceil((double) weightMatrixRow/(double) param->numRowSubArray));
-		*readLatency += adderTree->readLatency;
-		*coreLatencyAccum += adderTree->readLatency;
-		*readDynamicEnergy += adderTree->readDynamicEnergy;
-		*coreEnergyAccum += adderTree->readDynamicEnergy;
-		
-	}
-	//considering buffer activation: no matter speedup or not, the total number of data transferred is fixed
-	
-	// input buffer: total num of data loaded in = weightMatrixRow*numInVector
-	// output buffer: total num of data transferred = weightMatrixRow*numInVector/param->numBitInput (total num of IFM in the PE) *adderTree->numAdderTree*adderTree->numAdderBit (bit precision of OFMs) 
-	bufferInput->CalculateLatency(0, numInVector*ceil((double) weightMatrixRow/(double) param->numRowSubArray));
-	bufferOutput->CalculateLatency(0, numInVector/param->numBitInput);
-	bufferInput->CalculatePower(weightMatrixRow/param->numRowPerSynapse, numInVector);
-	bufferOutput->CalculatePower(weightMatrixCol/param->numColPerSynapse*adderTree->numAdderBit, numInVector/param->numBitInput);
-	
-	busInput->CalculateLatency(weightMatrixRow/param->numRowPerSynapse*numInVector/(busInput->busWidth)); 
-	busInput->CalculatePower(busInput->busWidth, weightMatrixRow/param->numRowPerSynapse*numInVector/(busInput->busWidth));
-	
-	if (param->parallelRead) {
-		busOutput->CalculateLatency((weightMatrixCol/param->numColPerSynapse*log2((double)param->levelOutput)*numInVector/param->numBitInput)/(busOutput->numRow*busOutput->busWidth));
-		busOutput->CalculatePower(busOutput->numRow*busOutput->busWidth, (weightMatrixCol/param->numColPerSynapse*log2((double)param->levelOutput)*numInVector/param->numBitInput)/(busOutput->numRow*busOutput->busWidth));
-	} else {
-		busOutput->CalculateLatency((weightMatrixCol/param->numColPerSynapse*(log2((double)param->numRowSubArray)+param->cellBit-1)*numInVector/param->numBitInput)/(busOutput->numRow*busOutput->busWidth));
-		busOutput->CalculatePower(busOutput->numRow*busOutput->busWidth, (weightMatrixCol/param->numColPerSynapse*(log2((double)param->numRowSubArray)+param->cellBit-1)*numInVector/param->numBitInput)/(busOutput->numRow*busOutput->busWidth));
-	}
-
-	*bufferLatency += bufferInput->readLatency + bufferOutput->readLatency;
-	*icLatency += busInput->readLatency + busOutput->readLatency;
-	*bufferDynamicEnergy += bufferInput->readDynamicEnergy + bufferOutput->readDynamicEnergy;
-	*icDynamicEnergy += busInput->readDynamicEnergy + busOutput->readDynamicEnergy;
-	
-	*readLatency += (*bufferLatency) + (*icLatency);
-	*readDynamicEnergy += (*bufferDynamicEnergy) + (*icDynamicEnergy);
-	*leakage = subArrayLeakage*numSubArrayRow*numSubArrayCol + adderTree->leakage + bufferInput->leakage + bufferOutput->leakage;
-	
-	*coreLatencyOther += (*bufferLatency) + (*icLatency);
-	*coreEnergyOther += (*bufferDynamicEnergy) + (*icDynamicEnergy);
-	
-	// TODO: Training
-	
-}
-
-
-vector<vector<double> > CopySubArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol) {
-	vector<vector<double> > copy;
-	for (int i=0; i<numRow; i++) {
-		vector<double> copyRow;
-		for (int j=0; j<numCol; j++) {
-			copyRow.push_back(orginal[positionRow+i][positionCol+j]);
-		}
-		copy.push_back(copyRow);
-		copyRow.clear();
-	}
-	return copy;
-	copy.clear();
-} 
-
-
-vector<vector<double> > CopySubInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow) {
-	vector<vector<double> > copy;
-	for (int i=0; i<numRow; i++) {
-		vector<double> copyRow;
-		for (int j=0; j<numInputVector; j++) {
-			copyRow.push_back(orginal[positionRow+i][j]);
-		}
-		copy.push_back(copyRow);
-		copyRow.clear();
-	}
-	return copy;
-	copy.clear();
-}
-
-
-vector<double> GetInputVector(const vector<vector<double> > &input, int numInput, double *activityRowRead) {
-	vector<double> copy;
-	for (int i=0; i<input.size(); i++) {
-		double x = input[i][numInput];
-		copy.push_back(x);   
-	}  
-	double numofreadrow = 0;  // initialize readrowactivity parameters
-	for (int i=0; i<input.size(); i++) {
-		if (copy[i] != 0) {
-			numofreadrow += 1;
-		}else {
-			numofreadrow += 0;
-		}
-	}
-	double totalnumRow = input.size();
-	*(activityRowRead) = numofreadrow/totalnumRow;
-	return copy;
-	copy.clear();
-} 
-
-
-vector<double> GetColumnResistance(const vector<double> &input, const vector<vector<double> > &weight, MemCell& cell, bool parallelRead, double resCellAccess) {
-	vector<double> resistance;
-	vector<double> conductance;
-	double columnG = 0; 
-	
-	for (int j=0; j<weight[0].size(); j++) {
-		int activatedRow = 0;
-		columnG = 0;
-		for (int i=0; i<weight.size(); i++) {
-			if (cell.memCellType == Type::RRAM) {	// eNVM
-				double totalWireResistance;
-				if (cell.accessType == CMOS_access) {
-					totalWireResistance = (double) 1.0/weight[i][j] + (j + 1) * param->wireResistanceRow + (weight.size() - i) * param->wireResistanceCol + cell.resistanceAccess;
-				} else {
-					totalWireResistance = (double) 1.0/weight[i][j] + (j + 1) * param->wireResistanceRow + (weight.size() - i) * param->wireResistanceCol;
-				}
-				if ((int) input[i] == 1) {
-					columnG += (double) 1.0/totalWireResistance;
-					activatedRow += 1 ;
-				} else {
-					columnG += 0;
-				}
-			} else if (cell.memCellType == Type::FeFET) {
-				double totalWireResistance;
-				totalWireResistance = (double) 1.0/weight[i][j] + (j + 1) * param->wireResistanceRow + (weight.size() - i) * param->wireResistanceCol;
-				if ((int) input[i] == 1) {
-					columnG += (double) 1.0/totalWireResistance;
-					activatedRow += 1 ;
-				} else {
-					columnG += 0;
-				}
-				
-			} else if (cell.memCellType == Type::SRAM) {	
-				// SRAM: weight value do not affect sense energy --> read energy calculated in subArray.cpp (based on wireRes wireCap etc)
-				double totalWireResistance = (double) (resCellAccess + param->wireResistanceCol);
-				if ((int) input[i] == 1) {
-					columnG += (double) 1.0/totalWireResistance;
-					activatedRow += 1 ;
-				} else {
-					columnG += 0;
-				}
-			}
-		}
-		
-		if (cell.memCellType == Type::RRAM || cell.memCellType == Type::FeFET) {
-			if (!parallelRead) {  
-				conductance.push_back((double) columnG/activatedRow);
-			} else {
-				conductance.push_back(columnG);
-			}
-		} else {
-			conductance.push_back(columnG);
-		}
-	}
-	// covert conductance to resistance
-	for (int i=0; i<weight[0].size(); i++) {
-		resistance.push_back((double) 1.0/conductance[i]);
-	}
-		
-	return resistance;
-	resistance.clear();
-} 
-
-
-
-
-
-
-
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <stdlib.h>
+#include <vector>
+#include <sstream>
+#include <random>
+#include <algorithm>
+#include "Bus.h"
+#include "SubArray.h"
+#include "constant.h"
+#include "formula.h"
+#include "ProcessingUnit.h"
+#include "Param.h"
+#include "AdderTree.h"
+#include "Bus.h"
+#include "DFF.h"
+#include "MonteCarlo.h"
+#include "Breakdown.h"
+#include "Activity.h"
+#include "Profile.h"
+
+using namespace std;
+
+extern Param *param;
+
+AdderTree *adderTree;
+Bus *busInput;
+Bus *busOutput;
+DFF *bufferInput;
+DFF *bufferOutput;
+
+SamplingStats samplingStats;
+
+// scratch buffers of the per-input-vector loop, one set per worker thread: they keep their capacity, so the loop does not allocate once they have grown
+thread_local vector<double> scratchInput;
+thread_local vector<double> scratchColumnResistance;
+
+void ProcessingUnitInitialize(SubArray *& subArray, InputParameter& inputParameter, Technology& tech, MemCell& cell, int _numSubArrayRow, int _numSubArrayCol) {
+
+	/*** circuit level parameters ***/
+	switch(param->memcelltype) {
+		case 3:     cell.memCellType = Type::FeFET; break;
+		case 2:	    cell.memCellType = Type::RRAM; break;
+		case 1:	    cell.memCellType = Type::SRAM; break;
+		case -1:	break;
+		default:	exit(-1);
+	}
+	switch(param->accesstype) {
+		case 4:	    cell.accessType = none_access;  break;
+		case 3:	    cell.accessType = diode_access; break;
+		case 2:	    cell.accessType = BJT_access;   break;
+		case 1:	    cell.accessType = CMOS_access;  break;
+		case -1:	break;
+		default:	exit(-1);
+	}				
+					
+	switch(param->transistortype) {
+		case 3:	    inputParameter.transistorType = TFET;          break;
+		case 2:	    inputParameter.transistorType = FET_2D;        break;
+		case 1:	    inputParameter.transistorType = conventional;  break;
+		case -1:	break;
+		default:	exit(-1);
+	}
+	
+	switch(param->deviceroadmap) {
+		case 2:	    inputParameter.deviceRoadmap = LSTP;  break;
+		case 1:	    inputParameter.deviceRoadmap = HP;    break;
+		case -1:	break;
+		default:	exit(-1);
+	}
+	
+	subArray = new SubArray(inputParameter, tech, cell);
+	adderTree = new AdderTree(inputParameter, tech, cell);
+	busInput = new Bus(inputParameter, tech, cell);
+	busOutput = new Bus(inputParameter, tech, cell);
+	bufferInput = new DFF(inputParameter, tech, cell);
+	bufferOutput = new DFF(inputParameter, tech, cell);
+		
+	/* Create SubArray object and link the required global objects (not initialization) */
+	inputParameter.temperature = param->temp;   // Temperature (K)
+	inputParameter.processNode = param->technode;    // Technology node
+	tech.Initialize(inputParameter.processNode, inputParameter.deviceRoadmap, inputParameter.transistorType);
+	
+	cell.resistanceOn = param->resistanceOn;	                                // Ron resistance at Vr in the reported measurement data (need to recalculate below if considering the nonlinearity)
+	cell.resistanceOff = param->resistanceOff;	                                // Roff resistance at Vr in the reported measurement dat (need to recalculate below if considering the nonlinearity)
+	cell.resistanceAvg = (cell.resistanceOn + cell.resistanceOff)/2;            // Average resistance (for energy estimation)
+	cell.readVoltage = param->readVoltage;	                                    // On-chip read voltage for memory cell
+	cell.readPulseWidth = param->readPulseWidth;
+	cell.writeVoltage = param->writeVoltage;
+	cell.writePulseWidth = param->writePulseWidth;
+	cell.accessVoltage = param->accessVoltage;                                       // Gate voltage for the transistor in 1T1R
+	cell.resistanceAccess = param->resistanceAccess;
+	cell.featureSize = param->featuresize; 
+
+	if (cell.memCellType == Type::SRAM) {   // SRAM
+		cell.heightInFeatureSize = param->heightInFeatureSizeSRAM;                   // Cell height in feature size
+		cell.widthInFeatureSize = param->widthInFeatureSizeSRAM;                     // Cell width in feature size
+		cell.widthSRAMCellNMOS = param->widthSRAMCellNMOS;
+		cell.widthSRAMCellPMOS = param->widthSRAMCellPMOS;
+		cell.widthAccessCMOS = param->widthAccessCMOS;
+		cell.minSenseVoltage = param->minSenseVoltage;
+	} else {
+		cell.heightInFeatureSize = (cell.accessType==CMOS_access)? param->heightInFeatureSize1T1R : param->heightInFeatureSizeCrossbar;         // Cell height in feature size
+		cell.widthInFeatureSize = (cell.accessType==CMOS_access)? param->widthInFeatureSize1T1R : param->widthInFeatureSizeCrossbar;            // Cell width in feature size
+	}
+
+	subArray->XNORparallelMode = param->XNORparallelMode;               
+	subArray->XNORsequentialMode = param->XNORsequentialMode;             
+	subArray->BNNparallelMode = param->BNNparallelMode;                
+	subArray->BNNsequentialMode = param->BNNsequentialMode;              
+	subArray->conventionalParallel = param->conventionalParallel;                  
+	subArray->conventionalSequential = param->conventionalSequential;                 
+	subArray->numRow = param->numRowSubArray;
+	subArray->numCol = param->numRowSubArray;
+	subArray->levelOutput = param->levelOutput;
+	subArray->numColMuxed = param->numColMuxed;               // How many columns share 1 read circuit (for neuro mode with analog RRAM) or 1 S/A (for memory mode or neuro mode with digital RRAM)
+    subArray->clkFreq = param->clkFreq;                       // Clock frequency
+	subArray->relaxArrayCellHeight = param->relaxArrayCellHeight;
+	subArray->relaxArrayCellWidth = param->relaxArrayCellWidth;
+	subArray->numReadPulse = param->numInputCycle;
+	subArray->numBitPerReadPulse = param->numInputBitPerCycle;
+	subArray->avgWeightBit = param->cellBit;
+	subArray->numCellPerSynapse = param->numColPerSynapse;
+	
+	int numRow = param->numRowSubArray;
+	int numCol = param->numColSubArray;
+	
+	if (subArray->numColMuxed > numCol) {                      // Set the upperbound of numColMuxed
+		subArray->numColMuxed = numCol;
+	}
+
+	subArray->numReadCellPerOperationFPGA = numCol;	           // Not relevant for IMEC
+	subArray->numWriteCellPerOperationFPGA = numCol;	       // Not relevant for IMEC
+	subArray->numReadCellPerOperationMemory = numCol;          // Define # of SRAM read cells in memory mode because SRAM does not have S/A sharing (not relevant for IMEC)
+	subArray->numWriteCellPerOperationMemory = numCol/8;       // # of write cells per operation in SRAM memory or the memory mode of multifunctional memory (not relevant for IMEC)
+	subArray->numReadCellPerOperationNeuro = numCol;           // # of SRAM read cells in neuromorphic mode
+	subArray->numWriteCellPerOperationNeuro = numCol;	       // For SRAM or analog RRAM in neuro mode
+    subArray->maxNumWritePulse = MAX(cell.maxNumLevelLTP, cell.maxNumLevelLTD);
+
+	int numSubArrayRow = _numSubArrayRow;
+	int numSubArrayCol = _numSubArrayCol;
+
+	/*** initialize modules ***/
+	subArray->Initialize(numRow, numCol, param->unitLengthWireResistance);        // initialize subArray
+	if (param->parallelRead) {
+		adderTree->Initialize(numSubArrayRow, log2((double)param->levelOutput)+param->numBitInput+1, ceil((double)numSubArrayCol*(double)numCol/(double)param->numColMuxed));
+	} else {
+		adderTree->Initialize(numSubArrayRow, (log2((double)numRow)+param->cellBit-1)+param->numBitInput+1, ceil((double)numSubArrayCol*(double)numCol/(double)param->numColMuxed));
+	}
+	
+	bufferInput->Initialize(param->numBitInput*numRow, param->clkFreq);
+	if (param->parallelRead) {
+		bufferOutput->Initialize((numCol/param->numColMuxed)*(log2((double)param->levelOutput)+param->numBitInput+adderTree->numStage), param->clkFreq);
+	} else {
+		bufferOutput->Initialize((numCol/param->numColMuxed)*((log2((double)numRow)+param->cellBit-1)+param->numBitInput+adderTree->numStage), param->clkFreq);
+	}
+	
+	subArray->CalculateArea();
+	busInput->Initialize(HORIZONTAL, numSubArrayRow, numSubArrayCol, 0, numRow, subArray->height, subArray->width);
+	busOutput->Initialize(VERTICAL, numSubArrayRow, numSubArrayCol, 0, numCol, subArray->height, subArray->width);
+}
+
+
+vector<double> ProcessingUnitCalculateArea(SubArray *subArray, int numSubArrayRow, int numSubArrayCol, double *height, double *width, double *bufferArea) {
+	vector<double> areaResults;
+	*height = 0;
+	*width = 0;
+	*bufferArea = 0;
+	double area = 0;
+	
+	subArray->CalculateArea();
+	adderTree->CalculateArea(NULL, subArray->width, NONE);
+	bufferInput->CalculateArea(numSubArrayRow*subArray->height, NULL, NONE);
+	bufferOutput->CalculateArea(NULL, numSubArrayCol*subArray->width, NONE);
+	bufferInput->area *= param->numBufferStage;
+	bufferOutput->area *= param->numBufferStage;
+	
+	busInput->CalculateArea(1, true); 
+	busOutput->CalculateArea(1, true);	
+	area += subArray->usedArea * (numSubArrayRow*numSubArrayCol) + adderTree->area + bufferInput->area + bufferOutput->area;
+	
+	*height = sqrt(area);
+	*width = area/(*height);
+	
+	areaResults.push_back(area);
+	areaResults.push_back(subArray->areaADC*(numSubArrayRow*numSubArrayCol));
+	areaResults.push_back(subArray->areaAccum*(numSubArrayRow*numSubArrayCol)+adderTree->area);
+	areaResults.push_back(subArray->areaOther*(numSubArrayRow*numSubArrayCol)+ bufferInput->area + bufferOutput->area);
+	
+	return areaResults;
+}
+
+
+void ProcessingUnitCalculatePerformance(SubArray *subArray, const vector<vector<double> > &newMemory, const vector<vector<double> > &oldMemory, 
+											const vector<vector<double> > &inputVector,
+											int arrayDupRow, int arrayDupCol, int numSubArrayRow, int numSubArrayCol, int weightMatrixRow,
+											int weightMatrixCol, int numInVector, int bandRow, const vector<int> &instance, MemCell& cell, double *readLatency, double *readDynamicEnergy, double *leakage, 
+											double *bufferLatency, double *bufferDynamicEnergy, double *icLatency, double *icDynamicEnergy,
+											double *coreLatencyADC, double *coreLatencyAccum, double *coreLatencyOther, double *coreEnergyADC, 
+											double *coreEnergyAccum, double *coreEnergyOther) {
+	
+	/*** define how many subArray are used to map the whole layer ***/
+	*readLatency = 0;
+	*readDynamicEnergy = 0;
+	*leakage = 0;
+	*bufferLatency = 0;
+	*bufferDynamicEnergy = 0;
+	*icLatency = 0;
+	*icDynamicEnergy = 0;
+	*coreEnergyADC = 0;
+	*coreEnergyAccum = 0;
+	*coreEnergyOther = 0;
+	*coreLatencyADC = 0;
+	*coreLatencyAccum = 0;
+	*coreLatencyOther = 0;
+	
+	double subArrayReadLatency, subArrayReadDynamicEnergy, subArrayLeakage, subArrayLatencyADC, subArrayLatencyAccum, subArrayLatencyOther;
+	double subArrayEnergyADC, subArrayEnergyAccum, subArrayEnergyOther;
+	// a packed grouped layer (bandRow > 0) stacks bands of different groups on the same columns: the adder tree only sums the subArrays
+	// of one band, and each band sends out its own outputs
+	double numBand = (bandRow > 0)? ceil((double) weightMatrixRow/(double) bandRow) : 1;
+	int numRowAdded = (bandRow > 0)? MIN(bandRow, weightMatrixRow) : weightMatrixRow;
+
+	if (arrayDupRow*arrayDupCol > 1) {
+		// weight matrix is duplicated among subArray
+		if (arrayDupRow < numSubArrayRow || arrayDupCol < numSubArrayCol) {
+			// a couple of subArrays are mapped by the matrix
+			// need to redefine the data-grab start-point
+			for (int i=0; i<ceil((double) weightMatrixRow/(double) param->numRowSubArray); i++) {
+				for (int j=0; j<ceil((double) weightMatrixCol/(double) param->numColSubArray); j++) {
+					int numRowMatrix = min(param->numRowSubArray, weightMatrixRow-i*param->numRowSubArray);
+					int numColMatrix = min(param->numColSubArray, weightMatrixCol-j*param->numColSubArray);
+					
+					if ((i*param->numRowSubArray < weightMatrixRow) && (j*param->numColSubArray < weightMatrixCol) && (i*param->numRowSubArray < weightMatrixRow) ) {
+						// assign weight and input to specific subArray
+						vector<vector<double> > subArrayMemory;
+						subArrayMemory = CopySubArray(newMemory, i*param->numRowSubArray, j*param->numColSubArray, numRowMatrix, numColMatrix);
+						vector<vector<double> > subArrayInput;
+						subArrayInput = CopySubInput(inputVector, i*param->numRowSubArray, numInVector, numRowMatrix);
+						
+						BreakdownPush("subArray", i, j);
+						SubArrayCalculatePerformance(subArray, subArrayMemory, subArrayInput, numInVector, SubInstance(instance, i, j), cell, &subArrayReadLatency, &subArrayReadDynamicEnergy, &subArrayLeakage,
+											&subArrayLatencyADC, &subArrayLatencyAccum, &subArrayLatencyOther, &subArrayEnergyADC, &subArrayEnergyAccum, &subArrayEnergyOther);
+						BreakdownPop();
+						*readDynamicEnergy += subArrayReadDynamicEnergy;
+						*coreEnergyADC += subArrayEnergyADC;
+						*coreEnergyAccum += subArrayEnergyAccum;
+						*coreEnergyOther += subArrayEnergyOther;
+						adderTree->CalculateLatency((int)(numInVector/param->numInputCycle)*param->numColMuxed*numBand, ceil((double) numRowAdded/(double) param->numRowSubArray), 0);
+						adderTree->CalculatePower((int)(numInVector/param->numInputCycle)*param->numColMuxed*numBand, ceil((double) numRowAdded/(double) param->numRowSubArray));
+						adderTree->AddBreakdown("adderTree");
+						
+						*readLatency = max(subArrayReadLatency + adderTree->readLatency, (*readLatency));
+						*readDynamicEnergy += adderTree->readDynamicEnergy;
+						
+						*coreLatencyADC = MAX(subArrayLatencyADC, (*coreLatencyADC));
+						*coreLatencyAccum = MAX(subArrayLatencyAccum + adderTree->readLatency, (*coreLatencyAccum));
+						*coreLatencyOther = MAX(subArrayLatencyOther, (*coreLatencyOther));
+		
+						*coreEnergyAccum += adderTree->readDynamicEnergy;
+					}
+				}
+			}
+			// considering speedup, the latency of processing each layer is decreased
+			*readLatency = (*readLatency)/(arrayDupRow*arrayDupCol);
+			*coreLatencyADC = (*coreLatencyADC)/(arrayDupRow*arrayDupCol);
+			*coreLatencyAccum = (*coreLatencyAccum)/(arrayDupRow*arrayDupCol);
+			*coreLatencyOther = (*coreLatencyOther)/(arrayDupRow*arrayDupCol);
+		} else {
+			// assign weight and input to specific subArray
+			vector<vector<double> > subArrayMemory;
+			subArrayMemory = CopySubArray(newMemory, 0, 0, weightMatrixRow, weightMatrixCol);
+			vector<vector<double> > subArrayInput;
+			subArrayInput = CopySubInput(inputVector, 0, numInVector, weightMatrixRow);
+
+			BreakdownPush("subArray", 0, 0);
+			SubArrayCalculatePerformance(subArray, subArrayMemory, subArrayInput, numInVector, SubInstance(instance, 0, 0), cell, &subArrayReadLatency, &subArrayReadDynamicEnergy, &subArrayLeakage,
+								&subArrayLatencyADC, &subArrayLatencyAccum, &subArrayLatencyOther, &subArrayEnergyADC, &subArrayEnergyAccum, &subArrayEnergyOther);
+			BreakdownPop();
+			*readDynamicEnergy += subArrayReadDynamicEnergy;
+			*coreEnergyADC += subArrayEnergyADC;
+			*coreEnergyAccum += subArrayEnergyAccum;
+			*coreEnergyOther += subArrayEnergyOther;
+			
+			// do not pass adderTree 
+			*readLatency = subArrayReadLatency/(arrayDupRow*arrayDupCol);
+			*coreLatencyADC = subArrayLatencyADC/(arrayDupRow*arrayDupCol);
+			*coreLatencyAccum = subArrayLatencyAccum/(arrayDupRow*arrayDupCol);
+			*coreLatencyOther = subArrayLatencyOther/(arrayDupRow*arrayDupCol);
+		}
+	} else {
+		// weight matrix is further partitioned inside PE (among subArray) --> no duplicated
+		for (int i=0; i<numSubArrayRow/*ceil((double) weightMatrixRow/(double) param->numRowSubArray)*/; i++) {
+			for (int j=0; j<numSubArrayCol/*ceil((double) weightMatrixCol/(double) param->numColSubArray)*/; j++) {
+				if ((i*param->numRowSubArray < weightMatrixRow) && (j*param->numColSubArray < weightMatrixCol) && (i*param->numRowSubArray < weightMatrixRow) ) {
+					int numRowMatrix = min(param->numRowSubArray, weightMatrixRow-i*param->numRowSubArray);
+					int numColMatrix = min(param->numColSubArray, weightMatrixCol-j*param->numColSubArray);
+					// assign weight and input to specific subArray
+					vector<vector<double> > subArrayMemory;
+					subArrayMemory = CopySubArray(newMemory, i*param->numRowSubArray, j*param->numColSubArray, numRowMatrix, numColMatrix);
+					vector<vector<double> > subArrayInput;
+					subArrayInput = CopySubInput(inputVector, i*param->numRowSubArray, numInVector, numRowMatrix);
+					
+					BreakdownPush("subArray", i, j);
+					SubArrayCalculatePerformance(subArray, subArrayMemory, subArrayInput, numInVector, SubInstance(instance, i, j), cell, &subArrayReadLatency, &subArrayReadDynamicEnergy, &subArrayLeakage,
+										&subArrayLatencyADC, &subArrayLatencyAccum, &subArrayLatencyOther, &subArrayEnergyADC, &subArrayEnergyAccum, &subArrayEnergyOther);
+					BreakdownPop();
+					*readDynamicEnergy += subArrayReadDynamicEnergy;
+					*coreEnergyADC += subArrayEnergyADC;
+					*coreEnergyAccum += subArrayEnergyAccum;
+					*coreEnergyOther += subArrayEnergyOther;
+					*readLatency = max(subArrayReadLatency, (*readLatency));
+					*coreLatencyADC = MAX(subArrayLatencyADC, (*coreLatencyADC));
+					*coreLatencyAccum = MAX(subArrayLatencyAccum, (*coreLatencyAccum));
+					*coreLatencyOther = MAX(subArrayLatencyOther, (*coreLatencyOther));
+				}
+			}
+		}
+		adderTree->CalculateLatency((int)(numInVector/param->numInputCycle)*param->numColMuxed*numBand, ceil((double) numRowAdded/(double) param->numRowSubArray), 0);
+		adderTree->CalculatePower((int)(numInVector/param->numInputCycle)*param->numColMuxed*numBand, ceil((double) numRowAdded/(double) param->numRowSubArray));
+		adderTree->AddBreakdown("adderTree");
+		*readLatency += adderTree->readLatency;
+		*coreLatencyAccum += adderTree->readLatency;
+		*readDynamicEnergy += adderTree->readDynamicEnergy;
+		*coreEnergyAccum += adderTree->readDynamicEnergy;
+		
+	}
+	//considering buffer activation: no matter speedup or not, the total number of data transferred is fixed
+	
+	// input buffer: total num of data loaded in = weightMatrixRow*numInputBit (each of the numInVector read cycles applies numInputBitPerCycle bits per row)
+	// output buffer: total num of data transferred = weightMatrixRow*numInVector/param->numInputCycle (total num of IFM in the PE) *adderTree->numAdderTree*adderTree->numAdderBit (bit precision of OFMs) 
+	double numInputBit = (double) numInVector/param->numInputCycle*param->numBitInput;
+	bufferInput->CalculateLatency(0, numInVector*ceil((double) weightMatrixRow/(double) param->numRowSubArray));
+	bufferOutput->CalculateLatency(0, numInVector/param->numInputCycle*numBand);
+	bufferInput->CalculatePower(weightMatrixRow/param->numRowPerSynapse, numInputBit);
+	bufferOutput->CalculatePower(weightMatrixCol/param->numColPerSynapse*adderTree->numAdderBit, numInVector/param->numInputCycle*numBand);
+	
+	busInput->CalculateLatency(weightMatrixRow/param->numRowPerSynapse*numInputBit/(busInput->busWidth)); 
+	busInput->CalculatePower(busInput->busWidth, weightMatrixRow/param->numRowPerSynapse*numInputBit/(busInput->busWidth));
+	
+	if (param->parallelRead) {
+		busOutput->CalculateLatency((weightMatrixCol/param->numColPerSynapse*log2((double)param->levelOutput)*numInVector/param->numInputCycle*numBand)/(busOutput->numRow*busOutput->busWidth));
+		busOutput->CalculatePower(busOutput->numRow*busOutput->busWidth, (weightMatrixCol/param->numColPerSynapse*log2((double)param->levelOutput)*numInVector/param->numInputCycle*numBand)/(busOutput->numRow*busOutput->busWidth));
+	} else {
+		busOutput->CalculateLatency((weightMatrixCol/param->numColPerSynapse*(log2((double)param->numRowSubArray)+param->cellBit-1)*numInVector/param->numInputCycle*numBand)/(busOutput->numRow*busOutput->busWidth));
+		busOutput->CalculatePower(busOutput->numRow*busOutput->busWidth, (weightMatrixCol/param->numColPerSynapse*(log2((double)param->numRowSubArray)+param->cellBit-1)*numInVector/param->numInputCycle*numBand)/(busOutput->numRow*busOutput->busWidth));
+	}
+
+	bufferInput->AddBreakdown("bufferInput");
+	bufferOutput->AddBreakdown("bufferOutput");
+	busInput->AddBreakdown("busInput");
+	busOutput->AddBreakdown("busOutput");
+	
+	*bufferLatency += bufferInput->readLatency + bufferOutput->readLatency;
+	*icLatency += busInput->readLatency + busOutput->readLatency;
+	*bufferDynamicEnergy += bufferInput->readDynamicEnergy + bufferOutput->readDynamicEnergy;
+	*icDynamicEnergy += busInput->readDynamicEnergy + busOutput->readDynamicEnergy;
+	
+	*readLatency += (*bufferLatency) + (*icLatency);
+	*readDynamicEnergy += (*bufferDynamicEnergy) + (*icDynamicEnergy);
+	*leakage = subArrayLeakage*numSubArrayRow*numSubArrayCol + adderTree->leakage + bufferInput->leakage*param->numBufferStage + bufferOutput->leakage*param->numBufferStage;
+	
+	*coreLatencyOther += (*bufferLatency) + (*icLatency);
+	if (param->numBufferStage > 1) {
+		double overlapLatency = BufferOverlapLatency(*readLatency, bufferInput->readLatency + busInput->readLatency, bufferOutput->readLatency + busOutput->readLatency, numInVector/param->numInputCycle);
+		*coreLatencyOther -= (*readLatency) - overlapLatency;   // only the part of the data movement not hidden behind the compute
+		*readLatency = overlapLatency;
+	}
+	*coreEnergyOther += (*bufferDynamicEnergy) + (*icDynamicEnergy);
+	
+	// TODO: Training
+	
+}
+
+
+void ProcessingUnitCalculateWrite(SubArray *subArray, int weightMatrixRow, int weightMatrixCol, double *writeLatency, double *writeDynamicEnergy) {
+	// program a weightMatrixRow x weightMatrixCol matrix into the PE with the partition of ProcessingUnitCalculatePerformance:
+	// the input bus carries the cell values to the subArrays, which then write their rows in parallel
+	*writeLatency = 0;
+	*writeDynamicEnergy = 0;
+	int numSubArrayCol = ceil((double) weightMatrixCol/(double) param->numColSubArray);
+	for (int i=0; i<ceil((double) weightMatrixRow/(double) param->numRowSubArray); i++) {
+		int numRowMatrix = min(param->numRowSubArray, weightMatrixRow-i*param->numRowSubArray);
+		subArray->CalculateWrite(numRowMatrix);
+		*writeLatency = MAX(subArray->writeLatency, (*writeLatency));
+		*writeDynamicEnergy += subArray->writeDynamicEnergy*numSubArrayCol;
+	}
+	double numBitToWrite = (double) weightMatrixRow*weightMatrixCol*param->cellBit;
+	busInput->CalculateLatency(numBitToWrite/busInput->busWidth);
+	busInput->CalculatePower(busInput->busWidth, numBitToWrite/busInput->busWidth);
+	*writeLatency += busInput->readLatency;
+	*writeDynamicEnergy += busInput->readDynamicEnergy;
+}
+
+
+// latency of one level once its buffer loads and stores are overlapped with the compute of the other input blocks (param->numBufferStage copies of each buffer)
+double BufferOverlapLatency(double serialLatency, double loadLatency, double storeLatency, double numBlock) {
+	double computeLatency = MAX(serialLatency - loadLatency - storeLatency, 0);
+	// 2 copies: one block is computed while the other one is stored and reloaded; 3 or more: load, compute and store all run at once
+	double movementLatency = (param->numBufferStage == 2)? loadLatency + storeLatency : MAX(loadLatency, storeLatency);
+	double stageLatency = MAX(computeLatency, movementLatency);
+	// the slowest stage sets the pace, only the pipeline fill (first load) and drain (last compute and store) of one block stay exposed
+	numBlock = MAX(numBlock, 1);
+	return stageLatency + (computeLatency + loadLatency + storeLatency - stageLatency)/numBlock;
+}
+
+
+void SubArrayCalculatePerformance(SubArray *subArray, const vector<vector<double> > &subArrayMemory, const vector<vector<double> > &subArrayInput, int numInVector, 
+								const vector<int> &instance, MemCell& cell,
+								double *readLatency, double *readDynamicEnergy, double *leakage, double *latencyADC, double *latencyAccum, double *latencyOther,
+								double *energyADC, double *energyAccum, double *energyOther) {
+	
+	*readLatency = 0;
+	*readDynamicEnergy = 0;
+	*leakage = 0;
+	*latencyADC = 0;
+	*latencyAccum = 0;
+	*latencyOther = 0;
+	*energyADC = 0;
+	*energyAccum = 0;
+	*energyOther = 0;
+	
+	int cellRange = pow(2, param->cellBit);
+	if (param->parallelRead) {
+		subArray->levelOutput = param->levelOutput;               // # of levels of the multilevelSenseAmp output
+	} else {
+		subArray->levelOutput = cellRange;
+	}
+	
+	if (!param->sampling || param->monteCarlo || numInVector <= param->samplingMinVector) {
+		vector<double> senseAmpLatency;
+		vector<double> senseAmpEnergy;
+		vector<double> nominalSenseAmpLatency;
+		vector<double> nominalSenseAmpEnergy;
+		MultilevelSenseAmp *nominalSenseAmp = NULL;     // unscaled column terms, the reference of the variation trials
+		if (param->monteCarlo) {
+			nominalSenseAmp = new MultilevelSenseAmp(subArray->multilevelSenseAmp);
+			senseAmpLatency.reserve(numInVector);
+			senseAmpEnergy.reserve(numInVector);
+			nominalSenseAmpLatency.reserve(numInVector);
+			nominalSenseAmpEnergy.reserve(numInVector);
+		}
+		for (int k=0; k<numInVector; k++) {                 // calculate single subArray through the total input vectors
+			PROFILE_SCOPE("SubArrayReadVector");
+			double activityRowRead = 0;
+			GetInputVector(subArrayInput, k, &scratchInput, &activityRowRead);
+			subArray->activityRowRead = activityRowRead;
+			
+			GetColumnResistance(scratchInput, subArrayMemory, cell, param->parallelRead, subArray->resCellAccess, &scratchColumnResistance);
+			const vector<double> &columnResistance = scratchColumnResistance;
+			
+			ActivityRecord(activityRowRead, subArrayInput.size(), columnResistance);
+			
+			subArray->CalculateLatency(1e20, columnResistance);
+			subArray->CalculatePower(columnResistance);
+			
+			*readLatency += subArray->readLatency;
+			*readDynamicEnergy += subArray->readDynamicEnergy;
+			*leakage = subArray->leakage;
+			
+			*latencyADC += subArray->readLatencyADC;
+			*latencyAccum += subArray->readLatencyAccum;
+			*latencyOther += subArray->readLatencyOther;
+			
+			*energyADC += subArray->readDynamicEnergyADC;
+			*energyAccum += subArray->readDynamicEnergyAccum;
+			*energyOther += subArray->readDynamicEnergyOther;
+			
+			if (param->breakdown) {
+				subArray->AccumulateBreakdown();
+			}
+			if (param->monteCarlo) {
+				senseAmpLatency.push_back(subArray->multilevelSenseAmp.readLatency);
+				senseAmpEnergy.push_back(subArray->multilevelSenseAmp.readDynamicEnergy);
+				nominalSenseAmp->CalculateLatency(columnResistance, 1, 1);
+				nominalSenseAmp->CalculatePower(columnResistance, 1);
+				nominalSenseAmpLatency.push_back(nominalSenseAmp->readLatency);
+				nominalSenseAmpEnergy.push_back(nominalSenseAmp->readDynamicEnergy);
+			}
+		}
+		if (param->monteCarlo) {
+			SubArrayMonteCarlo(subArray, subArrayMemory, subArrayInput, numInVector, instance, cell, senseAmpLatency, senseAmpEnergy, 
+								nominalSenseAmpLatency, nominalSenseAmpEnergy, *readLatency);
+			delete nominalSenseAmp;
+		}
+		if (param->breakdown) {
+			subArray->FlushBreakdown(1, 1);
+		}
+		samplingStats.numSampled += numInVector;
+		samplingStats.numTotal += numInVector;
+		return;
+	}
+	
+	/*** stratified sampling of the input vectors ***/
+	// the trace interleaves the input cycles of each activation (column = vector*numInputCycle + cycle), and the cycles differ a lot in sparsity (e.g. sign bit),
+	// so each cycle position is one stratum; inside a stratum the vectors are visited in a random order and the sample grows until the interval is tight enough
+	vector<unsigned int> seedData = InstanceSeed(param->samplingSeed, instance);
+	seed_seq seed(seedData.begin(), seedData.end());
+	mt19937 samplingGen(seed);
+	int numStrata = MAX(MIN(param->numInputCycle, numInVector), 1);
+	vector<vector<int> > strata(numStrata);
+	for (int k=0; k<numInVector; k++) {
+		strata[k%numStrata].push_back(k);
+	}
+	for (int h=0; h<numStrata; h++) {
+		shuffle(strata[h].begin(), strata[h].end(), samplingGen);
+	}
+	
+	const int numMetric = 8;    // readLatency, readDynamicEnergy, latencyADC/Accum/Other, energyADC/Accum/Other
+	vector<vector<double> > sum(numStrata, vector<double>(numMetric, 0));
+	vector<vector<double> > sumSquare(numStrata, vector<double>(numMetric, 0));
+	vector<int> numDone(numStrata, 0);
+	double z = SamplingZValue(param->samplingConfidence);
+	
+	int numPerStratum = MAX(2, (int) ceil((double) param->samplingMinVector/numStrata));
+	double latencyRelError = 0, energyVariance = 0;
+	while (true) {
+		for (int h=0; h<numStrata; h++) {
+			int target = MIN(numPerStratum, (int) strata[h].size());
+			for (; numDone[h]<target; numDone[h]++) {
+				int k = strata[h][numDone[h]];
+				PROFILE_SCOPE("SubArrayReadVector");
+				double activityRowRead = 0;
+				GetInputVector(subArrayInput, k, &scratchInput, &activityRowRead);
+				subArray->activityRowRead = activityRowRead;
+				
+				GetColumnResistance(scratchInput, subArrayMemory, cell, param->parallelRead, subArray->resCellAccess, &scratchColumnResistance);
+				const vector<double> &columnResistance = scratchColumnResistance;
+				
+				ActivityRecord(activityRowRead, subArrayInput.size(), columnResistance);
+				
+				subArray->CalculateLatency(1e20, columnResistance);
+				subArray->CalculatePower(columnResistance);
+				*leakage = subArray->leakage;
+				if (param->breakdown) {
+					subArray->AccumulateBreakdown();
+				}
+				
+				double metric[numMetric] = {subArray->readLatency, subArray->readDynamicEnergy, subArray->readLatencyADC, subArray->readLatencyAccum, subArray->readLatencyOther,
+											subArray->readDynamicEnergyADC, subArray->readDynamicEnergyAccum, subArray->readDynamicEnergyOther};
+				for (int m=0; m<numMetric; m++) {
+					sum[h][m] += metric[m];
+					sumSquare[h][m] += metric[m]*metric[m];
+				}
+			}
+		}
+		
+		// extrapolate the totals: sum of N_h*mean_h, variance of the estimate: sum of N_h^2*(1-n_h/N_h)*s_h^2/n_h
+		vector<double> estimate(numMetric, 0);
+		vector<double> variance(numMetric, 0);
+		bool exhausted = true;
+		for (int h=0; h<numStrata; h++) {
+			double N = strata[h].size();
+			double n = numDone[h];
+			if (n < N) {
+				exhausted = false;
+			}
+			for (int m=0; m<numMetric; m++) {
+				double mean = sum[h][m]/n;
+				estimate[m] += N*mean;
+				if (n > 1) {
+					double s2 = MAX((sumSquare[h][m] - n*mean*mean)/(n-1), 0);
+					variance[m] += N*N*(1-n/N)*s2/n;
+				}
+			}
+		}
+		*readLatency = estimate[0];
+		*readDynamicEnergy = estimate[1];
+		*latencyADC = estimate[2];
+		*latencyAccum = estimate[3];
+		*latencyOther = estimate[4];
+		*energyADC = estimate[5];
+		*energyAccum = estimate[6];
+		*energyOther = estimate[7];
+		
+		latencyRelError = (estimate[0] > 0)? z*sqrt(variance[0])/estimate[0] : 0;
+		double energyRelError = (estimate[1] > 0)? z*sqrt(variance[1])/estimate[1] : 0;
+		energyVariance = variance[1];
+		if (exhausted || (latencyRelError <= param->samplingTargetError && energyRelError <= param->samplingTargetError)) {
+			break;
+		}
+		numPerStratum *= 2;
+	}
+	
+	double sampledLatency = 0, sampledEnergy = 0;
+	for (int h=0; h<numStrata; h++) {
+		samplingStats.numSampled += numDone[h];
+		sampledLatency += sum[h][0];
+		sampledEnergy += sum[h][1];
+	}
+	if (param->breakdown) {
+		// the sampled vectors stand for all of them
+		subArray->FlushBreakdown((sampledLatency > 0)? (*readLatency)/sampledLatency : 0, (sampledEnergy > 0)? (*readDynamicEnergy)/sampledEnergy : 0);
+	}
+	samplingStats.numTotal += numInVector;
+	samplingStats.energyVariance += energyVariance;
+	samplingStats.latencyRelError = MAX(samplingStats.latencyRelError, latencyRelError);
+}
+
+
+// instance = (layer, tile row/col, PE row/col, subArray row/col), the path of BreakdownPush as numbers; a col of -1 (1-D index) is kept as is
+vector<int> SubInstance(const vector<int> &instance, int row, int col) {
+	vector<int> sub(instance);
+	sub.push_back(row);
+	sub.push_back(col);
+	return sub;
+}
+
+
+// seed data of the random streams of one instance: they only depend on the seed and the instance, not on the order of the simulation
+vector<unsigned int> InstanceSeed(int seed, const vector<int> &instance) {
+	vector<unsigned int> seedData(1, seed);
+	seedData.insert(seedData.end(), instance.begin(), instance.end());
+	return seedData;
+}
+
+
+double SamplingZValue(double confidence) {
+	// two-sided normal quantile: solve erfc(z/sqrt(2)) = 1-confidence by bisection
+	double low = 0, high = 10;
+	for (int i=0; i<100; i++) {
+		double mid = (low+high)/2;
+		if (erfc(mid/sqrt(2.0)) > 1-confidence) {
+			low = mid;
+		} else {
+			high = mid;
+		}
+	}
+	return (low+high)/2;
+}
+
+
+void ResetSamplingStats() {
+	samplingStats.numSampled = 0;
+	samplingStats.numTotal = 0;
+	samplingStats.energyVariance = 0;
+	samplingStats.latencyRelError = 0;
+}
+
+
+vector<vector<double> > CopySubArray(const vector<vector<double> > &orginal, int positionRow, int positionCol, int numRow, int numCol) {
+	vector<vector<double> > copy;
+	for (int i=0; i<numRow; i++) {
+		vector<double> copyRow;
+		for (int j=0; j<numCol; j++) {
+			copyRow.push_back(orginal[positionRow+i][positionCol+j]);
+		}
+		copy.push_back(copyRow);
+		copyRow.clear();
+	}
+	return copy;
+	copy.clear();
+} 
+
+
+vector<vector<double> > CopySubInput(const vector<vector<double> > &orginal, int positionRow, int numInputVector, int numRow) {
+	vector<vector<double> > copy;
+	for (int i=0; i<numRow; i++) {
+		vector<double> copyRow;
+		for (int j=0; j<numInputVector; j++) {
+			copyRow.push_back(orginal[positionRow+i][j]);
+		}
+		copy.push_back(copyRow);
+		copyRow.clear();
+	}
+	return copy;
+	copy.clear();
+}
+
+
+vector<double> GetInputVector(const vector<vector<double> > &input, int numInput, double *activityRowRead) {
+	vector<double> copy;
+	GetInputVector(input, numInput, &copy, activityRowRead);
+	return copy;
+}
+
+
+void GetInputVector(const vector<vector<double> > &input, int numInput, vector<double> *copy, double *activityRowRead) {
+	// fills the caller's buffer, which keeps its capacity from one input vector to the next
+	copy->resize(input.size());
+	double numofreadrow = 0;  // initialize readrowactivity parameters
+	for (int i=0; i<input.size(); i++) {
+		double x = input[i][numInput];
+		(*copy)[i] = x;
+		if (x != 0) {
+			numofreadrow += 1;
+		}
+	}
+	double totalnumRow = input.size();
+	*(activityRowRead) = numofreadrow/totalnumRow;
+}
+
+
+vector<double> GetColumnResistance(const vector<double> &input, const vector<vector<double> > &weight, MemCell& cell, bool parallelRead, double resCellAccess) {
+	vector<double> resistance;
+	GetColumnResistance(input, weight, cell, parallelRead, resCellAccess, &resistance);
+	return resistance;
+}
+
+
+void GetColumnResistance(const vector<double> &input, const vector<vector<double> > &weight, MemCell& cell, bool parallelRead, double resCellAccess, vector<double> *resistance) {
+	PROFILE_SCOPE("GetColumnResistance");
+	resistance->resize(weight[0].size());
+	double columnG = 0; 
+	
+	for (int j=0; j<weight[0].size(); j++) {
+		int activatedRow = 0;
+		columnG = 0;
+		for (int i=0; i<weight.size(); i++) {
+			if (cell.memCellType == Type::RRAM) {	// eNVM
+				double totalWireResistance;
+				if (cell.accessType == CMOS_access) {
+					totalWireResistance = (double) 1.0/weight[i][j] + (j + 1) * param->wireResistanceRow + (weight.size() - i) * param->wireResistanceCol + cell.resistanceAccess;
+				} else {
+					totalWireResistance = (double) 1.0/weight[i][j] + (j + 1) * param->wireResistanceRow + (weight.size() - i) * param->wireResistanceCol;
+				}
+				if (input[i] != 0) {   // a multi-level input (param->numInputBitPerCycle > 1) scales the cell current by its level
+					columnG += input[i]/totalWireResistance;
+					activatedRow += 1 ;
+				} else {
+					columnG += 0;
+				}
+			} else if (cell.memCellType == Type::FeFET) {
+				double totalWireResistance;
+				totalWireResistance = (double) 1.0/weight[i][j] + (j + 1) * param->wireResistanceRow + (weight.size() - i) * param->wireResistanceCol;
+				if (input[i] != 0) {
+					columnG += input[i]/totalWireResistance;
+					activatedRow += 1 ;
+				} else {
+					columnG += 0;
+				}
+				
+			} else if (cell.memCellType == Type::SRAM) {	
+				// SRAM: weight value do not affect sense energy --> read energy calculated in subArray.cpp (based on wireRes wireCap etc)
+				double totalWireResistance = (double) (resCellAccess + param->wireResistanceCol);
+				if (input[i] != 0) {
+					columnG += input[i]/totalWireResistance;
+					activatedRow += 1 ;
+				} else {
+					columnG += 0;
+				}
+			}
+		}
+		
+		// covert conductance to resistance
+		double conductance = columnG;
+		if ((cell.memCellType == Type::RRAM || cell.memCellType == Type::FeFET) && !parallelRead) {
+			// row-by-row read: average cell conductance of the activated rows, a column without any activated row carries no current (as in parallel read)
+			conductance = (activatedRow > 0)? (double) columnG/activatedRow : 0;
+		}
+		(*resistance)[j] = (double) 1.0/conductance;
+	}
+}
+
+
+
+
+
+
+
+
@@ -0,0 +1,284 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <mutex>
+#include <new>
+#include <cstdlib>
+#include "Param.h"
+#include "Report.h"
+#include "Profile.h"
+
+using namespace std;
+
+extern Param *param;
+
+const int maxNumProfile = 64;   // # of distinct profiled phases
+
+struct ProfileEvent {
+	int id;
+	double start, duration;     // us since the start of the program
+};
+
+struct ProfileTable {
+	int thread;
+	long long numCall[maxNumProfile];
+	double time[maxNumProfile];      // s
+	double numItem[maxNumProfile];
+	long long numAlloc[maxNumProfile];   // heap allocations inside the phase (including the phases nested in it)
+	vector<ProfileEvent> event;
+};
+
+mutex profileMutex;                           // only taken once per phase and once per thread, never while timing
+vector<string> profileName;
+vector<ProfileTable *> profileTable;
+chrono::steady_clock::time_point profileStart = chrono::steady_clock::now();
+thread_local ProfileTable *profileThreadTable = NULL;
+thread_local long long profileNumAlloc = 0;    // heap allocations of this thread so far
+bool profileCountAlloc = false;                // set once before the simulation starts, so a plain load on the allocation path
+
+/*** Global allocation functions, only counting (when profiling) on top of malloc/free ***/
+void *operator new(size_t size) {
+	if (profileCountAlloc) {
+		profileNumAlloc++;
+	}
+	void *p = malloc(size? size : 1);
+	if (!p) {
+		throw bad_alloc();
+	}
+	return p;
+}
+
+void *operator new[](size_t size) {
+	return operator new(size);
+}
+
+void *operator new(size_t size, const nothrow_t &) noexcept {
+	if (profileCountAlloc) {
+		profileNumAlloc++;
+	}
+	return malloc(size? size : 1);
+}
+
+void *operator new[](size_t size, const nothrow_t &) noexcept {
+	return operator new(size, nothrow);
+}
+
+void operator delete(void *p) noexcept {
+	free(p);
+}
+
+void operator delete[](void *p) noexcept {
+	free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+	free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept {
+	free(p);
+}
+
+#ifdef __cpp_aligned_new
+// over-aligned types (C++17): without these the default aligned operator new would allocate without being counted
+void *operator new(size_t size, align_val_t alignment, const nothrow_t &) noexcept {
+	if (profileCountAlloc) {
+		profileNumAlloc++;
+	}
+	size_t align = ((size_t) alignment < sizeof(void *))? sizeof(void *) : (size_t) alignment;     // posix_memalign needs at least the pointer size
+	void *p = NULL;
+	if (posix_memalign(&p, align, size? size : 1) != 0) {
+		return NULL;
+	}
+	return p;
+}
+
+void *operator new(size_t size, align_val_t alignment) {
+	void *p = operator new(size, alignment, nothrow);
+	if (!p) {
+		throw bad_alloc();
+	}
+	return p;
+}
+
+void *operator new[](size_t size, align_val_t alignment) {
+	return operator new(size, alignment);
+}
+
+void *operator new[](size_t size, align_val_t alignment, const nothrow_t &) noexcept {
+	return operator new(size, alignment, nothrow);
+}
+
+void operator delete(void *p, align_val_t) noexcept {
+	free(p);
+}
+
+void operator delete[](void *p, align_val_t) noexcept {
+	free(p);
+}
+
+void operator delete(void *p, size_t, align_val_t) noexcept {
+	free(p);
+}
+
+void operator delete[](void *p, size_t, align_val_t) noexcept {
+	free(p);
+}
+#endif
+
+
+void ProfileCountAllocation(bool count) {
+	profileCountAlloc = count;
+}
+
+
+long long ProfileNumAlloc() {
+	return profileNumAlloc;
+}
+
+
+
+int ProfileRegister(const char *name) {
+	lock_guard<mutex> lock(profileMutex);
+	for (int i=0; i<profileName.size(); i++) {
+		if (profileName[i] == name) {
+			return i;
+		}
+	}
+	if (profileName.size() >= maxNumProfile) {
+		cerr << "Error: too many profiled phases (maxNumProfile = " << maxNumProfile << ")!" << endl;
+		exit(-1);
+	}
+	profileName.push_back(name);
+	return profileName.size()-1;
+}
+
+
+ProfileTable *GetProfileTable() {
+	if (!profileThreadTable) {
+		profileThreadTable = new ProfileTable();   // zero-initialized, kept until the end of the program
+		lock_guard<mutex> lock(profileMutex);
+		profileThreadTable->thread = profileTable.size();
+		profileTable.push_back(profileThreadTable);
+	}
+	return profileThreadTable;
+}
+
+
+ProfileScope::ProfileScope(int _id, bool _trace, double _numItem): id(_id), trace(_trace), numItem(_numItem) {
+	if (param->profile) {
+		startNumAlloc = profileNumAlloc;
+		start = chrono::steady_clock::now();
+	}
+}
+
+
+ProfileScope::~ProfileScope() {
+	if (!param->profile) {
+		return;
+	}
+	chrono::steady_clock::time_point stop = chrono::steady_clock::now();
+	long long numAlloc = profileNumAlloc - startNumAlloc;     // before the table below allocates anything
+	ProfileTable *table = GetProfileTable();
+	double duration = chrono::duration<double>(stop-start).count();
+	table->numCall[id]++;
+	table->time[id] += duration;
+	table->numItem[id] += numItem;
+	table->numAlloc[id] += numAlloc;
+	if (trace) {
+		ProfileEvent e = {id, chrono::duration<double, micro>(start-profileStart).count(), duration*1e6};
+		table->event.push_back(e);
+	}
+}
+
+
+void ProfilePrint() {
+	lock_guard<mutex> lock(profileMutex);
+	cout << "------------------------------ Simulator Profile --------------------------------" <<  endl;
+	cout << left << setw(32) << "phase" << right << setw(12) << "calls" << setw(14) << "total (ms)" << setw(14) << "mean (us)" << setw(16) << "items/s" << setw(14) << "allocs" << setw(14) << "allocs/call" << endl;
+	for (int i=0; i<profileName.size(); i++) {
+		long long numCall = 0;
+		long long numAlloc = 0;
+		double time = 0, numItem = 0;
+		for (int t=0; t<profileTable.size(); t++) {
+			numCall += profileTable[t]->numCall[i];
+			time += profileTable[t]->time[i];
+			numItem += profileTable[t]->numItem[i];
+			numAlloc += profileTable[t]->numAlloc[i];
+		}
+		if (numCall == 0) {
+			continue;
+		}
+		cout << left << setw(32) << profileName[i] << right << setw(12) << numCall << setw(14) << time*1e3 << setw(14) << time/numCall*1e6 << setw(16) << ((time > 0)? numItem/time : 0) 
+			<< setw(14) << numAlloc << setw(14) << (double) numAlloc/numCall << endl;
+		ReportSet("profile/" + profileName[i], "calls", numCall, "");
+		ReportSet("profile/" + profileName[i], "time", time, "s");
+		ReportSet("profile/" + profileName[i], "throughput", (time > 0)? numItem/time : 0, "1/s");
+		ReportSet("profile/" + profileName[i], "allocations", numAlloc, "");
+	}
+	cout << "(time is summed over threads, items are input vectors for the layers and calls otherwise, allocs are heap allocations inside the phase)" << endl;
+}
+
+
+void ProfileWriteTrace(const string &filename) {
+	// Chrome trace-event format (chrome://tracing, Perfetto): one complete event ("ph":"X") per traced call
+	lock_guard<mutex> lock(profileMutex);
+	ofstream file(filename.c_str());
+	if (!file.good()) {
+		cerr << "Error: the trace file " << filename << " cannot be opened!" << endl;
+		return;
+	}
+	file << "{\"traceEvents\":[";
+	bool first = true;
+	for (int t=0; t<profileTable.size(); t++) {
+		for (int k=0; k<profileTable[t]->event.size(); k++) {
+			const ProfileEvent &e = profileTable[t]->event[k];
+			file << (first? "\n" : ",\n") << "{\"name\":\"" << profileName[e.id] << "\",\"cat\":\"neurosim\",\"ph\":\"X\",\"pid\":0,\"tid\":" << profileTable[t]->thread
+				 << fixed << setprecision(3) << ",\"ts\":" << e.start << ",\"dur\":" << e.duration << "}";
+			first = false;
+		}
+	}
+	file << "\n],\"displayTimeUnit\":\"ms\"}" << endl;
+	file.close();
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <string>
+#include <chrono>
+
+using namespace std;
+
+/*** Self-profiling of the simulator: wall time and call counts of its phases (not of the modeled hardware) ***/
+// each thread counts into its own table, the tables are only merged when the profile is printed or written
+// heap allocations are counted by replacing the global operator new, per thread, and attributed to the phases they happen in;
+// the counting is only turned on (ProfileCountAllocation) for a profiled run, otherwise operator new is plain malloc
+
+class ProfileScope {
+public:
+	ProfileScope(int _id, bool _trace=false, double _numItem=1);   // _trace: also record this call in the trace-event file, _numItem: work done (e.g. input vectors) for the throughput
+	~ProfileScope();
+	
+private:
+	int id;
+	bool trace;
+	double numItem;
+	chrono::steady_clock::time_point start;
+	long long startNumAlloc;
+};
+
+/*** Functions ***/
+int ProfileRegister(const char *name);
+void ProfileCountAllocation(bool count);
+long long ProfileNumAlloc();
+void ProfilePrint();
+void ProfileWriteTrace(const string &filename);
+
+// usage: PROFILE_SCOPE("name") at the top of a block times the rest of the block
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(name) static const int PROFILE_CONCAT(profileId, __LINE__) = ProfileRegister(name); \
+							ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileId, __LINE__))
+#define PROFILE_SCOPE_TRACE(name, numItem) static const int PROFILE_CONCAT(profileId, __LINE__) = ProfileRegister(name); \
+							ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileId, __LINE__), true, numItem)
+
+#endif /* PROFILE_H_ */
@@ -0,0 +1,378 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include "Param.h"
+#include "Report.h"
+
+using namespace std;
+
+extern Param *param;
+
+vector<ReportScope> reportScopes;
+map<string, int> reportScopeIndex;
+
+void ReportSet(const string &scope, const string &metric, double value, const string &unit) {
+	if (reportScopeIndex.find(scope) == reportScopeIndex.end()) {
+		ReportScope newScope;
+		newScope.name = scope;
+		reportScopeIndex[scope] = reportScopes.size();
+		reportScopes.push_back(newScope);
+	}
+	vector<ReportMetric> &metrics = reportScopes[reportScopeIndex[scope]].metrics;
+	for (int i=0; i<metrics.size(); i++) {
+		if (metrics[i].name == metric) {     // re-simulated, keep the latest value
+			metrics[i].value = value;
+			metrics[i].unit = unit;
+			return;
+		}
+	}
+	ReportMetric newMetric;
+	newMetric.name = metric;
+	newMetric.value = value;
+	newMetric.unit = unit;
+	metrics.push_back(newMetric);
+}
+
+
+void ReportSetBreakdown(const string &scope, double readLatency, double readDynamicEnergy, double bufferLatency, double bufferDynamicEnergy, double icLatency, double icDynamicEnergy,
+						double latencyADC, double latencyAccum, double latencyOther, double energyADC, double energyAccum, double energyOther) {
+	ReportSet(scope, "readLatency", readLatency, "s");
+	ReportSet(scope, "readDynamicEnergy", readDynamicEnergy, "J");
+	ReportSet(scope, "bufferLatency", bufferLatency, "s");
+	ReportSet(scope, "bufferReadDynamicEnergy", bufferDynamicEnergy, "J");
+	ReportSet(scope, "icLatency", icLatency, "s");
+	ReportSet(scope, "icReadDynamicEnergy", icDynamicEnergy, "J");
+	ReportSet(scope, "latencyADC", latencyADC, "s");
+	ReportSet(scope, "latencyAccum", latencyAccum, "s");
+	ReportSet(scope, "latencyOther", latencyOther, "s");
+	ReportSet(scope, "energyADC", energyADC, "J");
+	ReportSet(scope, "energyAccum", energyAccum, "J");
+	ReportSet(scope, "energyOther", energyOther, "J");
+}
+
+
+double ReportGet(const string &scope, const string &metric) {
+	if (reportScopeIndex.find(scope) == reportScopeIndex.end()) {
+		return 0;
+	}
+	const vector<ReportMetric> &metrics = reportScopes[reportScopeIndex[scope]].metrics;
+	for (int i=0; i<metrics.size(); i++) {
+		if (metrics[i].name == metric) {
+			return metrics[i].value;
+		}
+	}
+	return 0;
+}
+
+
+bool ReportHas(const string &scope, const string &metric) {
+	if (reportScopeIndex.find(scope) == reportScopeIndex.end()) {
+		return false;
+	}
+	const vector<ReportMetric> &metrics = reportScopes[reportScopeIndex[scope]].metrics;
+	for (int i=0; i<metrics.size(); i++) {
+		if (metrics[i].name == metric) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+string LayerScope(int layer) {
+	return "layer" + to_string(layer);
+}
+
+
+void ReportWrite(const string &filename) {
+	// *.csv: one "scope,metric,value,unit" row per metric; anything else: JSON, {scope: {metric: {"value": v, "unit": u}}}
+	ofstream file(filename.c_str());
+	if (!file.good()) {
+		cerr << "Error: the report file " << filename << " cannot be opened!" << endl;
+		return;
+	}
+	file << setprecision(17);
+	bool csv = filename.size() >= 4 && filename.compare(filename.size()-4, 4, ".csv") == 0;
+	if (csv) {
+		file << "scope,metric,value,unit" << endl;
+		for (int s=0; s<reportScopes.size(); s++) {
+			for (int m=0; m<reportScopes[s].metrics.size(); m++) {
+				const ReportMetric &metric = reportScopes[s].metrics[m];
+				file << reportScopes[s].name << "," << metric.name << "," << metric.value << "," << metric.unit << endl;
+			}
+		}
+	} else {
+		file << "{" << endl;
+		for (int s=0; s<reportScopes.size(); s++) {
+			file << "  \"" << reportScopes[s].name << "\": {" << endl;
+			for (int m=0; m<reportScopes[s].metrics.size(); m++) {
+				const ReportMetric &metric = reportScopes[s].metrics[m];
+				file << "    \"" << metric.name << "\": {\"value\": ";
+				if (std::isfinite(metric.value)) {
+					file << metric.value;
+				} else {
+					file << "null";     // JSON has no inf/nan
+				}
+				file << ", \"unit\": \"" << metric.unit << "\"}" << (m+1 < reportScopes[s].metrics.size()? "," : "") << endl;
+			}
+			file << "  }" << (s+1 < reportScopes.size()? "," : "") << endl;
+		}
+		file << "}" << endl;
+	}
+	file.close();
+}
+
+
+void ReportPrintFloorPlan(int numLayer) {
+	cout << "------------------------------ FloorPlan --------------------------------" <<  endl;
+	cout << endl;
+	cout << "Tile and PE size are optimized to maximize memory utilization ( = memory mapped by synapse / total memory on chip)" << endl;
+	cout << endl;
+	cout << "Desired Conventional Mapped Tile Storage Size: " << ReportGet("chip", "tileSizeCM") << "x" << ReportGet("chip", "tileSizeCM") << endl;
+	cout << "Desired Conventional PE Storage Size: " << ReportGet("chip", "peSizeCM") << "x" << ReportGet("chip", "peSizeCM") << endl;
+	if (param->novelMapping) {
+		cout << "Desired Novel Mapped Tile Storage Size: " << ReportGet("chip", "numPENM") << "x" << ReportGet("chip", "peSizeNM") << "x" << ReportGet("chip", "peSizeNM") << endl;
+	}
+	cout << "User-defined SubArray Size: " << ReportGet("chip", "numRowSubArray") << "x" << ReportGet("chip", "numColSubArray") << endl;
+	cout << endl;
+	cout << "----------------- # of tile used for each layer -----------------" <<  endl;
+	for (int i=1; i<=numLayer; i++) {
+		cout << "layer" << i << ": " << ReportGet(LayerScope(i), "numTile") << endl;
+	}
+	cout << endl;
+
+	cout << "----------------- Speed-up of each layer ------------------" <<  endl;
+	for (int i=1; i<=numLayer; i++) {
+		cout << "layer" << i << ": " << ReportGet(LayerScope(i), "speedUpRow") << ", " << ReportGet(LayerScope(i), "speedUpCol") << endl;
+	}
+	cout << endl;
+	
+	cout << "----------------- Utilization of each layer ------------------" <<  endl;
+	for (int i=1; i<=numLayer; i++) {
+		cout << "layer" << i << ": " << ReportGet(LayerScope(i), "utilization") << endl;
+	}
+	cout << "Memory Utilization of Whole Chip: " << ReportGet("chip", "memoryUtilization")*100 << " % " << endl;
+	cout << endl;
+	cout << "---------------------------- FloorPlan Done ------------------------------" <<  endl;
+	cout << endl;
+	cout << endl;
+	cout << endl;
+}
+
+
+void ReportPrintLayer(int layer) {
+	string scope = LayerScope(layer);
+	string name = "layer" + to_string(layer);
+	cout << name << "'s readLatency is: " << ReportGet(scope, "readLatency")*1e9 << "ns" << endl;
+	cout << name << "'s readDynamicEnergy is: " << ReportGet(scope, "readDynamicEnergy")*1e12 << "pJ" << endl;
+	cout << name << "'s leakagePower is: " << ReportGet(scope, "leakagePower")*1e6 << "uW" << endl;
+	cout << name << "'s leakageEnergy is: " << ReportGet(scope, "leakageEnergy")*1e12 << "pJ" << endl;
+	cout << name << "'s buffer latency is: " << ReportGet(scope, "bufferLatency")*1e9 << "ns" << endl;
+	cout << name << "'s buffer readDynamicEnergy is: " << ReportGet(scope, "bufferReadDynamicEnergy")*1e12 << "pJ" << endl;
+	cout << name << "'s ic latency is: " << ReportGet(scope, "icLatency")*1e9 << "ns" << endl;
+	cout << name << "'s ic readDynamicEnergy is: " << ReportGet(scope, "icReadDynamicEnergy")*1e12 << "pJ" << endl;
+	if (ReportHas(scope, "reprogramLatency")) {
+		cout << name << "'s run-time reprogramming (included above): latency " << ReportGet(scope, "reprogramLatency")*1e9 << "ns, dynamic energy "
+			<< ReportGet(scope, "reprogramDynamicEnergy")*1e12 << "pJ" << endl;
+	}
+	if (ReportHas(scope, "numSampledVector")) {
+		cout << name << "'s sampled input vectors: " << ReportGet(scope, "numSampledVector") << " of " << ReportGet(scope, "numVector") 
+			<< " (" << ReportGet(scope, "numSampledVector")/ReportGet(scope, "numVector")*100 << "%)" << endl;
+		cout << name << "'s readLatency " << param->samplingConfidence*100 << "% confidence interval: +/- " << ReportGet(scope, "readLatencyCI")*1e9 << "ns" << endl;
+		cout << name << "'s readDynamicEnergy " << param->samplingConfidence*100 << "% confidence interval: +/- " << ReportGet(scope, "readDynamicEnergyCI")*1e12 << "pJ" << endl;
+	}
+	if (ReportHas(scope, "criticalPathMean")) {
+		cout << name << "'s subArray critical path under variation (" << param->numTrialMonteCarlo << " trials): nominal " << ReportGet(scope, "criticalPathNominal")*1e9 
+			<< "ns, mean " << ReportGet(scope, "criticalPathMean")*1e9 << "ns, std " << ReportGet(scope, "criticalPathStd")*1e9 
+			<< "ns, 5%-95% [" << ReportGet(scope, "criticalPathP5")*1e9 << ", " << ReportGet(scope, "criticalPathP95")*1e9 << "]ns" << endl;
+		cout << name << "'s readDynamicEnergy under variation: mean " << ReportGet(scope, "readDynamicEnergyMean")*1e12 << "pJ, std " << ReportGet(scope, "readDynamicEnergyStd")*1e12 
+			<< "pJ, 5%-95% [" << ReportGet(scope, "readDynamicEnergyP5")*1e12 << ", " << ReportGet(scope, "readDynamicEnergyP95")*1e12 << "]pJ" << endl;
+	}
+	if (ReportHas(scope, "overlapLatency")) {
+		const char *boundName[] = {"compute", "buffer", "interconnect"};
+		cout << name << "'s roofline: compute " << ReportGet(scope, "computeLatency")*1e9 << "ns, buffer " << ReportGet(scope, "bufferLatency")*1e9 
+			<< "ns, ic " << ReportGet(scope, "icLatency")*1e9 << "ns --> " << boundName[(int) ReportGet(scope, "bound")] << "-bound" << endl;
+		cout << name << "'s readLatency with data movement overlapped is: " << ReportGet(scope, "overlapLatency")*1e9 << "ns (serial " << ReportGet(scope, "readLatency")*1e9 << "ns)" << endl;
+		cout << name << "'s arithmetic intensity: " << ReportGet(scope, "intensityBuffer") << " OP/B of buffer traffic, " << ReportGet(scope, "intensityIC") << " OP/B of ic traffic" << endl;
+		cout << name << "'s ceilings: compute " << ReportGet(scope, "computeRate")*1e-9 << " GOPS, buffer " << ReportGet(scope, "bufferBandwidth")*1e-9 
+			<< " GB/s (global buffer " << ReportGet(scope, "globalBufferBandwidth")*1e-9 << " GB/s), ic " << ReportGet(scope, "icBandwidth")*1e-9 
+			<< " GB/s (global H-tree " << ReportGet(scope, "globalICBandwidth")*1e-9 << " GB/s) --> attainable " << ReportGet(scope, "attainableRate")*1e-9 << " GOPS" << endl;
+	}
+	
+	
+	cout << endl;
+	cout << "************************ Breakdown of Latency and Dynamic Energy *************************" << endl;
+	cout << endl;
+	cout << "----------- ADC (or S/As and precharger for SRAM) readLatency is : " << ReportGet(scope, "latencyADC")*1e9 << "ns" << endl;
+	cout << "----------- Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) readLatency is : " << ReportGet(scope, "latencyAccum")*1e9 << "ns" << endl;
+	cout << "----------- Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) readLatency is : " << ReportGet(scope, "latencyOther")*1e9 << "ns" << endl;
+	cout << "----------- ADC (or S/As and precharger for SRAM) readDynamicEnergy is : " << ReportGet(scope, "energyADC")*1e12 << "pJ" << endl;
+	cout << "----------- Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) readDynamicEnergy is : " << ReportGet(scope, "energyAccum")*1e12 << "pJ" << endl;
+	cout << "----------- Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) readDynamicEnergy is : " << ReportGet(scope, "energyOther")*1e12 << "pJ" << endl;
+	cout << endl;
+	cout << "************************ Breakdown of Latency and Dynamic Energy *************************" << endl;
+	cout << endl;
+}
+
+
+void ReportPrintSummary() {
+	cout << "------------------------------ Summary --------------------------------" <<  endl;
+	cout << endl;
+	cout << "ChipArea : " << ReportGet("chip", "area")*1e12 << "um^2" << endl;
+	cout << "Total IC Area on chip (Global and Tile/PE local): " << ReportGet("chip", "areaIC")*1e12 << "um^2" << endl;
+	cout << "Total ADC (or S/As and precharger for SRAM) Area on chip : " << ReportGet("chip", "areaADC")*1e12 << "um^2" << endl;
+	cout << "Total Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) on chip : " << ReportGet("chip", "areaAccum")*1e12 << "um^2" << endl;
+	cout << "Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) : " << ReportGet("chip", "areaOther")*1e12 << "um^2" << endl;
+	cout << endl;
+	cout << "Chip total readLatency is: " << ReportGet("chip", "readLatency")*1e9 << "ns" << endl;
+	cout << "Chip total readDynamicEnergy is: " << ReportGet("chip", "readDynamicEnergy")*1e12 << "pJ" << endl;
+	cout << "Chip total leakage Energy is: " << ReportGet("chip", "leakageEnergy")*1e12 << "pJ" << endl;
+	cout << "Chip total leakage Power is: " << ReportGet("chip", "leakagePower")*1e6 << "uW" << endl;
+	cout << "Chip buffer readLatency is: " << ReportGet("chip", "bufferLatency")*1e9 << "ns" << endl;
+	cout << "Chip buffer readDynamicEnergy is: " << ReportGet("chip", "bufferReadDynamicEnergy")*1e12 << "pJ" << endl;
+	cout << "Chip ic readLatency is: " << ReportGet("chip", "icLatency")*1e9 << "ns" << endl;
+	cout << "Chip ic readDynamicEnergy is: " << ReportGet("chip", "icReadDynamicEnergy")*1e12 << "pJ" << endl;
+	if (ReportHas("chip", "readDynamicEnergyMean")) {
+		cout << "Chip total readDynamicEnergy under variation (" << param->numTrialMonteCarlo << " trials): mean " << ReportGet("chip", "readDynamicEnergyMean")*1e12 
+			<< "pJ, std " << ReportGet("chip", "readDynamicEnergyStd")*1e12 << "pJ, 5%-95% [" << ReportGet("chip", "readDynamicEnergyP5")*1e12 << ", " << ReportGet("chip", "readDynamicEnergyP95")*1e12 << "]pJ" << endl;
+	}
+	if (ReportHas("chip", "overlapLatency")) {
+		cout << "Chip total readLatency with data movement overlapped is: " << ReportGet("chip", "overlapLatency")*1e9 << "ns (" << ReportGet("chip", "numComputeBoundLayer") 
+			<< " compute-bound, " << ReportGet("chip", "numBufferBoundLayer") << " buffer-bound, " << ReportGet("chip", "numICBoundLayer") << " interconnect-bound layers)" << endl;
+	}
+	
+	cout << endl;
+	cout << "************************ Breakdown of Latency and Dynamic Energy *************************" << endl;
+	cout << endl;
+	cout << "----------- ADC (or S/As and precharger for SRAM) readLatency is : " << ReportGet("chip", "latencyADC")*1e9 << "ns" << endl;
+	cout << "----------- Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) readLatency is : " << ReportGet("chip", "latencyAccum")*1e9 << "ns" << endl;
+	cout << "----------- Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) readLatency is : " << ReportGet("chip", "latencyOther")*1e9 << "ns" << endl;
+	cout << "----------- ADC (or S/As and precharger for SRAM) readDynamicEnergy is : " << ReportGet("chip", "energyADC")*1e12 << "pJ" << endl;
+	cout << "----------- Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) readDynamicEnergy is : " << ReportGet("chip", "energyAccum")*1e12 << "pJ" << endl;
+	cout << "----------- Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) readDynamicEnergy is : " << ReportGet("chip", "energyOther")*1e12 << "pJ" << endl;
+	cout << endl;
+	cout << "************************ Breakdown of Latency and Dynamic Energy *************************" << endl;
+	cout << endl;
+}
+
+
+void ReportPrintPerformance() {
+	cout << endl;
+	cout << "----------------------------- Performance -------------------------------" << endl;
+	cout << "Energy Efficiency TOPS/W (Layer-by-Layer Process): " << ReportGet("performance", "energyEfficiency") << endl;
+	cout << "Throughput FPS (Layer-by-Layer Process): " << ReportGet("performance", "throughput") << endl;
+	if (ReportHas("pipeline", "bottleneckLatency")) {
+		double batchSize = ReportGet("pipeline", "batchSize");
+		cout << endl;
+		cout << "Pipeline bottleneck stage: layer" << ReportGet("pipeline", "bottleneckLayer") << " (" << ReportGet("pipeline", "bottleneckLatency")*1e9 << "ns)" << endl;
+		cout << "Pipeline latency per image: " << ReportGet("pipeline", "imageLatency")*1e9 << "ns" << endl;
+		cout << "Pipeline latency of batch (" << batchSize << " images): " << ReportGet("pipeline", "batchLatency")*1e9 << "ns" << endl;
+		cout << "Pipeline fill and drain: " << ReportGet("pipeline", "fillDrainLatency")*1e9 << "ns" << endl;
+		cout << "Pipeline leakage Energy per image: " << ReportGet("pipeline", "leakageEnergy")*1e12 << "pJ" << endl;
+		cout << "Energy Efficiency TOPS/W (Pipelined Process): " << ReportGet("pipeline", "energyEfficiency") << endl;
+		cout << "Throughput FPS (Pipelined Process, steady-state): " << ReportGet("pipeline", "throughput") << endl;
+		cout << "Throughput FPS (Pipelined Process, batch of " << batchSize << "): " << ReportGet("pipeline", "throughputBatch") << endl;
+	}
+}
+
+
+void ReportPrintDuplication(int numLayer) {
+	cout << endl;
+	cout << "------------------------- Layer-Balancing Duplication --------------------------" << endl;
+	for (int i=1; i<=numLayer; i++) {
+		string scope = LayerScope(i);
+		cout << "layer" << i << ": duplication " << ReportGet(scope, "duplication") << ", # of tile " << ReportGet(scope, "numTileDuplicated") 
+			<< ", stage latency " << ReportGet(scope, "readLatency")*1e9 << "ns --> " << ReportGet(scope, "readLatencyDuplicated")*1e9 << "ns" << endl;
+	}
+	cout << "ChipArea after duplication : " << ReportGet("duplication", "area")*1e12 << "um^2" << endl;
+	cout << "Throughput FPS (Pipelined Process, steady-state) before / after duplication: " << ReportGet("duplication", "throughputBefore") << " / " << ReportGet("duplication", "throughputAfter") << endl;
+	cout << "Throughput FPS per mm^2 before / after duplication: " << ReportGet("duplication", "throughputPerAreaBefore") << " / " << ReportGet("duplication", "throughputPerAreaAfter") << endl;
+	cout << "Leakage energy per image (Pipelined Process) before / after duplication: " << ReportGet("duplication", "leakageEnergyBefore")*1e12 << "pJ / " 
+		<< ReportGet("duplication", "leakageEnergyAfter")*1e12 << "pJ" << endl;
+	cout << "Energy Efficiency TOPS/W (Pipelined Process) before / after duplication: " << ReportGet("duplication", "energyEfficiencyBefore") << " / " << ReportGet("duplication", "energyEfficiencyAfter") << endl;
+}
+
+
+void ReportPrintMultiChip(int numLayer, int numChip) {
+	cout << endl;
+	cout << "------------------------- Multi-Chip Partition (" << numChip << " chips of at most " << ReportGet("multiChip", "maxAreaPerChip")*1e12 << "um^2) --------------------------" << endl;
+	for (int i=1; i<=numLayer; i++) {
+		string scope = LayerScope(i);
+		cout << "layer" << i << ": chip " << ReportGet(scope, "firstChip");
+		if (ReportGet(scope, "lastChip") > ReportGet(scope, "firstChip")) {
+			cout << " - " << ReportGet(scope, "lastChip");
+		}
+		cout << ", link traffic at the input " << ReportGet(scope, "linkInputBit") << "bit (" << ReportGet(scope, "linkLatency")*1e9 << "ns)" << endl;
+	}
+	for (int c=1; c<=numChip; c++) {
+		string scope = "multiChip/chip" + to_string(c);
+		cout << "chip" << c << ": # of tile " << ReportGet(scope, "numTile") << ", area " << ReportGet(scope, "area")*1e12 << "um^2 (" << ReportGet(scope, "areaUtilization")*100 
+			<< "% of the cap), memory utilization " << ReportGet(scope, "memoryUtilization")*100 << "%, stage latency " << ReportGet(scope, "stageLatency")*1e9 
+			<< "ns (busy " << ReportGet(scope, "busyRatio")*100 << "%)" << endl;
+	}
+	cout << "Inter-chip link energy per image: " << ReportGet("multiChip", "linkEnergy")*1e12 << "pJ" << endl;
+	cout << "Multi-chip leakage energy per image (idle tiles and the periphery of each chip): " << ReportGet("multiChip", "leakageEnergy")*1e12 << "pJ" << endl;
+	cout << "Multi-chip latency per image: " << ReportGet("multiChip", "imageLatency")*1e9 << "ns" << endl;
+	cout << "Energy Efficiency TOPS/W (Multi-Chip Pipelined Process): " << ReportGet("multiChip", "energyEfficiency") << endl;
+	cout << "Throughput FPS (Multi-Chip Pipelined Process, steady-state): " << ReportGet("multiChip", "throughput") << endl;
+}
+
+
+void ReportPrintStreaming(int numLayer) {
+	cout << endl;
+	cout << "------------------------- DRAM Weight Streaming (chip of " << ReportGet("streaming", "chipArea")*1e12 << "um^2) --------------------------" << endl;
+	for (int i=1; i<=numLayer; i++) {
+		string scope = LayerScope(i);
+		cout << "layer" << i << ": " << (ReportGet(scope, "weightResident")? "resident" : "streamed") << ", " << ReportGet(scope, "numWeightPass") << " pass(es), array write latency " << ReportGet(scope, "weightWriteLatency")*1e9 << "ns, dynamic energy " 
+			<< ReportGet(scope, "weightWriteDynamicEnergy")*1e12 << "pJ, latency with the exposed weight loads " << ReportGet(scope, "streamLatency")*1e9 << "ns" << endl;
+	}
+	cout << "Weights streamed from DRAM per image: " << ReportGet("streaming", "dramBit") << "bit, DRAM energy " << ReportGet("streaming", "dramEnergy")*1e12 
+		<< "pJ, array write energy " << ReportGet("streaming", "writeDynamicEnergy")*1e12 << "pJ" << endl;
+	cout << "Weight-streaming leakage energy per image: " << ReportGet("streaming", "leakageEnergy")*1e12 << "pJ" << endl;
+	cout << "Weight-streaming latency per image: " << ReportGet("streaming", "imageLatency")*1e9 << "ns" << endl;
+	cout << "Energy Efficiency TOPS/W (Weight Streaming): " << ReportGet("streaming", "energyEfficiency") << endl;
+	cout << "Throughput FPS (Weight Streaming): " << ReportGet("streaming", "throughput") << " (" << ReportGet("streaming", "throughputPenalty") 
+		<< "x the latency of the all-resident chip)" << endl;
+}
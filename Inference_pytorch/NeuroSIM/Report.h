@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#ifndef REPORT_H_
+#define REPORT_H_
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*** Structured results: every metric is recorded once, in SI units, under a scope ("chip", "layer1", "layer1/tile0_0", ...) ***/
+struct ReportMetric {
+	string name;
+	double value;
+	string unit;
+};
+
+struct ReportScope {
+	string name;
+	vector<ReportMetric> metrics;
+};
+
+extern vector<ReportScope> reportScopes;
+
+/*** Functions ***/
+void ReportSet(const string &scope, const string &metric, double value, const string &unit);
+void ReportSetBreakdown(const string &scope, double readLatency, double readDynamicEnergy, double bufferLatency, double bufferDynamicEnergy, double icLatency, double icDynamicEnergy,
+						double latencyADC, double latencyAccum, double latencyOther, double energyADC, double energyAccum, double energyOther);
+double ReportGet(const string &scope, const string &metric);
+bool ReportHas(const string &scope, const string &metric);
+string LayerScope(int layer);
+void ReportWrite(const string &filename);
+
+/*** Human-readable renderers over the recorded results ***/
+void ReportPrintFloorPlan(int numLayer);
+void ReportPrintLayer(int layer);
+void ReportPrintSummary();
+void ReportPrintPerformance();
+void ReportPrintDuplication(int numLayer);
+void ReportPrintMultiChip(int numLayer, int numChip);
+void ReportPrintStreaming(int numLayer);
+
+#endif /* REPORT_H_ */
@@ -42,6 +42,8 @@
 #include "constant.h"
 #include "formula.h"
 #include "SubArray.h"
+#include "Breakdown.h"
+#include "Profile.h"
 #include "Param.h"
 
 
@@ -49,7 +51,7 @@ using namespace std;
 
 extern Param *param;
 
-SubArray::SubArray(InputParameter& _inputParameter, Technology& _tech, MemCell& _cell):
+SubArray::SubArray(InputParameter& _inputParameter, const Technology& _tech, MemCell& _cell):
 						inputParameter(_inputParameter), tech(_tech), cell(_cell),
 						wlDecoder(_inputParameter, _tech, _cell),
 						wlDecoderOutput(_inputParameter, _tech, _cell),
@@ -75,7 +77,20 @@ SubArray::SubArray(InputParameter& _inputParameter, Technology& _tech, MemCell&
 						multilevelSenseAmp(_inputParameter, _tech, _cell),
 						multilevelSAEncoder(_inputParameter, _tech, _cell){
 	initialized = false;
+	// options the PE does not set, and results only some of the modes compute: otherwise they depend on what was in the heap before
+	FPGA = false;
+	spikingMode = NONSPIKING;
+	numBitPerReadPulse = 1;     // bit-serial input unless the PE applies several input bits per read pulse
+	readLatencyDAC = readDynamicEnergyDAC = 0;
+	activityRowWrite = activityColWrite = 0;
 	readDynamicEnergyArray = writeDynamicEnergyArray = 0;
+	writeLatencyArray = 0;
+	areaADC = areaAccum = areaOther = 0;
+	readLatencyADC = readLatencyAccum = readLatencyOther = 0;
+	readDynamicEnergyADC = readDynamicEnergyAccum = readDynamicEnergyOther = 0;
+	for (int i=0; i<numBreakdown; i++) {
+		breakdownLatency[i] = breakdownEnergy[i] = 0;
+	}
 }
 
 void SubArray::Initialize(int _numRow, int _numCol, double _unitWireRes){  //initialization module
@@ -144,12 +159,12 @@ void SubArray::Initialize(int _numRow, int _numCol, double _unitWireRes){  //ini
 		if (conventionalSequential) {
 			wlDecoder.Initialize(REGULAR_ROW, (int)ceil(log2(numRow)), false, false);
 			senseAmp.Initialize(numCol, false, cell.minSenseVoltage, lengthRow/numCol, clkFreq, numReadCellPerOperationNeuro);
-			int adderBit = (int)ceil(log2(numRow)) + 1;	
+			int adderBit = (int)ceil(log2(numRow)) + numBitPerReadPulse;	
 			int numAdder = numCol/numCellPerSynapse;
 			dff.Initialize((adderBit+1)*numAdder, clkFreq);	
 			adder.Initialize(adderBit, numAdder);
 			if (numReadPulse > 1) {
-				shiftAdd.Initialize(numAdder, adderBit+numReadPulse+1, clkFreq, spikingMode, numReadPulse);
+				shiftAdd.Initialize(numAdder, adderBit+numReadPulse*numBitPerReadPulse+1, clkFreq, spikingMode, numReadPulse, numBitPerReadPulse);
 			}
 		} else if (conventionalParallel) {
 			wlSwitchMatrix.Initialize(ROW_MODE, numRow, resCellAccess/numRow/2, true, false, activityRowRead, activityColWrite, numWriteCellPerOperationMemory, numWriteCellPerOperationNeuro, 1, clkFreq);
@@ -158,7 +173,7 @@ void SubArray::Initialize(int _numRow, int _numCol, double _unitWireRes){  //ini
 			multilevelSenseAmp.Initialize(numCol/numColMuxed, levelOutput, clkFreq, numReadCellPerOperationNeuro, true);
 			multilevelSAEncoder.Initialize(levelOutput, numCol/numColMuxed);
 			if (numReadPulse > 1) {
-				shiftAdd.Initialize(ceil(numCol/numColMuxed), log2(levelOutput)+numReadPulse+1, clkFreq, spikingMode, numReadPulse);
+				shiftAdd.Initialize(ceil(numCol/numColMuxed), log2(levelOutput)+numReadPulse*numBitPerReadPulse+1, clkFreq, spikingMode, numReadPulse, numBitPerReadPulse);
 			}
 		} else if (BNNsequentialMode || XNORsequentialMode) {
 			wlDecoder.Initialize(REGULAR_ROW, (int)ceil(log2(numRow)), false, false);
@@ -176,7 +191,7 @@ void SubArray::Initialize(int _numRow, int _numCol, double _unitWireRes){  //ini
 			multilevelSenseAmp.Initialize(numCol/numColMuxed, levelOutput, clkFreq, numReadCellPerOperationNeuro, true);
 			multilevelSAEncoder.Initialize(levelOutput, numCol/numColMuxed);
 			if (numReadPulse > 1) {
-				shiftAdd.Initialize(ceil(numCol/numColMuxed), log2(levelOutput)+numReadPulse+1, clkFreq, spikingMode, numReadPulse);
+				shiftAdd.Initialize(ceil(numCol/numColMuxed), log2(levelOutput)+numReadPulse*numBitPerReadPulse+1, clkFreq, spikingMode, numReadPulse, numBitPerReadPulse);
 			}
 		}
 		precharger.Initialize(numCol, resCol, activityColWrite, numReadCellPerOperationNeuro, numWriteCellPerOperationNeuro);
@@ -214,7 +229,7 @@ void SubArray::Initialize(int _numRow, int _numCol, double _unitWireRes){  //ini
 			int numAdder = (int)ceil(numCol/numColMuxed);   // numCol is divisible by numCellPerSynapse
 			int numInput = numAdder;        //XXX input number of MUX, 
 			double resTg = cell.resMemCellOn / 2;     //transmission gate resistance
-			int adderBit = (int)ceil(log2(numRow)) + avgWeightBit;  
+			int adderBit = (int)ceil(log2(numRow)) + avgWeightBit + numBitPerReadPulse-1;  
 			
 			wlDecoder.Initialize(REGULAR_ROW, (int)ceil(log2(numRow)), false, false);          
 			if (cell.accessType == CMOS_access) {
@@ -234,7 +249,7 @@ void SubArray::Initialize(int _numRow, int _numCol, double _unitWireRes){  //ini
 			dff.Initialize((adderBit+1)*numAdder, clkFreq); 
 			adder.Initialize(adderBit, numAdder);
 			if (numReadPulse > 1) {
-				shiftAdd.Initialize(numAdder, adderBit+numReadPulse+1, clkFreq, spikingMode, numReadPulse);
+				shiftAdd.Initialize(numAdder, adderBit+numReadPulse*numBitPerReadPulse+1, clkFreq, spikingMode, numReadPulse, numBitPerReadPulse);
 			}
 		} else if (conventionalParallel) { 
 		
@@ -252,7 +267,7 @@ void SubArray::Initialize(int _numRow, int _numCol, double _unitWireRes){  //ini
 			multilevelSAEncoder.Initialize(levelOutput, numCol/numColMuxed);
 			
 			if (numReadPulse > 1) {
-				shiftAdd.Initialize(ceil(numCol/numColMuxed), log2(levelOutput)+numReadPulse+1, clkFreq, spikingMode, numReadPulse);
+				shiftAdd.Initialize(ceil(numCol/numColMuxed), log2(levelOutput)+numReadPulse*numBitPerReadPulse+1, clkFreq, spikingMode, numReadPulse, numBitPerReadPulse);
 			}
 			
 		} else if (BNNsequentialMode || XNORsequentialMode) {       
@@ -303,13 +318,48 @@ void SubArray::Initialize(int _numRow, int _numCol, double _unitWireRes){  //ini
 			multilevelSenseAmp.Initialize(numCol/numColMuxed, levelOutput, clkFreq, numReadCellPerOperationNeuro, true);
 			multilevelSAEncoder.Initialize(levelOutput, numCol/numColMuxed);
 			if (numReadPulse > 1) {
-				shiftAdd.Initialize(ceil(numCol/numColMuxed), log2(levelOutput)+numReadPulse+1, clkFreq, spikingMode, numReadPulse);
+				shiftAdd.Initialize(ceil(numCol/numColMuxed), log2(levelOutput)+numReadPulse*numBitPerReadPulse+1, clkFreq, spikingMode, numReadPulse, numBitPerReadPulse);
 			}
 		}
 	} 
+	SelectKernel();
 	initialized = true;  //finish initialization
 }
 
+// every (cell type, operation mode, access type) has its own instantiation of the read kernels, so the per-vector calls do not branch on them
+#define SUBARRAY_KERNEL_MODES(Kernel, SRAMCell, CMOSAccess) {&SubArray::Kernel<SRAMCell, 0, CMOSAccess>, &SubArray::Kernel<SRAMCell, 1, CMOSAccess>, \
+		&SubArray::Kernel<SRAMCell, 2, CMOSAccess>, &SubArray::Kernel<SRAMCell, 3, CMOSAccess>, &SubArray::Kernel<SRAMCell, 4, CMOSAccess>, \
+		&SubArray::Kernel<SRAMCell, 5, CMOSAccess>, &SubArray::Kernel<SRAMCell, 6, CMOSAccess>}
+#define SUBARRAY_KERNEL_TABLE(Kernel) {{SUBARRAY_KERNEL_MODES(Kernel, false, false), SUBARRAY_KERNEL_MODES(Kernel, false, true)}, \
+		{SUBARRAY_KERNEL_MODES(Kernel, true, false), SUBARRAY_KERNEL_MODES(Kernel, true, true)}}
+
+void SubArray::SelectKernel() {
+	typedef void (SubArray::*LatencyKernel)(double, const vector<double> &);
+	typedef void (SubArray::*PowerKernel)(const vector<double> &);
+	static const LatencyKernel latencyTable[2][2][7] = SUBARRAY_KERNEL_TABLE(CalculateLatencyKernel);     // [SRAM][CMOS access][operation mode]
+	static const PowerKernel powerTable[2][2][7] = SUBARRAY_KERNEL_TABLE(CalculatePowerKernel);
+	
+	// same precedence as the mode checks inside the kernels, 0: none of the modes
+	int operationMode = 0;
+	if (conventionalSequential) {
+		operationMode = 1;
+	} else if (conventionalParallel) {
+		operationMode = 2;
+	} else if (BNNsequentialMode) {
+		operationMode = 3;
+	} else if (BNNparallelMode) {
+		operationMode = 4;
+	} else if (XNORsequentialMode) {
+		operationMode = 5;
+	} else if (XNORparallelMode) {
+		operationMode = 6;
+	}
+	bool SRAMCell = (cell.memCellType == Type::SRAM);
+	bool CMOSAccess = (cell.accessType == CMOS_access);
+	latencyKernel = latencyTable[SRAMCell][CMOSAccess][operationMode];
+	powerKernel = powerTable[SRAMCell][CMOSAccess][operationMode];
+}
+
 
 
 void SubArray::CalculateArea() {  //calculate layout area for total design
@@ -542,932 +592,1012 @@ void SubArray::CalculateArea() {  //calculate layout area for total design
 }
 
 void SubArray::CalculateLatency(double columnRes, const vector<double> &columnResistance) {   //calculate latency for different mode 
+	PROFILE_SCOPE("SubArray::CalculateLatency");
 	if (!initialized) {
 		cout << "[Subarray] Error: Require initialization first!" << endl;
 	} else {
 		
 		readLatency = 0;
 		writeLatency = 0;
+		readLatencyADC = readLatencyAccum = readLatencyOther = 0;
+		(this->*latencyKernel)(columnRes, columnResistance);
+		
+		readLatencyDAC = 0;
+		if (numBitPerReadPulse > 1) {
+			readLatencyDAC = (pow(2, numBitPerReadPulse)-2)*RowDriverUnit(wlSwitchMatrix.readLatency + wlNewSwitchMatrix.readLatency + wlDecoderDriver.readLatency 
+																			+ wlNewDecoderDriver.readLatency, wlDecoder.readLatency);
+			readLatency += readLatencyDAC;
+			readLatencyOther += readLatencyDAC;
+		}
+	}
+}
 
-		if (cell.memCellType == Type::SRAM) {
-			if (conventionalSequential) {
-				int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				wlDecoder.CalculateLatency(1e20, capRow1, NULL, numRow*activityRowRead, numRow*activityRowWrite);
-				
-				precharger.CalculateLatency(1e20, capCol, numReadOperationPerRow*numRow*activityRowRead, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
-				senseAmp.CalculateLatency(numReadOperationPerRow*numRow*activityRowRead);
-				dff.CalculateLatency(1e20, numReadOperationPerRow*numRow*activityRowRead);
-				adder.CalculateLatency(1e20, dff.capTgDrain, numReadOperationPerRow*numRow*activityRowRead);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculateLatency(1);	
-				}
-				// Read
-				double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
-				double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
-				tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
-				double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
-				double beta = 1 / (resPullDown * gm);
-				double colRamp = 0;
-				colDelay = horowitz(tau, beta, wlDecoder.rampOutput, &colRamp) * numReadOperationPerRow * numRow * numReadPulse * activityRowRead;
-
-				readLatency += wlDecoder.readLatency;
-				readLatency += precharger.readLatency;
-				readLatency += colDelay;
-				readLatency += senseAmp.readLatency;
-				readLatency += adder.readLatency;
-				readLatency += dff.readLatency;
-				readLatency += shiftAdd.readLatency;
-				
-				readLatencyADC = precharger.readLatency + colDelay + senseAmp.readLatency;
-				readLatencyAccum = adder.readLatency + dff.readLatency + shiftAdd.readLatency;
-				readLatencyOther = wlDecoder.readLatency;
-				
-				// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
-				double resPull;
-				resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
-				tau = resPull * cell.capSRAMCell;
-				gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
-				beta = 1 / (resPull * gm);
+double SubArray::RowDriverUnit(double driver, double decoder) {
+	// a multi-level input (numBitPerReadPulse > 1) comes from a DAC on each row: 2^numBitPerReadPulse-1 unit drivers (thermometer code), 
+	// each costing the 1-bit wordline drive, the same way the multilevelSenseAmp ladder grows with its levels; the bit-serial drive already pays for one of them
+	// SRAM rows in the sequential modes are driven by the decoder itself
+	return (driver > 0)? driver : decoder;
+}
 
-				// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
-				// writeLatency += wlDecoder.writeLatency;
-				// writeLatency += precharger.writeLatency;
-				// writeLatency += sramWriteDriver.writeLatency;
-				
-			} else if (conventionalParallel) {
-				int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				
-				wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				precharger.CalculateLatency(1e20, capCol, numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
-				
-				mux.CalculateLatency(0, 0, numColMuxed);
-				muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
-				
-				multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
-				multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculateLatency(numColMuxed);	
-				}
-				// Read
-				double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
-				double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
-				tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
-				double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
-				double beta = 1 / (resPullDown * gm);
-				double colRamp = 0;
-				colDelay = horowitz(tau, beta, wlSwitchMatrix.rampOutput, &colRamp) * numReadPulse;
+template <bool SRAMCell, int operationMode, bool CMOSAccess>
+void SubArray::CalculateLatencyKernel(double columnRes, const vector<double> &columnResistance) {
+	// compile-time copies of the mode flags: every branch on them below folds away in each instantiation
+	const bool conventionalSequential = (operationMode == 1);
+	const bool conventionalParallel = (operationMode == 2);
+	const bool BNNsequentialMode = (operationMode == 3);
+	const bool BNNparallelMode = (operationMode == 4);
+	const bool XNORsequentialMode = (operationMode == 5);
+	const bool XNORparallelMode = (operationMode == 6);
+	if (SRAMCell) {
+		if (conventionalSequential) {
+			int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			wlDecoder.CalculateLatency(1e20, capRow1, NULL, numRow*activityRowRead, numRow*activityRowWrite);
+			
+			precharger.CalculateLatency(1e20, capCol, numReadOperationPerRow*numRow*activityRowRead, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
+			senseAmp.CalculateLatency(numReadOperationPerRow*numRow*activityRowRead);
+			dff.CalculateLatency(1e20, numReadOperationPerRow*numRow*activityRowRead);
+			adder.CalculateLatency(1e20, dff.capTgDrain, numReadOperationPerRow*numRow*activityRowRead);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculateLatency(1);	
+			}
+			// Read
+			double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
+			double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
+			tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
+			double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
+			double beta = 1 / (resPullDown * gm);
+			double colRamp = 0;
+			colDelay = horowitz(tau, beta, wlDecoder.rampOutput, &colRamp) * numReadOperationPerRow * numRow * numReadPulse * activityRowRead;
 
-				readLatency = 0;
-				readLatency += MAX(wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
-				readLatency += precharger.readLatency;
-				readLatency += colDelay;
-				readLatency += multilevelSenseAmp.readLatency;
-				readLatency += multilevelSAEncoder.readLatency;
-				readLatency += shiftAdd.readLatency;
-				
-				readLatencyADC = precharger.readLatency + colDelay + multilevelSenseAmp.readLatency + multilevelSAEncoder.readLatency;
-				readLatencyAccum = shiftAdd.readLatency;
-				readLatencyOther = MAX(wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
+			readLatency += wlDecoder.readLatency;
+			readLatency += precharger.readLatency;
+			readLatency += colDelay;
+			readLatency += senseAmp.readLatency;
+			readLatency += adder.readLatency;
+			readLatency += dff.readLatency;
+			readLatency += shiftAdd.readLatency;
+			
+			readLatencyADC = precharger.readLatency + colDelay + senseAmp.readLatency;
+			readLatencyAccum = adder.readLatency + dff.readLatency + shiftAdd.readLatency;
+			readLatencyOther = wlDecoder.readLatency;
+			
+			// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
+			double resPull;
+			resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
+			tau = resPull * cell.capSRAMCell;
+			gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
+			beta = 1 / (resPull * gm);
 
-				// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
-				double resPull;
-				resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
-				tau = resPull * cell.capSRAMCell;
-				gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
-				beta = 1 / (resPull * gm);
-				
-				// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
-				// writeLatency += wlSwitchMatrix.writeLatency;
-				// writeLatency += precharger.writeLatency;
-				// writeLatency += sramWriteDriver.writeLatency;
-				
-			} else if (BNNsequentialMode || XNORsequentialMode) {
-				int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				
-				wlDecoder.CalculateLatency(1e20, capRow1, NULL, numRow*activityRowRead, numRow*activityRowWrite);
-				precharger.CalculateLatency(1e20, capCol, numReadOperationPerRow*numRow*activityRowRead, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
-				senseAmp.CalculateLatency(numReadOperationPerRow*numRow*activityRowRead);
-				dff.CalculateLatency(1e20, numReadOperationPerRow*numRow*activityRowRead);
-				adder.CalculateLatency(1e20, dff.capTgDrain, numReadOperationPerRow*numRow*activityRowRead);
-				
-				// Read
-				double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
-				double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
-				tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
-				double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
-				double beta = 1 / (resPullDown * gm);
-				double colRamp = 0;
-				colDelay = horowitz(tau, beta, wlDecoder.rampOutput, &colRamp) * numReadOperationPerRow * numRow * activityRowRead;
+			// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
+			// writeLatency += wlDecoder.writeLatency;
+			// writeLatency += precharger.writeLatency;
+			// writeLatency += sramWriteDriver.writeLatency;
+			
+		} else if (conventionalParallel) {
+			int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			
+			wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			precharger.CalculateLatency(1e20, capCol, numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
+			
+			mux.CalculateLatency(0, 0, numColMuxed);
+			muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
+			
+			multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
+			multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculateLatency(numColMuxed);	
+			}
+			// Read
+			double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
+			double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
+			tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
+			double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
+			double beta = 1 / (resPullDown * gm);
+			double colRamp = 0;
+			colDelay = horowitz(tau, beta, wlSwitchMatrix.rampOutput, &colRamp) * numReadPulse;
 
-				readLatency += wlDecoder.readLatency;
-				readLatency += precharger.readLatency;
-				readLatency += colDelay;
-				readLatency += senseAmp.readLatency;
-				readLatency += adder.readLatency;
-				readLatency += dff.readLatency;
-				
-				// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
-				double resPull;
-				resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
-				tau = resPull * cell.capSRAMCell;
-				gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
-				beta = 1 / (resPull * gm);
+			readLatency = 0;
+			readLatency += MAX(wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
+			readLatency += precharger.readLatency;
+			readLatency += colDelay;
+			readLatency += multilevelSenseAmp.readLatency;
+			readLatency += multilevelSAEncoder.readLatency;
+			readLatency += shiftAdd.readLatency;
+			
+			readLatencyADC = precharger.readLatency + colDelay + multilevelSenseAmp.readLatency + multilevelSAEncoder.readLatency;
+			readLatencyAccum = shiftAdd.readLatency;
+			readLatencyOther = MAX(wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
 
-				// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
-				// writeLatency += wlDecoder.writeLatency;
-				// writeLatency += precharger.writeLatency;
-				// writeLatency += sramWriteDriver.writeLatency;
-				
-			} else if (BNNparallelMode || XNORparallelMode) {
-				int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				
-				wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				precharger.CalculateLatency(1e20, capCol, numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
-				multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
-				multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
-				
-				// Read
-				double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
-				double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
-				tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
-				double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
-				double beta = 1 / (resPullDown * gm);
-				double colRamp = 0;
-				colDelay = horowitz(tau, beta, wlSwitchMatrix.rampOutput, &colRamp) * numReadOperationPerRow * numRow * activityRowRead;
+			// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
+			double resPull;
+			resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
+			tau = resPull * cell.capSRAMCell;
+			gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
+			beta = 1 / (resPull * gm);
+			
+			// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
+			// writeLatency += wlSwitchMatrix.writeLatency;
+			// writeLatency += precharger.writeLatency;
+			// writeLatency += sramWriteDriver.writeLatency;
+			
+		} else if (BNNsequentialMode || XNORsequentialMode) {
+			int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			
+			wlDecoder.CalculateLatency(1e20, capRow1, NULL, numRow*activityRowRead, numRow*activityRowWrite);
+			precharger.CalculateLatency(1e20, capCol, numReadOperationPerRow*numRow*activityRowRead, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
+			senseAmp.CalculateLatency(numReadOperationPerRow*numRow*activityRowRead);
+			dff.CalculateLatency(1e20, numReadOperationPerRow*numRow*activityRowRead);
+			adder.CalculateLatency(1e20, dff.capTgDrain, numReadOperationPerRow*numRow*activityRowRead);
+			
+			// Read
+			double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
+			double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
+			tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
+			double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
+			double beta = 1 / (resPullDown * gm);
+			double colRamp = 0;
+			colDelay = horowitz(tau, beta, wlDecoder.rampOutput, &colRamp) * numReadOperationPerRow * numRow * activityRowRead;
 
-				readLatency = 0;
-				readLatency += wlSwitchMatrix.readLatency;
-				readLatency += precharger.readLatency;
-				readLatency += colDelay;
-				readLatency += multilevelSenseAmp.readLatency;
-				readLatency += multilevelSAEncoder.readLatency;
+			readLatency += wlDecoder.readLatency;
+			readLatency += precharger.readLatency;
+			readLatency += colDelay;
+			readLatency += senseAmp.readLatency;
+			readLatency += adder.readLatency;
+			readLatency += dff.readLatency;
+			
+			// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
+			double resPull;
+			resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
+			tau = resPull * cell.capSRAMCell;
+			gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
+			beta = 1 / (resPull * gm);
 
-				// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
-				double resPull;
-				resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
-				tau = resPull * cell.capSRAMCell;
-				gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
-				beta = 1 / (resPull * gm);
-				
-				// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
-				// writeLatency += wlSwitchMatrix.writeLatency;
-				// writeLatency += precharger.writeLatency;
-				// writeLatency += sramWriteDriver.writeLatency;
-				
-			} else {
-				int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				
-				wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				precharger.CalculateLatency(1e20, capCol, numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
-				multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
-				multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculateLatency(1);	
-				}
-				// Read
-				double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
-				double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
-				tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
-				double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
-				double beta = 1 / (resPullDown * gm);
-				double colRamp = 0;
-				colDelay = horowitz(tau, beta, wlDecoder.rampOutput, &colRamp) * numReadOperationPerRow * numRow * numReadPulse * activityRowRead;
+			// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
+			// writeLatency += wlDecoder.writeLatency;
+			// writeLatency += precharger.writeLatency;
+			// writeLatency += sramWriteDriver.writeLatency;
+			
+		} else if (BNNparallelMode || XNORparallelMode) {
+			int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			
+			wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			precharger.CalculateLatency(1e20, capCol, numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
+			multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
+			multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
+			
+			// Read
+			double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
+			double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
+			tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
+			double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
+			double beta = 1 / (resPullDown * gm);
+			double colRamp = 0;
+			colDelay = horowitz(tau, beta, wlSwitchMatrix.rampOutput, &colRamp) * numReadOperationPerRow * numRow * activityRowRead;
 
-				readLatency = 0;
-				readLatency += wlSwitchMatrix.readLatency;
-				readLatency += precharger.readLatency;
-				readLatency += colDelay;
-				readLatency += multilevelSenseAmp.readLatency;
-				readLatency += multilevelSAEncoder.readLatency;
-				readLatency += shiftAdd.readLatency;
+			readLatency = 0;
+			readLatency += wlSwitchMatrix.readLatency;
+			readLatency += precharger.readLatency;
+			readLatency += colDelay;
+			readLatency += multilevelSenseAmp.readLatency;
+			readLatency += multilevelSAEncoder.readLatency;
 
-				// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
-				double resPull;
-				resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
-				tau = resPull * cell.capSRAMCell;
-				gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
-				beta = 1 / (resPull * gm);
-				
-				// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
-				// writeLatency += wlSwitchMatrix.writeLatency;
-				// writeLatency += precharger.writeLatency;
-				// writeLatency += sramWriteDriver.writeLatency;
+			// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
+			double resPull;
+			resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
+			tau = resPull * cell.capSRAMCell;
+			gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
+			beta = 1 / (resPull * gm);
+			
+			// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
+			// writeLatency += wlSwitchMatrix.writeLatency;
+			// writeLatency += precharger.writeLatency;
+			// writeLatency += sramWriteDriver.writeLatency;
+			
+		} else {
+			int numReadOperationPerRow = (int)ceil((double)numCol/numReadCellPerOperationNeuro);
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			
+			wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			precharger.CalculateLatency(1e20, capCol, numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numWriteOperationPerRow*numRow*activityRowWrite);
+			multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
+			multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculateLatency(1);	
 			}
-	    } else if (cell.memCellType == Type::RRAM || cell.memCellType == Type::FeFET) {
-			if (conventionalSequential) {
-				double capBL = lengthCol * 0.2e-15/1e-6;
-				double colRamp = 0;
-				double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
-				colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;	// Just to generate colRamp
-				colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				
-				wlDecoder.CalculateLatency(1e20, capRow2, NULL, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				if (cell.accessType == CMOS_access) {
-					wlNewDecoderDriver.CalculateLatency(wlDecoder.rampOutput, capRow2, resRow, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);	
-				} else {
-					wlDecoderDriver.CalculateLatency(wlDecoder.rampOutput, capRow1, capRow1, resRow, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				}
-				slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				
-				
-				mux.CalculateLatency(colRamp, 0, numColMuxed);
-				muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
-				multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, numRow*activityRowRead);
-				if (avgWeightBit > 1) {
-					multilevelSAEncoder.CalculateLatency(1e20, numColMuxed*numRow*activityRowRead);
-				}
-				adder.CalculateLatency(1e20, dff.capTgDrain, numColMuxed*numRow*activityRowRead);
-				dff.CalculateLatency(1e20, numColMuxed*numRow*activityRowRead);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculateLatency(numColMuxed);	// There are numReadPulse times of shift-and-add
-				}
-				
-				// Read
-				readLatency = 0;
-				readLatency += MAX(wlDecoder.readLatency + wlNewDecoderDriver.readLatency + wlDecoderDriver.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
-				readLatency += colDelay/numReadPulse;
-				readLatency += multilevelSenseAmp.readLatency;
-				readLatency += multilevelSAEncoder.readLatency;
-				readLatency += adder.readLatency;
-				readLatency += dff.readLatency;
-				readLatency += shiftAdd.readLatency;
-				
-				readLatencyADC = multilevelSenseAmp.readLatency + multilevelSAEncoder.readLatency;
-				readLatencyAccum = adder.readLatency + dff.readLatency + shiftAdd.readLatency;
-				readLatencyOther = MAX(wlDecoder.readLatency + wlNewDecoderDriver.readLatency + wlDecoderDriver.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse) + colDelay/numReadPulse;
-				
-				// // Write
-				// writeLatency = 0;
-				// writeLatencyArray = 0;
-				// writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
-				// writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
-				// writeLatency += MAX(wlDecoder.writeLatency + wlNewDecoderDriver.writeLatency + wlDecoderDriver.writeLatency, slSwitchMatrix.writeLatency);
-				// writeLatency += writeLatencyArray;
-				
-			} else if (conventionalParallel) {
-				double capBL = lengthCol * 0.2e-15/1e-6;
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				double colRamp = 0;
-				double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
-				colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;
-				colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
-				
-				if (cell.accessType == CMOS_access) {
-					wlNewSwitchMatrix.CalculateLatency(1e20, capRow2, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				} else {
-					wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				}
-				slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				mux.CalculateLatency(colRamp, 0, numColMuxed);
-				muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
-				multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
-				multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculateLatency(numColMuxed);	
-				}
-				
-				// Read
-				readLatency = 0;
-				readLatency += MAX(wlNewSwitchMatrix.readLatency + wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
-				readLatency += colDelay/numReadPulse;
-				readLatency += multilevelSenseAmp.readLatency;
-				readLatency += multilevelSAEncoder.readLatency;
-				readLatency += shiftAdd.readLatency;
-				
-				readLatencyADC = multilevelSenseAmp.readLatency + multilevelSAEncoder.readLatency;
-				readLatencyAccum = shiftAdd.readLatency;
-				readLatencyOther = MAX(wlNewSwitchMatrix.readLatency + wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse) + colDelay/numReadPulse;
-				/***
-				// Write
-				writeLatency = 0;
-				writeLatencyArray = 0;
-				writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
-				writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
-				writeLatency += MAX(wlNewSwitchMatrix.writeLatency + wlSwitchMatrix.writeLatency, slSwitchMatrix.writeLatency);
-				writeLatency += writeLatencyArray;
-				***/
-				
-			} else if (BNNsequentialMode || XNORsequentialMode) {
-				double capBL = lengthCol * 0.2e-15/1e-6;
-				double colRamp = 0;
-				double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
-				colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;
-				colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				
-				wlDecoder.CalculateLatency(1e20, capRow2, NULL, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				if (cell.accessType == CMOS_access) {
-					wlNewDecoderDriver.CalculateLatency(wlDecoder.rampOutput, capRow2, resRow, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);	
-				} else {
-					wlDecoderDriver.CalculateLatency(wlDecoder.rampOutput, capRow1, capRow1, resRow, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				}
-				slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				mux.CalculateLatency(colRamp, 0, numColMuxed);
-				muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
-				rowCurrentSenseAmp.CalculateLatency(columnResistance, numColMuxed, numRow*activityRowRead);
-				adder.CalculateLatency(1e20, dff.capTgDrain, numColMuxed*numRow*activityRowRead);
-				dff.CalculateLatency(1e20, numColMuxed*numRow*activityRowRead);
-				
-				// Read
-				readLatency = 0;
-				readLatency += MAX(wlDecoder.readLatency + wlNewDecoderDriver.readLatency + wlDecoderDriver.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
-				readLatency += colDelay/numReadPulse;
-				readLatency += rowCurrentSenseAmp.readLatency;
-				readLatency += adder.readLatency;
-				readLatency += dff.readLatency;
-				
-				// // Write
-				// writeLatency = 0;
-				// writeLatencyArray = 0;
-				// writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
-				// writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
-				// writeLatency += MAX(wlDecoder.writeLatency + wlNewDecoderDriver.writeLatency + wlDecoderDriver.writeLatency, slSwitchMatrix.writeLatency);
-				// writeLatency += writeLatencyArray;
-				
-			} else if (BNNparallelMode || XNORparallelMode) {
-				double capBL = lengthCol * 0.2e-15/1e-6;
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				double colRamp = 0;
-				double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
-				colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;
-				colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
-				
-				if (cell.accessType == CMOS_access) {
-					wlNewSwitchMatrix.CalculateLatency(1e20, capRow2, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				} else {
-					wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				}
-				slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				mux.CalculateLatency(colRamp, 0, numColMuxed);
-				muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
-				multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
-				multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
+			// Read
+			double resPullDown = CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech);
+			double tau = (resCellAccess + resPullDown) * (capCellAccess + capCol) + resCol * capCol / 2;
+			tau *= log(tech.vdd / (tech.vdd - cell.minSenseVoltage / 2));   
+			double gm = CalculateTransconductance(cell.widthAccessCMOS * tech.featureSize, NMOS, tech);
+			double beta = 1 / (resPullDown * gm);
+			double colRamp = 0;
+			colDelay = horowitz(tau, beta, wlDecoder.rampOutput, &colRamp) * numReadOperationPerRow * numRow * numReadPulse * activityRowRead;
 
-				// Read
-				readLatency = 0;
-				readLatency += MAX(wlNewSwitchMatrix.readLatency + wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
-				readLatency += colDelay/numReadPulse;
-				readLatency += multilevelSenseAmp.readLatency;
-				readLatency += multilevelSAEncoder.readLatency;
-				
-				// // Write
-				// writeLatency = 0;
-				// writeLatencyArray = 0;
-				// writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
-				// writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
-				// writeLatency += MAX(wlNewSwitchMatrix.writeLatency + wlSwitchMatrix.writeLatency, slSwitchMatrix.writeLatency);
-				// writeLatency += writeLatencyArray;
-				
+			readLatency = 0;
+			readLatency += wlSwitchMatrix.readLatency;
+			readLatency += precharger.readLatency;
+			readLatency += colDelay;
+			readLatency += multilevelSenseAmp.readLatency;
+			readLatency += multilevelSAEncoder.readLatency;
+			readLatency += shiftAdd.readLatency;
+
+			// Write (assume the average delay of pullup and pulldown inverter in SRAM cell)
+			double resPull;
+			resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;    // take average
+			tau = resPull * cell.capSRAMCell;
+			gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;   // take average
+			beta = 1 / (resPull * gm);
+			
+			// writeLatency += horowitz(tau, beta, 1e20, NULL) * numWriteOperationPerRow * numRow * activityRowWrite;
+			// writeLatency += wlSwitchMatrix.writeLatency;
+			// writeLatency += precharger.writeLatency;
+			// writeLatency += sramWriteDriver.writeLatency;
+		}
+	} else {   // RRAM, FeFET
+		if (conventionalSequential) {
+			double capBL = lengthCol * 0.2e-15/1e-6;
+			double colRamp = 0;
+			double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
+			colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;	// Just to generate colRamp
+			colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			
+			wlDecoder.CalculateLatency(1e20, capRow2, NULL, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			if (CMOSAccess) {
+				wlNewDecoderDriver.CalculateLatency(wlDecoder.rampOutput, capRow2, resRow, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);	
 			} else {
-				double capBL = lengthCol * 0.2e-15/1e-6;
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				double colRamp = 0;
-				double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
-				colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;
-				colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
-				
-				if (cell.accessType == CMOS_access) {
-					wlNewSwitchMatrix.CalculateLatency(1e20, capRow2, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				} else {
-					wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				}
-				slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				mux.CalculateLatency(colRamp, 0, numColMuxed);
-				muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
-				multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
-				multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculateLatency(numColMuxed);	
-				}
-				// Read
-				readLatency = 0;
-				readLatency += MAX(wlNewSwitchMatrix.readLatency + wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
-				readLatency += colDelay/numReadPulse;
-				readLatency += multilevelSenseAmp.readLatency;
-				readLatency += multilevelSAEncoder.readLatency;
-				readLatency += shiftAdd.readLatency;
+				wlDecoderDriver.CalculateLatency(wlDecoder.rampOutput, capRow1, capRow1, resRow, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			}
+			slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			
+			
+			mux.CalculateLatency(colRamp, 0, numColMuxed);
+			muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
+			multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, numRow*activityRowRead);
+			if (avgWeightBit > 1) {
+				multilevelSAEncoder.CalculateLatency(1e20, numColMuxed*numRow*activityRowRead);
+			}
+			adder.CalculateLatency(1e20, dff.capTgDrain, numColMuxed*numRow*activityRowRead);
+			dff.CalculateLatency(1e20, numColMuxed*numRow*activityRowRead);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculateLatency(numColMuxed);	// There are numReadPulse times of shift-and-add
+			}
+			
+			// Read
+			readLatency = 0;
+			readLatency += MAX(wlDecoder.readLatency + wlNewDecoderDriver.readLatency + wlDecoderDriver.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
+			readLatency += colDelay/numReadPulse;
+			readLatency += multilevelSenseAmp.readLatency;
+			readLatency += multilevelSAEncoder.readLatency;
+			readLatency += adder.readLatency;
+			readLatency += dff.readLatency;
+			readLatency += shiftAdd.readLatency;
+			
+			readLatencyADC = multilevelSenseAmp.readLatency + multilevelSAEncoder.readLatency;
+			readLatencyAccum = adder.readLatency + dff.readLatency + shiftAdd.readLatency;
+			readLatencyOther = MAX(wlDecoder.readLatency + wlNewDecoderDriver.readLatency + wlDecoderDriver.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse) + colDelay/numReadPulse;
+			
+			// // Write
+			// writeLatency = 0;
+			// writeLatencyArray = 0;
+			// writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
+			// writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
+			// writeLatency += MAX(wlDecoder.writeLatency + wlNewDecoderDriver.writeLatency + wlDecoderDriver.writeLatency, slSwitchMatrix.writeLatency);
+			// writeLatency += writeLatencyArray;
+			
+		} else if (conventionalParallel) {
+			double capBL = lengthCol * 0.2e-15/1e-6;
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			double colRamp = 0;
+			double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
+			colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;
+			colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
+			
+			if (CMOSAccess) {
+				wlNewSwitchMatrix.CalculateLatency(1e20, capRow2, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			} else {
+				wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			}
+			slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			mux.CalculateLatency(colRamp, 0, numColMuxed);
+			muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
+			multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
+			multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculateLatency(numColMuxed);	
+			}
+			
+			// Read
+			readLatency = 0;
+			readLatency += MAX(wlNewSwitchMatrix.readLatency + wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
+			readLatency += colDelay/numReadPulse;
+			readLatency += multilevelSenseAmp.readLatency;
+			readLatency += multilevelSAEncoder.readLatency;
+			readLatency += shiftAdd.readLatency;
+			
+			readLatencyADC = multilevelSenseAmp.readLatency + multilevelSAEncoder.readLatency;
+			readLatencyAccum = shiftAdd.readLatency;
+			readLatencyOther = MAX(wlNewSwitchMatrix.readLatency + wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse) + colDelay/numReadPulse;
+			/***
+			// Write
+			writeLatency = 0;
+			writeLatencyArray = 0;
+			writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
+			writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
+			writeLatency += MAX(wlNewSwitchMatrix.writeLatency + wlSwitchMatrix.writeLatency, slSwitchMatrix.writeLatency);
+			writeLatency += writeLatencyArray;
+			***/
+			
+		} else if (BNNsequentialMode || XNORsequentialMode) {
+			double capBL = lengthCol * 0.2e-15/1e-6;
+			double colRamp = 0;
+			double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
+			colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;
+			colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			
+			wlDecoder.CalculateLatency(1e20, capRow2, NULL, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			if (CMOSAccess) {
+				wlNewDecoderDriver.CalculateLatency(wlDecoder.rampOutput, capRow2, resRow, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);	
+			} else {
+				wlDecoderDriver.CalculateLatency(wlDecoder.rampOutput, capRow1, capRow1, resRow, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			}
+			slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			mux.CalculateLatency(colRamp, 0, numColMuxed);
+			muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
+			rowCurrentSenseAmp.CalculateLatency(columnResistance, numColMuxed, numRow*activityRowRead);
+			adder.CalculateLatency(1e20, dff.capTgDrain, numColMuxed*numRow*activityRowRead);
+			dff.CalculateLatency(1e20, numColMuxed*numRow*activityRowRead);
+			
+			// Read
+			readLatency = 0;
+			readLatency += MAX(wlDecoder.readLatency + wlNewDecoderDriver.readLatency + wlDecoderDriver.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
+			readLatency += colDelay/numReadPulse;
+			readLatency += rowCurrentSenseAmp.readLatency;
+			readLatency += adder.readLatency;
+			readLatency += dff.readLatency;
+			
+			// // Write
+			// writeLatency = 0;
+			// writeLatencyArray = 0;
+			// writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
+			// writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
+			// writeLatency += MAX(wlDecoder.writeLatency + wlNewDecoderDriver.writeLatency + wlDecoderDriver.writeLatency, slSwitchMatrix.writeLatency);
+			// writeLatency += writeLatencyArray;
+			
+		} else if (BNNparallelMode || XNORparallelMode) {
+			double capBL = lengthCol * 0.2e-15/1e-6;
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			double colRamp = 0;
+			double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
+			colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;
+			colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
+			
+			if (CMOSAccess) {
+				wlNewSwitchMatrix.CalculateLatency(1e20, capRow2, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			} else {
+				wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			}
+			slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			mux.CalculateLatency(colRamp, 0, numColMuxed);
+			muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
+			multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
+			multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
 
-				// Write
-				// writeLatency = 0;
-				// writeLatencyArray = 0;
-				// writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
-				// writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
-				// writeLatency += MAX(wlNewSwitchMatrix.writeLatency + wlSwitchMatrix.writeLatency, slSwitchMatrix.writeLatency);
-				// writeLatency += writeLatencyArray;
+			// Read
+			readLatency = 0;
+			readLatency += MAX(wlNewSwitchMatrix.readLatency + wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
+			readLatency += colDelay/numReadPulse;
+			readLatency += multilevelSenseAmp.readLatency;
+			readLatency += multilevelSAEncoder.readLatency;
+			
+			// // Write
+			// writeLatency = 0;
+			// writeLatencyArray = 0;
+			// writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
+			// writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
+			// writeLatency += MAX(wlNewSwitchMatrix.writeLatency + wlSwitchMatrix.writeLatency, slSwitchMatrix.writeLatency);
+			// writeLatency += writeLatencyArray;
+			
+		} else {
+			double capBL = lengthCol * 0.2e-15/1e-6;
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			double colRamp = 0;
+			double tau = (capCol)*(cell.resMemCellAvg/(numRow/2));
+			colDelay = horowitz(tau, 0, 1e20, &colRamp)*numColMuxed;
+			colDelay = tau * 0.2 * numColMuxed;  // assume the 15~20% voltage drop is enough for sensing
+			
+			if (CMOSAccess) {
+				wlNewSwitchMatrix.CalculateLatency(1e20, capRow2, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			} else {
+				wlSwitchMatrix.CalculateLatency(1e20, capRow1, resRow, numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
 			}
+			slSwitchMatrix.CalculateLatency(1e20, capCol, resCol, 0, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			mux.CalculateLatency(colRamp, 0, numColMuxed);
+			muxDecoder.CalculateLatency(1e20, mux.capTgGateN*ceil(numCol/numColMuxed), mux.capTgGateP*ceil(numCol/numColMuxed), numColMuxed, 0);
+			multilevelSenseAmp.CalculateLatency(columnResistance, numColMuxed, 1);
+			multilevelSAEncoder.CalculateLatency(1e20, numColMuxed);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculateLatency(numColMuxed);	
+			}
+			// Read
+			readLatency = 0;
+			readLatency += MAX(wlNewSwitchMatrix.readLatency + wlSwitchMatrix.readLatency, (mux.readLatency+muxDecoder.readLatency)/numReadPulse);
+			readLatency += colDelay/numReadPulse;
+			readLatency += multilevelSenseAmp.readLatency;
+			readLatency += multilevelSAEncoder.readLatency;
+			readLatency += shiftAdd.readLatency;
+
+			// Write
+			// writeLatency = 0;
+			// writeLatencyArray = 0;
+			// writeLatencyArray += numWritePulse * param->writePulseWidthLTP;
+			// writeLatencyArray += (-numErasePulse) * param->writePulseWidthLTD;
+			// writeLatency += MAX(wlNewSwitchMatrix.writeLatency + wlSwitchMatrix.writeLatency, slSwitchMatrix.writeLatency);
+			// writeLatency += writeLatencyArray;
 		}
-		//cout << "subarray read latency is " << readLatency*1e9 << "ns" << endl;
-		//cout << "subarray write latency is " << writeLatency*1e9 << "ns" << endl;
 	}
+	//cout << "subarray read latency is " << readLatency*1e9 << "ns" << endl;
+	//cout << "subarray write latency is " << writeLatency*1e9 << "ns" << endl;
 }
 
 void SubArray::CalculatePower(const vector<double> &columnResistance) {
+	PROFILE_SCOPE("SubArray::CalculatePower");
 	if (!initialized) {
 		cout << "[Subarray] Error: Require initialization first!" << endl;
 	} else {
 		readDynamicEnergy = 0;
 		writeDynamicEnergy = 0;
 		readDynamicEnergyArray = 0;
+		readDynamicEnergyADC = readDynamicEnergyAccum = readDynamicEnergyOther = 0;
+		(this->*powerKernel)(columnResistance);
 		
-		double numReadOperationPerRow;   // average value (can be non-integer for energy calculation)
-		if (numCol > numReadCellPerOperationNeuro)
-			numReadOperationPerRow = numCol / numReadCellPerOperationNeuro;
-		else
-			numReadOperationPerRow = 1;
+		readDynamicEnergyDAC = 0;
+		if (numBitPerReadPulse > 1) {
+			readDynamicEnergyDAC = (pow(2, numBitPerReadPulse)-2)*RowDriverUnit(wlSwitchMatrix.readDynamicEnergy + wlNewSwitchMatrix.readDynamicEnergy 
+																			+ wlDecoderDriver.readDynamicEnergy + wlNewDecoderDriver.readDynamicEnergy, wlDecoder.readDynamicEnergy);
+			readDynamicEnergy += readDynamicEnergyDAC;
+			readDynamicEnergyOther += readDynamicEnergyDAC;
+		}
+	}
+}
 
-		double numWriteOperationPerRow;   // average value (can be non-integer for energy calculation)
-		if (numCol * activityColWrite > numWriteCellPerOperationNeuro)
-			numWriteOperationPerRow = numCol * activityColWrite / numWriteCellPerOperationNeuro;
-		else
-			numWriteOperationPerRow = 1;
+template <bool SRAMCell, int operationMode, bool CMOSAccess>
+void SubArray::CalculatePowerKernel(const vector<double> &columnResistance) {
+	// compile-time copies of the mode flags: every branch on them below folds away in each instantiation
+	const bool conventionalSequential = (operationMode == 1);
+	const bool conventionalParallel = (operationMode == 2);
+	const bool BNNsequentialMode = (operationMode == 3);
+	const bool BNNparallelMode = (operationMode == 4);
+	const bool XNORsequentialMode = (operationMode == 5);
+	const bool XNORparallelMode = (operationMode == 6);
+	
+	double numReadOperationPerRow;   // average value (can be non-integer for energy calculation)
+	if (numCol > numReadCellPerOperationNeuro)
+		numReadOperationPerRow = numCol / numReadCellPerOperationNeuro;
+	else
+		numReadOperationPerRow = 1;
 
-		if (cell.memCellType == Type::SRAM) {
-			
-			// Array leakage (assume 2 INV)
-			leakage = 0;
-			leakage += CalculateGateLeakage(INV, 1, cell.widthSRAMCellNMOS * tech.featureSize,
-					cell.widthSRAMCellPMOS * tech.featureSize, inputParameter.temperature, tech) * tech.vdd * 2;
-			leakage *= numRow * numCol;
+	double numWriteOperationPerRow;   // average value (can be non-integer for energy calculation)
+	if (numCol * activityColWrite > numWriteCellPerOperationNeuro)
+		numWriteOperationPerRow = numCol * activityColWrite / numWriteCellPerOperationNeuro;
+	else
+		numWriteOperationPerRow = 1;
 
-			if (conventionalSequential) {
-				wlDecoder.CalculatePower(numRow*activityRowRead, numRow*activityRowWrite);
-				precharger.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
-				adder.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numReadCellPerOperationNeuro/numCellPerSynapse);				
-				dff.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numReadCellPerOperationNeuro/numCellPerSynapse*(adder.numBit+1));
-				senseAmp.CalculatePower(numReadOperationPerRow*numRow*activityRowRead);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculatePower(numReadOperationPerRow*numRow*activityRowRead);
-				}
-				// Array
-				readDynamicEnergyArray = 0; // Just BL discharging
-				writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
+	if (SRAMCell) {
+		
+		// Array leakage (assume 2 INV)
+		leakage = 0;
+		leakage += CalculateGateLeakage(INV, 1, cell.widthSRAMCellNMOS * tech.featureSize,
+				cell.widthSRAMCellPMOS * tech.featureSize, inputParameter.temperature, tech) * tech.vdd * 2;
+		leakage *= numRow * numCol;
 
-				// Read
-				readDynamicEnergy += wlDecoder.readDynamicEnergy;
-				readDynamicEnergy += precharger.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
-				readDynamicEnergy += adder.readDynamicEnergy;
-				readDynamicEnergy += dff.readDynamicEnergy;
-				readDynamicEnergy += senseAmp.readDynamicEnergy;
-				readDynamicEnergy += shiftAdd.readDynamicEnergy;
-				
-				readDynamicEnergyADC = precharger.readDynamicEnergy + readDynamicEnergyArray + senseAmp.readDynamicEnergy;
-				readDynamicEnergyAccum = adder.readDynamicEnergy + dff.readDynamicEnergy + shiftAdd.readDynamicEnergy;
-				readDynamicEnergyOther = wlDecoder.readDynamicEnergy;
+		if (conventionalSequential) {
+			wlDecoder.CalculatePower(numRow*activityRowRead, numRow*activityRowWrite);
+			precharger.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
+			adder.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numReadCellPerOperationNeuro/numCellPerSynapse);				
+			dff.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numReadCellPerOperationNeuro/numCellPerSynapse*(adder.numBit+1));
+			senseAmp.CalculatePower(numReadOperationPerRow*numRow*activityRowRead);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculatePower(numReadOperationPerRow*numRow*activityRowRead);
+			}
+			// Array
+			readDynamicEnergyArray = 0; // Just BL discharging
+			writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
 
-				// Write
-				writeDynamicEnergy += wlDecoder.writeDynamicEnergy;
-				writeDynamicEnergy += precharger.writeDynamicEnergy;
-				writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;
-				
-				// Leakage
-				leakage += wlDecoder.leakage;
-				leakage += precharger.leakage;
-				leakage += sramWriteDriver.leakage;
-				leakage += senseAmp.leakage;
-				leakage += dff.leakage;
-				leakage += adder.leakage;
-				leakage += shiftAdd.leakage;
+			// Read
+			readDynamicEnergy += wlDecoder.readDynamicEnergy;
+			readDynamicEnergy += precharger.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
+			readDynamicEnergy += adder.readDynamicEnergy;
+			readDynamicEnergy += dff.readDynamicEnergy;
+			readDynamicEnergy += senseAmp.readDynamicEnergy;
+			readDynamicEnergy += shiftAdd.readDynamicEnergy;
+			
+			readDynamicEnergyADC = precharger.readDynamicEnergy + readDynamicEnergyArray + senseAmp.readDynamicEnergy;
+			readDynamicEnergyAccum = adder.readDynamicEnergy + dff.readDynamicEnergy + shiftAdd.readDynamicEnergy;
+			readDynamicEnergyOther = wlDecoder.readDynamicEnergy;
 
-			} else if (conventionalParallel) {
-				wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				precharger.CalculatePower(numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
-				
-				mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
-				muxDecoder.CalculatePower(numColMuxed, 1);
-				
-				multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
-				multilevelSAEncoder.CalculatePower(numColMuxed);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculatePower(numColMuxed);
-				}
-				// Array
-				readDynamicEnergyArray = 0; // Just BL discharging
-				writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
-				// Read
-				readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
-				readDynamicEnergy += precharger.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
-				readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
-				readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
-				readDynamicEnergy += mux.readDynamicEnergy;
-				readDynamicEnergy += muxDecoder.readDynamicEnergy;
-				readDynamicEnergy += shiftAdd.readDynamicEnergy;
+			// Write
+			writeDynamicEnergy += wlDecoder.writeDynamicEnergy;
+			writeDynamicEnergy += precharger.writeDynamicEnergy;
+			writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;
+			
+			// Leakage
+			leakage += wlDecoder.leakage;
+			leakage += precharger.leakage;
+			leakage += sramWriteDriver.leakage;
+			leakage += senseAmp.leakage;
+			leakage += dff.leakage;
+			leakage += adder.leakage;
+			leakage += shiftAdd.leakage;
 
-				readDynamicEnergyADC = precharger.readDynamicEnergy + readDynamicEnergyArray + multilevelSenseAmp.readDynamicEnergy + multilevelSAEncoder.readDynamicEnergy;
-				readDynamicEnergyAccum = shiftAdd.readDynamicEnergy;
-				readDynamicEnergyOther = wlSwitchMatrix.readDynamicEnergy + (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
-				
-				// Write
-				writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += precharger.writeDynamicEnergy;
-				writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;				
-				
-				// Leakage
-				leakage += wlSwitchMatrix.leakage;
-				leakage += precharger.leakage;
-				leakage += sramWriteDriver.leakage;
-				leakage += multilevelSenseAmp.leakage;
-				leakage += multilevelSAEncoder.leakage;
-				leakage += shiftAdd.leakage;
+		} else if (conventionalParallel) {
+			wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			precharger.CalculatePower(numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
 			
-			} else if (BNNsequentialMode || XNORsequentialMode) {
-				wlDecoder.CalculatePower(numRow*activityRowRead, numRow*activityRowWrite);
-				precharger.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
-				adder.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numReadCellPerOperationNeuro/numCellPerSynapse);				
-				dff.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numReadCellPerOperationNeuro/numCellPerSynapse*(adder.numBit+1));
-				senseAmp.CalculatePower(numReadOperationPerRow*numRow*activityRowRead);
-				
-				// Array
-				readDynamicEnergyArray = 0; // Just BL discharging
-				writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
+			mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
+			muxDecoder.CalculatePower(numColMuxed, 1);
+			
+			multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
+			multilevelSAEncoder.CalculatePower(numColMuxed);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculatePower(numColMuxed);
+			}
+			// Array
+			readDynamicEnergyArray = 0; // Just BL discharging
+			writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
+			// Read
+			readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
+			readDynamicEnergy += precharger.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
+			readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
+			readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
+			readDynamicEnergy += mux.readDynamicEnergy;
+			readDynamicEnergy += muxDecoder.readDynamicEnergy;
+			readDynamicEnergy += shiftAdd.readDynamicEnergy;
 
-				// Read
-				readDynamicEnergy += wlDecoder.readDynamicEnergy;
-				readDynamicEnergy += precharger.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
-				readDynamicEnergy += adder.readDynamicEnergy;
-				readDynamicEnergy += dff.readDynamicEnergy;
-				readDynamicEnergy += senseAmp.readDynamicEnergy;
-				
-				// Write				
-				writeDynamicEnergy += wlDecoder.writeDynamicEnergy;
-				writeDynamicEnergy += precharger.writeDynamicEnergy;
-				writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;				
-				
-				// Leakage
-				leakage += wlDecoder.leakage;
-				leakage += precharger.leakage;
-				leakage += sramWriteDriver.leakage;
-				leakage += senseAmp.leakage;
-				leakage += dff.leakage;
-				leakage += adder.leakage;
-				
-			} else if (BNNparallelMode || XNORparallelMode) {
-				wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				precharger.CalculatePower(numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
-				multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
-				multilevelSAEncoder.CalculatePower(numColMuxed);
-				
-				// Array
-				readDynamicEnergyArray = 0; // Just BL discharging
-				writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
-				// Read
-				readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
-				readDynamicEnergy += precharger.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
-				readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
-				readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
-				
-				// Write				
-				writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += precharger.writeDynamicEnergy;
-				writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;				
-				
-				// Leakage
-				leakage += wlSwitchMatrix.leakage;
-				leakage += precharger.leakage;
-				leakage += sramWriteDriver.leakage;
-				leakage += multilevelSenseAmp.leakage;
-				leakage += multilevelSAEncoder.leakage;
-				
-			} else {
-				wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				precharger.CalculatePower(numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
-				sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
-				multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
-				multilevelSAEncoder.CalculatePower(numColMuxed);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculatePower(numColMuxed);
-				}
-				// Array
-				readDynamicEnergyArray = 0; // Just BL discharging
-				writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
-				// Read
-				readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
-				readDynamicEnergy += precharger.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
-				readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
-				readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
-				readDynamicEnergy += shiftAdd.readDynamicEnergy;
+			readDynamicEnergyADC = precharger.readDynamicEnergy + readDynamicEnergyArray + multilevelSenseAmp.readDynamicEnergy + multilevelSAEncoder.readDynamicEnergy;
+			readDynamicEnergyAccum = shiftAdd.readDynamicEnergy;
+			readDynamicEnergyOther = wlSwitchMatrix.readDynamicEnergy + (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
+			
+			// Write
+			writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += precharger.writeDynamicEnergy;
+			writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;				
+			
+			// Leakage
+			leakage += wlSwitchMatrix.leakage;
+			leakage += precharger.leakage;
+			leakage += sramWriteDriver.leakage;
+			leakage += multilevelSenseAmp.leakage;
+			leakage += multilevelSAEncoder.leakage;
+			leakage += shiftAdd.leakage;
+		
+		} else if (BNNsequentialMode || XNORsequentialMode) {
+			wlDecoder.CalculatePower(numRow*activityRowRead, numRow*activityRowWrite);
+			precharger.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
+			adder.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numReadCellPerOperationNeuro/numCellPerSynapse);				
+			dff.CalculatePower(numReadOperationPerRow*numRow*activityRowRead, numReadCellPerOperationNeuro/numCellPerSynapse*(adder.numBit+1));
+			senseAmp.CalculatePower(numReadOperationPerRow*numRow*activityRowRead);
+			
+			// Array
+			readDynamicEnergyArray = 0; // Just BL discharging
+			writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
 
-				// Write				
-				writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += precharger.writeDynamicEnergy;
-				writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;			
-				
-				// Leakage
-				leakage += wlSwitchMatrix.leakage;
-				leakage += precharger.leakage;
-				leakage += sramWriteDriver.leakage;
-				leakage += multilevelSenseAmp.leakage;
-				leakage += multilevelSAEncoder.leakage;
-				leakage += shiftAdd.leakage;
+			// Read
+			readDynamicEnergy += wlDecoder.readDynamicEnergy;
+			readDynamicEnergy += precharger.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
+			readDynamicEnergy += adder.readDynamicEnergy;
+			readDynamicEnergy += dff.readDynamicEnergy;
+			readDynamicEnergy += senseAmp.readDynamicEnergy;
 			
+			// Write				
+			writeDynamicEnergy += wlDecoder.writeDynamicEnergy;
+			writeDynamicEnergy += precharger.writeDynamicEnergy;
+			writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;				
+			
+			// Leakage
+			leakage += wlDecoder.leakage;
+			leakage += precharger.leakage;
+			leakage += sramWriteDriver.leakage;
+			leakage += senseAmp.leakage;
+			leakage += dff.leakage;
+			leakage += adder.leakage;
+			
+		} else if (BNNparallelMode || XNORparallelMode) {
+			wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			precharger.CalculatePower(numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
+			multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
+			multilevelSAEncoder.CalculatePower(numColMuxed);
+			
+			// Array
+			readDynamicEnergyArray = 0; // Just BL discharging
+			writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
+			// Read
+			readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
+			readDynamicEnergy += precharger.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
+			readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
+			readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
+			
+			// Write				
+			writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += precharger.writeDynamicEnergy;
+			writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;				
+			
+			// Leakage
+			leakage += wlSwitchMatrix.leakage;
+			leakage += precharger.leakage;
+			leakage += sramWriteDriver.leakage;
+			leakage += multilevelSenseAmp.leakage;
+			leakage += multilevelSAEncoder.leakage;
+			
+		} else {
+			wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			precharger.CalculatePower(numColMuxed, numWriteOperationPerRow*numRow*activityRowWrite);
+			sramWriteDriver.CalculatePower(numWriteOperationPerRow*numRow*activityRowWrite);
+			multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
+			multilevelSAEncoder.CalculatePower(numColMuxed);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculatePower(numColMuxed);
 			}
+			// Array
+			readDynamicEnergyArray = 0; // Just BL discharging
+			writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * activityColWrite * numRow * activityRowWrite;    // flip Q and Q_bar
+			// Read
+			readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
+			readDynamicEnergy += precharger.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
+			readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
+			readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
+			readDynamicEnergy += shiftAdd.readDynamicEnergy;
+
+			// Write				
+			writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += precharger.writeDynamicEnergy;
+			writeDynamicEnergy += sramWriteDriver.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;			
 			
-	    } else if (cell.memCellType == Type::RRAM || cell.memCellType == Type::FeFET) {
-			if (conventionalSequential) {
-				double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
-				double numWriteCells = (int)ceil((double)numCol/*numWriteColMuxed*/); 
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				double capBL = lengthCol * 0.2e-15/1e-6;
-				
-				wlDecoder.CalculatePower(numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				if (cell.accessType == CMOS_access) {
-					wlNewDecoderDriver.CalculatePower(numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				} else {
-					wlDecoderDriver.CalculatePower(numReadCells, numWriteCells, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				}
-				slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
-				muxDecoder.CalculatePower(numColMuxed, 1);
-				multilevelSenseAmp.CalculatePower(columnResistance, numRow*activityRowRead*numColMuxed);
-				if (avgWeightBit > 1) {
-					multilevelSAEncoder.CalculatePower(numRow*activityRowRead*numColMuxed);
-				}
-				adder.CalculatePower(numColMuxed*numRow*activityRowRead, numReadCells);
-				dff.CalculatePower(numColMuxed*numRow*activityRowRead, numReadCells*(adder.numBit+1)); 
-				if (numReadPulse > 1) {
-					shiftAdd.CalculatePower(numColMuxed);	// There are numReadPulse times of shift-and-add
-				}
-				// Read
-				readDynamicEnergyArray = 0;
-				readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
-				readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd; // Selected WL
-				readDynamicEnergyArray *= numRow * activityRowRead * numColMuxed;
+			// Leakage
+			leakage += wlSwitchMatrix.leakage;
+			leakage += precharger.leakage;
+			leakage += sramWriteDriver.leakage;
+			leakage += multilevelSenseAmp.leakage;
+			leakage += multilevelSAEncoder.leakage;
+			leakage += shiftAdd.leakage;
+		
+		}
+		
+	} else {   // RRAM, FeFET
+		if (conventionalSequential) {
+			double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
+			double numWriteCells = (int)ceil((double)numCol/*numWriteColMuxed*/); 
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			double capBL = lengthCol * 0.2e-15/1e-6;
+			
+			wlDecoder.CalculatePower(numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			if (CMOSAccess) {
+				wlNewDecoderDriver.CalculatePower(numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			} else {
+				wlDecoderDriver.CalculatePower(numReadCells, numWriteCells, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			}
+			slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
+			muxDecoder.CalculatePower(numColMuxed, 1);
+			multilevelSenseAmp.CalculatePower(columnResistance, numRow*activityRowRead*numColMuxed);
+			if (avgWeightBit > 1) {
+				multilevelSAEncoder.CalculatePower(numRow*activityRowRead*numColMuxed);
+			}
+			adder.CalculatePower(numColMuxed*numRow*activityRowRead, numReadCells);
+			dff.CalculatePower(numColMuxed*numRow*activityRowRead, numReadCells*(adder.numBit+1)); 
+			if (numReadPulse > 1) {
+				shiftAdd.CalculatePower(numColMuxed);	// There are numReadPulse times of shift-and-add
+			}
+			// Read
+			readDynamicEnergyArray = 0;
+			readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
+			readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd; // Selected WL
+			readDynamicEnergyArray *= numRow * activityRowRead * numColMuxed;
 
-				readDynamicEnergy = 0;
-				readDynamicEnergy += wlDecoder.readDynamicEnergy;
-				readDynamicEnergy += wlNewDecoderDriver.readDynamicEnergy;
-				readDynamicEnergy += wlDecoderDriver.readDynamicEnergy;
-				readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
-				readDynamicEnergy += adder.readDynamicEnergy;
-				readDynamicEnergy += dff.readDynamicEnergy;
-				readDynamicEnergy += shiftAdd.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
-				readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy + multilevelSAEncoder.readDynamicEnergy;
-				
-				readDynamicEnergyADC = readDynamicEnergyArray + multilevelSenseAmp.readDynamicEnergy + multilevelSAEncoder.readDynamicEnergy;
-				readDynamicEnergyAccum = adder.readDynamicEnergy + dff.readDynamicEnergy + shiftAdd.readDynamicEnergy;
-				readDynamicEnergyOther = wlDecoder.readDynamicEnergy + wlNewDecoderDriver.readDynamicEnergy + wlDecoderDriver.readDynamicEnergy + (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
+			readDynamicEnergy = 0;
+			readDynamicEnergy += wlDecoder.readDynamicEnergy;
+			readDynamicEnergy += wlNewDecoderDriver.readDynamicEnergy;
+			readDynamicEnergy += wlDecoderDriver.readDynamicEnergy;
+			readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
+			readDynamicEnergy += adder.readDynamicEnergy;
+			readDynamicEnergy += dff.readDynamicEnergy;
+			readDynamicEnergy += shiftAdd.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
+			readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy + multilevelSAEncoder.readDynamicEnergy;
+			
+			readDynamicEnergyADC = readDynamicEnergyArray + multilevelSenseAmp.readDynamicEnergy + multilevelSAEncoder.readDynamicEnergy;
+			readDynamicEnergyAccum = adder.readDynamicEnergy + dff.readDynamicEnergy + shiftAdd.readDynamicEnergy;
+			readDynamicEnergyOther = wlDecoder.readDynamicEnergy + wlNewDecoderDriver.readDynamicEnergy + wlDecoderDriver.readDynamicEnergy + (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
 
-				// Write				
-				writeDynamicEnergyArray = writeDynamicEnergyArray;
-				writeDynamicEnergy = 0;
-				writeDynamicEnergy += wlDecoder.writeDynamicEnergy;
-				writeDynamicEnergy += wlNewDecoderDriver.writeDynamicEnergy;
-				writeDynamicEnergy += wlDecoderDriver.writeDynamicEnergy;
-				writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;
-				
-				// Leakage
-				leakage = 0;
-				leakage += wlDecoder.leakage;
-				leakage += wlDecoderDriver.leakage;
-				leakage += wlNewDecoderDriver.leakage;
-				leakage += slSwitchMatrix.leakage;
-				leakage += mux.leakage;
-				leakage += muxDecoder.leakage;
-				leakage += multilevelSenseAmp.leakage;
-				leakage += multilevelSAEncoder.leakage;
-				leakage += dff.leakage;
-				leakage += adder.leakage;
-				leakage += shiftAdd.leakage;
-					
-			} else if (conventionalParallel) {
-				double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				double capBL = lengthCol * 0.2e-15/1e-6;
+			// Write				
+			writeDynamicEnergyArray = writeDynamicEnergyArray;
+			writeDynamicEnergy = 0;
+			writeDynamicEnergy += wlDecoder.writeDynamicEnergy;
+			writeDynamicEnergy += wlNewDecoderDriver.writeDynamicEnergy;
+			writeDynamicEnergy += wlDecoderDriver.writeDynamicEnergy;
+			writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;
 			
-				if (cell.accessType == CMOS_access) {
-					wlNewSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead);
-				} else {
-					wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				}
-				slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
-				muxDecoder.CalculatePower(numColMuxed, 1);
-				multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
-				multilevelSAEncoder.CalculatePower(numColMuxed);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculatePower(numColMuxed);
-				}
-				// Read
-				readDynamicEnergyArray = 0;
-				readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
-				readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd * numRow * activityRowRead; // Selected WL
-				readDynamicEnergyArray *= numColMuxed;
-				
-				readDynamicEnergy = 0;
-				readDynamicEnergy += wlNewSwitchMatrix.readDynamicEnergy;
-				readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
-				readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
-				readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
-				readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
-				readDynamicEnergy += shiftAdd.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
-				
-				readDynamicEnergyADC = readDynamicEnergyArray + multilevelSenseAmp.readDynamicEnergy + multilevelSAEncoder.readDynamicEnergy;
-				readDynamicEnergyAccum = shiftAdd.readDynamicEnergy;
-				readDynamicEnergyOther = wlNewSwitchMatrix.readDynamicEnergy + wlSwitchMatrix.readDynamicEnergy + (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
-				
-				// Write				
-				writeDynamicEnergyArray = writeDynamicEnergyArray;
-				writeDynamicEnergy = 0;
-				writeDynamicEnergy += wlNewSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;				
-				
-				// Leakage
-				leakage = 0;
-				leakage += wlSwitchMatrix.leakage;
-				leakage += wlNewSwitchMatrix.leakage;
-				leakage += slSwitchMatrix.leakage;
-				leakage += mux.leakage;
-				leakage += muxDecoder.leakage;
-				leakage += multilevelSenseAmp.leakage;
-				leakage += multilevelSAEncoder.leakage;
-				leakage += shiftAdd.leakage;
+			// Leakage
+			leakage = 0;
+			leakage += wlDecoder.leakage;
+			leakage += wlDecoderDriver.leakage;
+			leakage += wlNewDecoderDriver.leakage;
+			leakage += slSwitchMatrix.leakage;
+			leakage += mux.leakage;
+			leakage += muxDecoder.leakage;
+			leakage += multilevelSenseAmp.leakage;
+			leakage += multilevelSAEncoder.leakage;
+			leakage += dff.leakage;
+			leakage += adder.leakage;
+			leakage += shiftAdd.leakage;
 				
-			} else if (BNNsequentialMode || XNORsequentialMode) {
-				double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
-				double numWriteCells = (int)ceil((double)numCol/*numWriteColMuxed*/); 
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				double capBL = lengthCol * 0.2e-15/1e-6;
+		} else if (conventionalParallel) {
+			double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			double capBL = lengthCol * 0.2e-15/1e-6;
+		
+			if (CMOSAccess) {
+				wlNewSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead);
+			} else {
+				wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			}
+			slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
+			muxDecoder.CalculatePower(numColMuxed, 1);
+			multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
+			multilevelSAEncoder.CalculatePower(numColMuxed);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculatePower(numColMuxed);
+			}
+			// Read
+			readDynamicEnergyArray = 0;
+			readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
+			readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd * numRow * activityRowRead; // Selected WL
+			readDynamicEnergyArray *= numColMuxed;
 			
-				wlDecoder.CalculatePower(numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				if (cell.accessType == CMOS_access) {
-					wlNewDecoderDriver.CalculatePower(numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				} else {
-					wlDecoderDriver.CalculatePower(numReadCells, numWriteCells, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
-				}
-				slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
-				muxDecoder.CalculatePower(numColMuxed, 1);
-				rowCurrentSenseAmp.CalculatePower(columnResistance, numRow*activityRowRead);
-				adder.CalculatePower(numColMuxed*numRow*activityRowRead, numReadCells);
-				dff.CalculatePower(numColMuxed*numRow*activityRowRead, numReadCells*(adder.numBit+1)); 
-				
-				// Read
-				readDynamicEnergyArray = 0;
-				readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
-				readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd; // Selected WL
-				readDynamicEnergyArray *= numRow * activityRowRead * numColMuxed;
+			readDynamicEnergy = 0;
+			readDynamicEnergy += wlNewSwitchMatrix.readDynamicEnergy;
+			readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
+			readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
+			readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
+			readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
+			readDynamicEnergy += shiftAdd.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
+			
+			readDynamicEnergyADC = readDynamicEnergyArray + multilevelSenseAmp.readDynamicEnergy + multilevelSAEncoder.readDynamicEnergy;
+			readDynamicEnergyAccum = shiftAdd.readDynamicEnergy;
+			readDynamicEnergyOther = wlNewSwitchMatrix.readDynamicEnergy + wlSwitchMatrix.readDynamicEnergy + (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
+			
+			// Write				
+			writeDynamicEnergyArray = writeDynamicEnergyArray;
+			writeDynamicEnergy = 0;
+			writeDynamicEnergy += wlNewSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;				
+			
+			// Leakage
+			leakage = 0;
+			leakage += wlSwitchMatrix.leakage;
+			leakage += wlNewSwitchMatrix.leakage;
+			leakage += slSwitchMatrix.leakage;
+			leakage += mux.leakage;
+			leakage += muxDecoder.leakage;
+			leakage += multilevelSenseAmp.leakage;
+			leakage += multilevelSAEncoder.leakage;
+			leakage += shiftAdd.leakage;
+			
+		} else if (BNNsequentialMode || XNORsequentialMode) {
+			double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
+			double numWriteCells = (int)ceil((double)numCol/*numWriteColMuxed*/); 
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			double capBL = lengthCol * 0.2e-15/1e-6;
+		
+			wlDecoder.CalculatePower(numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			if (CMOSAccess) {
+				wlNewDecoderDriver.CalculatePower(numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			} else {
+				wlDecoderDriver.CalculatePower(numReadCells, numWriteCells, numRow*activityRowRead*numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite);
+			}
+			slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
+			muxDecoder.CalculatePower(numColMuxed, 1);
+			rowCurrentSenseAmp.CalculatePower(columnResistance, numRow*activityRowRead);
+			adder.CalculatePower(numColMuxed*numRow*activityRowRead, numReadCells);
+			dff.CalculatePower(numColMuxed*numRow*activityRowRead, numReadCells*(adder.numBit+1)); 
+			
+			// Read
+			readDynamicEnergyArray = 0;
+			readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
+			readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd; // Selected WL
+			readDynamicEnergyArray *= numRow * activityRowRead * numColMuxed;
 
-				readDynamicEnergy = 0;
-				readDynamicEnergy += wlDecoder.readDynamicEnergy;
-				readDynamicEnergy += wlNewDecoderDriver.readDynamicEnergy;
-				readDynamicEnergy += wlDecoderDriver.readDynamicEnergy;
-				readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
-				readDynamicEnergy += rowCurrentSenseAmp.readDynamicEnergy;
-				readDynamicEnergy += adder.readDynamicEnergy;
-				readDynamicEnergy += dff.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
+			readDynamicEnergy = 0;
+			readDynamicEnergy += wlDecoder.readDynamicEnergy;
+			readDynamicEnergy += wlNewDecoderDriver.readDynamicEnergy;
+			readDynamicEnergy += wlDecoderDriver.readDynamicEnergy;
+			readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
+			readDynamicEnergy += rowCurrentSenseAmp.readDynamicEnergy;
+			readDynamicEnergy += adder.readDynamicEnergy;
+			readDynamicEnergy += dff.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
 
-				// Write				
-				writeDynamicEnergyArray = writeDynamicEnergyArray;
-				writeDynamicEnergy = 0;
-				writeDynamicEnergy += wlDecoder.writeDynamicEnergy;
-				writeDynamicEnergy += wlNewDecoderDriver.writeDynamicEnergy;
-				writeDynamicEnergy += wlDecoderDriver.writeDynamicEnergy;
-				writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;				
-				
-				// Leakage
-				leakage = 0;
-				leakage += wlDecoder.leakage;
-				leakage += wlDecoderDriver.leakage;
-				leakage += wlNewDecoderDriver.leakage;
-				leakage += slSwitchMatrix.leakage;
-				leakage += mux.leakage;
-				leakage += muxDecoder.leakage;
-				leakage += rowCurrentSenseAmp.leakage;
-				leakage += dff.leakage;
-				leakage += adder.leakage;
-				
-			} else if (BNNparallelMode || XNORparallelMode) {
-				double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				double capBL = lengthCol * 0.2e-15/1e-6;
+			// Write				
+			writeDynamicEnergyArray = writeDynamicEnergyArray;
+			writeDynamicEnergy = 0;
+			writeDynamicEnergy += wlDecoder.writeDynamicEnergy;
+			writeDynamicEnergy += wlNewDecoderDriver.writeDynamicEnergy;
+			writeDynamicEnergy += wlDecoderDriver.writeDynamicEnergy;
+			writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;				
 			
-				if (cell.accessType == CMOS_access) {
-					wlNewSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead);
-				} else {
-					wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				}
-				slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
-				muxDecoder.CalculatePower(numColMuxed, 1);
-				multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
-				multilevelSAEncoder.CalculatePower(numColMuxed);
-				
-				// Read
-				readDynamicEnergyArray = 0;
-				readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
-				readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd * numRow * activityRowRead; // Selected WL
-				readDynamicEnergyArray *= numColMuxed;
+			// Leakage
+			leakage = 0;
+			leakage += wlDecoder.leakage;
+			leakage += wlDecoderDriver.leakage;
+			leakage += wlNewDecoderDriver.leakage;
+			leakage += slSwitchMatrix.leakage;
+			leakage += mux.leakage;
+			leakage += muxDecoder.leakage;
+			leakage += rowCurrentSenseAmp.leakage;
+			leakage += dff.leakage;
+			leakage += adder.leakage;
+			
+		} else if (BNNparallelMode || XNORparallelMode) {
+			double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			double capBL = lengthCol * 0.2e-15/1e-6;
+		
+			if (CMOSAccess) {
+				wlNewSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead);
+			} else {
+				wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			}
+			slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
+			muxDecoder.CalculatePower(numColMuxed, 1);
+			multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
+			multilevelSAEncoder.CalculatePower(numColMuxed);
+			
+			// Read
+			readDynamicEnergyArray = 0;
+			readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
+			readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd * numRow * activityRowRead; // Selected WL
+			readDynamicEnergyArray *= numColMuxed;
 
-				readDynamicEnergy = 0;
-				readDynamicEnergy += wlNewSwitchMatrix.readDynamicEnergy;
-				readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
-				readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
-				readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
-				readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
+			readDynamicEnergy = 0;
+			readDynamicEnergy += wlNewSwitchMatrix.readDynamicEnergy;
+			readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
+			readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
+			readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
+			readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
 
-				// Write				
-				writeDynamicEnergyArray = writeDynamicEnergyArray;
-				writeDynamicEnergy = 0;
-				writeDynamicEnergy += wlNewSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;				
-				
-				// Leakage
-				leakage = 0;
-				leakage += wlSwitchMatrix.leakage;
-				leakage += wlNewSwitchMatrix.leakage;
-				leakage += slSwitchMatrix.leakage;
-				leakage += mux.leakage;
-				leakage += muxDecoder.leakage;
-				leakage += multilevelSenseAmp.leakage;
-				leakage += multilevelSAEncoder.leakage;
+			// Write				
+			writeDynamicEnergyArray = writeDynamicEnergyArray;
+			writeDynamicEnergy = 0;
+			writeDynamicEnergy += wlNewSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;				
+			
+			// Leakage
+			leakage = 0;
+			leakage += wlSwitchMatrix.leakage;
+			leakage += wlNewSwitchMatrix.leakage;
+			leakage += slSwitchMatrix.leakage;
+			leakage += mux.leakage;
+			leakage += muxDecoder.leakage;
+			leakage += multilevelSenseAmp.leakage;
+			leakage += multilevelSAEncoder.leakage;
 
+		} else {
+			double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
+			int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
+			double capBL = lengthCol * 0.2e-15/1e-6;
+		
+			if (CMOSAccess) {
+				wlNewSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead);
 			} else {
-				double numReadCells = (int)ceil((double)numCol/numColMuxed);    // similar parameter as numReadCellPerOperationNeuro, which is for SRAM
-				int numWriteOperationPerRow = (int)ceil((double)numCol*activityColWrite/numWriteCellPerOperationNeuro);
-				double capBL = lengthCol * 0.2e-15/1e-6;
-			
-				if (cell.accessType == CMOS_access) {
-					wlNewSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead);
-				} else {
-					wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				}
-				slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
-				mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
-				muxDecoder.CalculatePower(numColMuxed, 1);
-				multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
-				multilevelSAEncoder.CalculatePower(numColMuxed);
-				if (numReadPulse > 1) {
-					shiftAdd.CalculatePower(numColMuxed);
-				}
-				// Read
-				readDynamicEnergyArray = 0;
-				readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
-				readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd * numRow * activityRowRead; // Selected WL
-				readDynamicEnergyArray *= numColMuxed;
-				
-				readDynamicEnergy = 0;
-				readDynamicEnergy += wlNewSwitchMatrix.readDynamicEnergy;
-				readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
-				readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
-				readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
-				readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
-				readDynamicEnergy += shiftAdd.readDynamicEnergy;
-				readDynamicEnergy += readDynamicEnergyArray;
-				
-				// Write				
-				writeDynamicEnergyArray = writeDynamicEnergyArray;
-				writeDynamicEnergy = 0;
-				writeDynamicEnergy += wlNewSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
-				writeDynamicEnergy += writeDynamicEnergyArray;				
-				
-				// Leakage
-				leakage = 0;
-				leakage += wlSwitchMatrix.leakage;
-				leakage += wlNewSwitchMatrix.leakage;
-				leakage += slSwitchMatrix.leakage;
-				leakage += mux.leakage;
-				leakage += muxDecoder.leakage;
-				leakage += multilevelSenseAmp.leakage;
-				leakage += multilevelSAEncoder.leakage;
-				leakage += shiftAdd.leakage;
+				wlSwitchMatrix.CalculatePower(numColMuxed, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
 			}
-		} 
+			slSwitchMatrix.CalculatePower(0, 2*numWriteOperationPerRow*numRow*activityRowWrite, activityRowRead, activityColWrite);
+			mux.CalculatePower(numColMuxed);	// Mux still consumes energy during row-by-row read
+			muxDecoder.CalculatePower(numColMuxed, 1);
+			multilevelSenseAmp.CalculatePower(columnResistance, numColMuxed);
+			multilevelSAEncoder.CalculatePower(numColMuxed);
+			if (numReadPulse > 1) {
+				shiftAdd.CalculatePower(numColMuxed);
+			}
+			// Read
+			readDynamicEnergyArray = 0;
+			readDynamicEnergyArray += capBL * cell.readVoltage * cell.readVoltage * numReadCells; // Selected BLs activityColWrite
+			readDynamicEnergyArray += capRow2 * tech.vdd * tech.vdd * numRow * activityRowRead; // Selected WL
+			readDynamicEnergyArray *= numColMuxed;
+			
+			readDynamicEnergy = 0;
+			readDynamicEnergy += wlNewSwitchMatrix.readDynamicEnergy;
+			readDynamicEnergy += wlSwitchMatrix.readDynamicEnergy;
+			readDynamicEnergy += (mux.readDynamicEnergy + muxDecoder.readDynamicEnergy)/numReadPulse;
+			readDynamicEnergy += multilevelSenseAmp.readDynamicEnergy;
+			readDynamicEnergy += multilevelSAEncoder.readDynamicEnergy;
+			readDynamicEnergy += shiftAdd.readDynamicEnergy;
+			readDynamicEnergy += readDynamicEnergyArray;
+			
+			// Write				
+			writeDynamicEnergyArray = writeDynamicEnergyArray;
+			writeDynamicEnergy = 0;
+			writeDynamicEnergy += wlNewSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += wlSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += slSwitchMatrix.writeDynamicEnergy;
+			writeDynamicEnergy += writeDynamicEnergyArray;				
+			
+			// Leakage
+			leakage = 0;
+			leakage += wlSwitchMatrix.leakage;
+			leakage += wlNewSwitchMatrix.leakage;
+			leakage += slSwitchMatrix.leakage;
+			leakage += mux.leakage;
+			leakage += muxDecoder.leakage;
+			leakage += multilevelSenseAmp.leakage;
+			leakage += multilevelSAEncoder.leakage;
+			leakage += shiftAdd.leakage;
+		}
+	} 
+}
+
+void SubArray::CalculateWrite(double numRowWrite) {   // program numRowWrite whole rows, e.g. a GEMM operand produced at run time that stays in the array
+	if (!initialized) {
+		cout << "[Subarray] Error: Require initialization first!" << endl;
+	} else {
+		writeLatency = 0;
+		writeDynamicEnergy = 0;
+		if (cell.memCellType == Type::SRAM) {
+			// one write operation per row: the write drivers pull down one bit line of each pair and the cells flip Q and Q_bar (average delay of pullup and pulldown inverter),
+			// the precharger restores the bit line afterwards
+			double resPull = (CalculateOnResistance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, inputParameter.temperature, tech) + CalculateOnResistance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, inputParameter.temperature, tech)) / 2;
+			double tau = resPull * cell.capSRAMCell;
+			double gm = (CalculateTransconductance(cell.widthSRAMCellNMOS * tech.featureSize, NMOS, tech) + CalculateTransconductance(cell.widthSRAMCellPMOS * tech.featureSize, PMOS, tech)) / 2;
+			double beta = 1 / (resPull * gm);
+			sramWriteDriver.CalculateLatency(1e20, capCol, resCol, numRowWrite);
+			writeLatencyArray = horowitz(tau, beta, 1e20, NULL) * numRowWrite;
+			writeLatency = sramWriteDriver.writeLatency + writeLatencyArray;
+			
+			writeDynamicEnergyArray = cell.capSRAMCell * tech.vdd * tech.vdd * 2 * numCol * numRowWrite;    // flip Q and Q_bar
+			writeDynamicEnergy = writeDynamicEnergyArray + capCol * tech.vdd * tech.vdd * numCol * numRowWrite;
+		} else {
+			// eNVM: the cells of a row are programmed in parallel, numWritePulse pulses of writePulseWidth at writeVoltage each
+			writeLatencyArray = param->numWritePulse * cell.writePulseWidth * numRowWrite;
+			writeLatency = writeLatencyArray;
+			
+			writeDynamicEnergyArray = cell.writeVoltage * cell.writeVoltage / cell.resistanceAvg * cell.writePulseWidth * param->numWritePulse * numCol * numRowWrite;
+			writeDynamicEnergy = writeDynamicEnergyArray + capCol * cell.writeVoltage * cell.writeVoltage * numCol * numRowWrite;   // charge the bit lines of the row
+		}
 	}
 }
 
@@ -1602,3 +1732,38 @@ void SubArray::PrintProperty() {
 	cout << "Empty Area = " << emptyArea*1e12 << "um^2" << endl;
 }
 
+void SubArray::AccumulateBreakdown() {
+	// split the last read (CalculateLatency + CalculatePower) into the circuits, what the circuits do not explain is the array (wires and cells)
+	FunctionUnit *unit[numBreakdown-2] = {&wlDecoder, &wlDecoderOutput, &wlNewDecoderDriver, &wlNewSwitchMatrix, &rowCurrentSenseAmp, &mux, &muxDecoder,
+										&slSwitchMatrix, &blSwitchMatrix, &wlSwitchMatrix, &deMux, &readCircuit, &precharger, &senseAmp, &colDecoder,
+										&wlDecoderDriver, &colDecoderDriver, &sramWriteDriver, &dff, &adder, &shiftAdd, &multilevelSenseAmp, &multilevelSAEncoder};
+	bool used[numBreakdown-2] = {wlDecoder.initialized, wlDecoderOutput.initialized, wlNewDecoderDriver.initialized, wlNewSwitchMatrix.initialized,
+										rowCurrentSenseAmp.initialized, mux.initialized, muxDecoder.initialized, slSwitchMatrix.initialized, blSwitchMatrix.initialized,
+										wlSwitchMatrix.initialized, deMux.initialized, readCircuit.initialized, precharger.initialized, senseAmp.initialized,
+										colDecoder.initialized, wlDecoderDriver.initialized, colDecoderDriver.initialized, sramWriteDriver.initialized, dff.initialized,
+										adder.initialized, shiftAdd.initialized, multilevelSenseAmp.initialized, multilevelSAEncoder.initialized};
+	double sumLatency = 0, sumEnergy = 0;
+	for (int i=0; i<numBreakdown-2; i++) {
+		if (used[i]) {
+			breakdownLatency[i] += unit[i]->readLatency;
+			breakdownEnergy[i] += unit[i]->readDynamicEnergy;
+			sumLatency += unit[i]->readLatency;
+			sumEnergy += unit[i]->readDynamicEnergy;
+		}
+	}
+	breakdownLatency[numBreakdown-2] += readLatencyDAC;
+	breakdownEnergy[numBreakdown-2] += readDynamicEnergyDAC;
+	breakdownLatency[numBreakdown-1] += MAX(readLatency - sumLatency - readLatencyDAC, 0);
+	breakdownEnergy[numBreakdown-1] += MAX(readDynamicEnergy - sumEnergy - readDynamicEnergyDAC, 0);
+}
+
+void SubArray::FlushBreakdown(double latencyFactor, double energyFactor) {
+	static const char *name[numBreakdown] = {"wlDecoder", "wlDecoderOutput", "wlNewDecoderDriver", "wlNewSwitchMatrix", "rowCurrentSenseAmp", "mux", "muxDecoder",
+										"slSwitchMatrix", "blSwitchMatrix", "wlSwitchMatrix", "deMux", "readCircuit", "precharger", "senseAmp", "colDecoder",
+										"wlDecoderDriver", "colDecoderDriver", "sramWriteDriver", "dff", "adder", "shiftAdd", "multilevelSenseAmp", "multilevelSAEncoder", "wordlineDAC", "array"};
+	for (int i=0; i<numBreakdown; i++) {
+		BreakdownAdd(name[i], breakdownLatency[i]*latencyFactor, breakdownEnergy[i]*energyFactor);
+		breakdownLatency[i] = 0;
+		breakdownEnergy[i] = 0;
+	}
+}
@@ -70,10 +70,10 @@ using namespace std;
 
 class SubArray: public FunctionUnit {
 public:
-	SubArray(InputParameter& _inputParameter, Technology& _tech, MemCell& _cell);
+	SubArray(InputParameter& _inputParameter, const Technology& _tech, MemCell& _cell);
 	virtual ~SubArray() {}
 	InputParameter& inputParameter;
-	Technology& tech;
+	const Technology& tech;
 	MemCell& cell;
 
 	/* Functions */
@@ -82,9 +82,18 @@ public:
 	void CalculateArea();
 	void CalculateLatency(double _rampInput, const vector<double> &columnResistance);
 	void CalculatePower(const vector<double> &columnResistance);
+	void CalculateWrite(double numRowWrite);
+	double RowDriverUnit(double driver, double decoder);
+	void SelectKernel();
+	template <bool SRAMCell, int operationMode, bool CMOSAccess> void CalculateLatencyKernel(double columnRes, const vector<double> &columnResistance);
+	template <bool SRAMCell, int operationMode, bool CMOSAccess> void CalculatePowerKernel(const vector<double> &columnResistance);
+	void AccumulateBreakdown();
+	void FlushBreakdown(double latencyFactor, double energyFactor);
 
 	/* Properties */	
 	bool initialized;	   // Initialization flag
+	void (SubArray::*latencyKernel)(double, const vector<double> &);   // CalculateLatency/CalculatePower of this cell type, operation mode and access type, set by Initialize
+	void (SubArray::*powerKernel)(const vector<double> &);
 	int numRow;			   // Number of rows
 	int numCol;			   // Number of columns
 	
@@ -114,6 +123,8 @@ public:
 	double activityColWrite;	// Activity for # of columns in the write
 	double activityRowRead;		// Activity for # of rows in the read
 	int numReadPulse;		// # of read pulses for the input vector
+	int numBitPerReadPulse;	// # of input bits applied by each read pulse (multi-level wordline drive)
+	double readLatencyDAC, readDynamicEnergyDAC;	// wordline DACs of the multi-level drive in the last read (RowDriverUnit)
 	double numWritePulse;	// Average number of write pulse
 	int maxNumWritePulse;	// Max # of write pulses for the device
 	int maxNumIntBit;		// Max # bits for the integrate-and-fire neuron
@@ -154,6 +165,9 @@ public:
 	bool relaxArrayCellHeight;	// true: relax the memory cell height to match the height of periperal circuit unit that connects to the row (ex: standard cell height in the last stage of row decoder) if the latter is larger
 	bool relaxArrayCellWidth;	// true: relax the memory cell width to match the width of periperal circuit unit that connects to the column (ex: pass gate width in the column mux) if the latter is larger
 
+	static const int numBreakdown = 25;	// peripheral circuits below + the wordline DACs + the array itself
+	double breakdownLatency[numBreakdown], breakdownEnergy[numBreakdown];	// per-circuit sums over the input vectors since the last FlushBreakdown
+	
 	double areaADC, areaAccum, areaOther, readLatencyADC, readLatencyAccum, readLatencyOther, readDynamicEnergyADC, readDynamicEnergyAccum, readDynamicEnergyOther;
 
 	/* Circuit modules */
@@ -41,6 +41,20 @@
 
 #include "typedef.h"
 
+/* Device data of one (transistor type, node, roadmap), the currents are sampled every 10K from 300K to 400K */
+struct TechnologyNode {
+	double vdd, vth;
+	double heightFin, widthFin, PitchFin;	/* 0 for planar devices */
+	double phyGateLength, capIdealGate, capFringe;
+	double effectiveResistanceMultiplier;
+	double current_gmNmos, current_gmPmos;
+	double pnSizeRatio;
+	double currentOnNmos[11], currentOnPmos[11], currentOffNmos[11], currentOffPmos[11];
+};
+
+/* Returns NULL if the node is not supported */
+const TechnologyNode *TechnologyLookup(TransistorType transistorType, int featureSizeInNano, DeviceRoadmap deviceRoadmap);
+
 class Technology {
 public:
 	Technology();
@@ -0,0 +1,343 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cstdio>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <stdlib.h>
+#include <vector>
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+#include "constant.h"
+#include "formula.h"
+#include "Param.h"
+#include "Tile.h"
+#include "Chip.h"
+#include "ProcessingUnit.h"
+#include "SubArray.h"
+#include "HTree.h"
+#include "MultilevelSenseAmp.h"
+#include "Definition.h"
+
+using namespace std;
+
+/*** Micro-benchmarks of the hot kernels of the simulator ("make bench", then ./bench [options]) ***/
+// --out bench.json      write the results there instead of stdout
+// --filter name         only run the benchmarks whose name contains this
+// --min-time 0.2        seconds of each timed repetition (5 repetitions, the median is reported)
+// --trace-size 1024     rows and columns of the synthetic weight/input traces for the load benchmarks
+// every input is generated from a fixed seed, so two runs time exactly the same work
+
+struct BenchResult {
+	string name;
+	long long iterations;       // per repetition
+	double medianNs, minNs, maxNs;
+};
+
+vector<BenchResult> benchResult;
+string benchFilter;
+double benchMinTime = 0.2;
+volatile double benchSink = 0;      // results are accumulated here, so the work cannot be optimized away
+
+template <typename F>
+void Bench(const string &name, F body) {
+	if (!benchFilter.empty() && name.find(benchFilter) == string::npos) {
+		return;
+	}
+	// calibrate the # of iterations, then time 5 repetitions of it
+	long long n = 1;
+	while (true) {
+		auto start = chrono::steady_clock::now();
+		for (long long i=0; i<n; i++) {
+			body(i);
+		}
+		double time = chrono::duration<double>(chrono::steady_clock::now()-start).count();
+		if (time >= benchMinTime/4 || n >= (1LL<<30)) {
+			n = max(1LL, (long long) ceil(n*benchMinTime/max(time, 1e-9)));
+			break;
+		}
+		n *= (time > 0)? max(2.0, min(100.0, benchMinTime/4/time)) : 100;
+	}
+	vector<double> sample;
+	for (int r=0; r<5; r++) {
+		auto start = chrono::steady_clock::now();
+		for (long long i=0; i<n; i++) {
+			body(i);
+		}
+		sample.push_back(chrono::duration<double, nano>(chrono::steady_clock::now()-start).count()/n);
+	}
+	sort(sample.begin(), sample.end());
+	BenchResult result = {name, n, sample[2], sample[0], sample[4]};
+	benchResult.push_back(result);
+	cerr << left << setw(48) << name << right << setw(16) << sample[2] << " ns" << endl;
+}
+
+
+void ConfigureParam(int operationmode, int memcelltype, int numRowSubArray, int numColSubArray) {
+	// fresh default parameters with the given mode, same precision setup as main (8-bit weight and input)
+	delete param;
+	param = new Param();
+	param->operationmode = operationmode;
+	param->memcelltype = memcelltype;
+	param->numRowSubArray = numRowSubArray;
+	param->numColSubArray = numColSubArray;
+	param->synapseBit = 8;
+	param->numBitInput = 8;
+	param->Initialize();
+	if (param->cellBit > param->synapseBit) {
+		param->cellBit = param->synapseBit;
+	}
+	param->numRowPerSynapse = 1;
+	param->numColPerSynapse = ceil((double)param->synapseBit/(double)param->cellBit);
+	if (param->BNNparallelMode) {
+		param->numColPerSynapse = 2;        // binary weight and its complement on two columns (LoadInWeightData)
+	} else if (param->XNORparallelMode || param->XNORsequentialMode) {
+		param->numRowPerSynapse = 2;        // binary weight and its complement on two rows, read by the input and its complement
+		param->numColPerSynapse = 1;
+	}
+	tech.initialized = false;       // re-initialized by ProcessingUnitInitialize
+}
+
+
+void WriteSyntheticTrace(const string &filename, int numRow, int numCol, bool binary) {
+	// weights uniform in (-1, 1), or 0/1 input bits
+	mt19937 traceGen(0);
+	uniform_real_distribution<double> uniform(-1, 1);
+	ofstream file(filename.c_str());
+	file << fixed << setprecision(5);
+	for (int i=0; i<numRow; i++) {
+		for (int j=0; j<numCol; j++) {
+			double x = uniform(traceGen);
+			if (binary) {
+				file << (x > 0? 1 : 0);
+			} else {
+				file << x;
+			}
+			file << (j < numCol-1? "," : "\n");
+		}
+	}
+	file.close();
+}
+
+
+vector<vector<double> > SyntheticMemory(int numRow, int numCol, mt19937 &benchGen) {
+	// conductances in the device range, at the cellBit levels
+	int numLevel = pow(2, param->cellBit);
+	uniform_int_distribution<int> level(0, numLevel-1);
+	vector<vector<double> > memory(numRow, vector<double>(numCol));
+	for (int i=0; i<numRow; i++) {
+		for (int j=0; j<numCol; j++) {
+			memory[i][j] = param->minConductance + (param->maxConductance-param->minConductance)*level(benchGen)/max(numLevel-1, 1);
+		}
+	}
+	return memory;
+}
+
+
+vector<vector<double> > SyntheticInput(int numRow, int numVector, mt19937 &benchGen) {
+	bernoulli_distribution bit(0.5);
+	vector<vector<double> > input(numRow, vector<double>(numVector));
+	for (int i=0; i<numRow; i++) {
+		for (int k=0; k<numVector; k++) {
+			input[i][k] = bit(benchGen);
+		}
+	}
+	return input;
+}
+
+
+int main(int argc, char * argv[]) {
+	
+	string outFile;
+	int traceSize = 1024;
+	for (int i=1; i<argc; i++) {
+		string option = argv[i];
+		if (option == "--out" && i+1 < argc) {
+			outFile = argv[++i];
+		} else if (option == "--filter" && i+1 < argc) {
+			benchFilter = argv[++i];
+		} else if (option == "--min-time" && i+1 < argc) {
+			benchMinTime = atof(argv[++i]);
+		} else if (option == "--trace-size" && i+1 < argc) {
+			traceSize = atoi(argv[++i]);
+		} else {
+			cerr << "usage: " << argv[0] << " [--out file.json] [--filter name] [--min-time seconds] [--trace-size n]" << endl;
+			return 1;
+		}
+	}
+	const int numVector = 64;       // distinct input vectors cycled through by the per-vector benchmarks
+	
+	/*** trace loading ***/
+	ConfigureParam(2, 2, 128, 128);
+	string weightFile = "bench_weight.csv", inputFile = "bench_input.csv";
+	WriteSyntheticTrace(weightFile, traceSize, traceSize, false);
+	WriteSyntheticTrace(inputFile, traceSize, traceSize, true);
+	Bench("LoadInWeightData/" + to_string(traceSize) + "x" + to_string(traceSize), [&](long long i) {
+		benchSink += LoadInWeightData(weightFile, param->numRowPerSynapse, param->numColPerSynapse, param->maxConductance, param->minConductance, 1, 0, 0).size();
+	});
+	Bench("LoadInInputData/" + to_string(traceSize) + "x" + to_string(traceSize), [&](long long i) {
+		benchSink += LoadInInputData(inputFile).size();
+	});
+	remove(weightFile.c_str());
+	remove(inputFile.c_str());
+	
+	/*** column resistance of one input vector ***/
+	int subArraySize[3] = {64, 128, 256};
+	for (int s=0; s<3; s++) {
+		int size = subArraySize[s];
+		ConfigureParam(2, 2, size, size);
+		SubArray *subArray;
+		ProcessingUnitInitialize(subArray, inputParameter, tech, cell, 1, 1);
+		mt19937 benchGen(0);
+		vector<vector<double> > memory = SyntheticMemory(size, size, benchGen);
+		vector<vector<double> > input = SyntheticInput(size, numVector, benchGen);
+		vector<vector<double> > inputVector(numVector);
+		for (int k=0; k<numVector; k++) {
+			double activityRowRead;
+			inputVector[k] = GetInputVector(input, k, &activityRowRead);
+		}
+		vector<double> columnResistance;     // reused, as in the simulation loop
+		Bench("GetColumnResistance/" + to_string(size), [&](long long i) {
+			GetColumnResistance(inputVector[i%numVector], memory, cell, param->parallelRead, subArray->resCellAccess, &columnResistance);
+			benchSink += columnResistance[0];
+		});
+		delete subArray;
+	}
+	
+	/*** subArray read of one input vector, per operation mode and cell type ***/
+	const char *cellName[4] = {"", "SRAM", "RRAM", "FeFET"};
+	for (int mode=1; mode<=6; mode++) {
+		for (int type=1; type<=3; type++) {
+			ConfigureParam(mode, type, 128, 128);
+			SubArray *subArray;
+			ProcessingUnitInitialize(subArray, inputParameter, tech, cell, 1, 1);
+			subArray->levelOutput = param->parallelRead? param->levelOutput : pow(2, param->cellBit);
+			mt19937 benchGen(0);
+			vector<vector<double> > memory = SyntheticMemory(param->numRowSubArray, param->numColSubArray, benchGen);
+			vector<vector<double> > input = SyntheticInput(param->numRowSubArray, numVector, benchGen);
+			vector<vector<double> > columnResistance(numVector);
+			vector<double> activity(numVector);
+			for (int k=0; k<numVector; k++) {
+				vector<double> inputVector = GetInputVector(input, k, &activity[k]);
+				columnResistance[k] = GetColumnResistance(inputVector, memory, cell, param->parallelRead, subArray->resCellAccess);
+			}
+			Bench("SubArray/operationmode" + to_string(mode) + "/" + cellName[type], [&](long long i) {
+				subArray->activityRowRead = activity[i%numVector];
+				subArray->CalculateLatency(1e20, columnResistance[i%numVector]);
+				subArray->CalculatePower(columnResistance[i%numVector]);
+				benchSink += subArray->readLatency + subArray->readDynamicEnergy;
+			});
+			delete subArray;
+		}
+	}
+	
+	/*** multilevel sense amplifier (ADC) of one subArray read ***/
+	ConfigureParam(2, 2, 128, 128);
+	SubArray *subArray;
+	ProcessingUnitInitialize(subArray, inputParameter, tech, cell, 1, 1);
+	MultilevelSenseAmp multilevelSenseAmp(inputParameter, tech, cell);
+	multilevelSenseAmp.Initialize(param->numColSubArray/param->numColMuxed, param->levelOutput, param->clkFreq, param->numColSubArray, true);
+	{
+		mt19937 benchGen(0);
+		vector<vector<double> > memory = SyntheticMemory(param->numRowSubArray, param->numColSubArray, benchGen);
+		vector<vector<double> > input = SyntheticInput(param->numRowSubArray, numVector, benchGen);
+		vector<vector<double> > columnResistance(numVector);
+		for (int k=0; k<numVector; k++) {
+			double activityRowRead;
+			vector<double> inputVector = GetInputVector(input, k, &activityRowRead);
+			columnResistance[k] = GetColumnResistance(inputVector, memory, cell, param->parallelRead, subArray->resCellAccess);
+			columnResistance[k].resize(param->numColSubArray/param->numColMuxed);
+		}
+		Bench("MultilevelSenseAmp/" + to_string(param->levelOutput) + "level", [&](long long i) {
+			multilevelSenseAmp.CalculateLatency(columnResistance[i%numVector], param->numColMuxed, 1);
+			multilevelSenseAmp.CalculatePower(columnResistance[i%numVector], 1);
+			benchSink += multilevelSenseAmp.readLatency + multilevelSenseAmp.readDynamicEnergy;
+		});
+	}
+	
+	/*** global H-tree of a 16x16-tile chip ***/
+	HTree hTree(inputParameter, tech, cell);
+	hTree.Initialize(16, 16, param->globalBusDelayTolerance, 1024);
+	hTree.CalculateArea(1e-3, 1e-3, param->treeFoldedRatio);
+	Bench("HTree::CalculateLatency/16x16", [&](long long i) {
+		hTree.CalculateLatency(i%16, (i/16)%16, 0, 0, 1e-3, 1e-3, 1000);
+		benchSink += hTree.readLatency;
+	});
+	
+	/*** floorplan of the default network (VGG-8 on CIFAR-10, NetWork.csv) ***/
+	double layer[8][7] = {{32,32,3,3,3,128,0}, {32,32,128,3,3,128,1}, {16,16,128,3,3,256,0}, {16,16,256,3,3,256,1},
+						{8,8,256,3,3,512,0}, {8,8,512,3,3,512,1}, {1,1,8192,1,1,1024,0}, {1,1,1024,1,1,10,0}};
+	vector<vector<double> > netStructure;
+	for (int l=0; l<8; l++) {
+		netStructure.push_back(vector<double>(layer[l], layer[l]+7));
+		LayerNormalize(&netStructure[l]);
+	}
+	double maxPESizeNM, maxTileSizeCM, numPENM;
+	vector<int> markNM = ChipDesignInitialize(inputParameter, tech, cell, netStructure, &maxPESizeNM, &maxTileSizeCM, &numPENM);
+	Bench("ChipFloorPlan/VGG8", [&](long long i) {
+		double desiredNumTileNM, desiredPESizeNM, desiredNumTileCM, desiredTileSizeCM, desiredPESizeCM;
+		int numTileRow, numTileCol;
+		for (int k=0; k<4; k++) {     // the 4 calls main makes (tiles, utilization, speed-up, location)
+			benchSink += ChipFloorPlan(k==0, k==1, k==2, netStructure, markNM, maxPESizeNM, maxTileSizeCM, numPENM,
+							&desiredNumTileNM, &desiredPESizeNM, &desiredNumTileCM, &desiredTileSizeCM, &desiredPESizeCM, &numTileRow, &numTileCol).size();
+		}
+	});
+	
+	/*** results ***/
+	ofstream file;
+	if (!outFile.empty()) {
+		file.open(outFile.c_str());
+		if (!file.good()) {
+			cerr << "Error: the output file " << outFile << " cannot be opened!" << endl;
+			return 1;
+		}
+	}
+	ostream &out = outFile.empty()? cout : file;
+	out << "{\n  \"minTime\": " << benchMinTime << ",\n  \"traceSize\": " << traceSize << ",\n  \"benchmarks\": [";
+	for (int i=0; i<benchResult.size(); i++) {
+		out << (i > 0? ",\n" : "\n") << "    {\"name\": \"" << benchResult[i].name << "\", \"iterations\": " << benchResult[i].iterations
+			<< ", \"medianNs\": " << benchResult[i].medianNs << ", \"minNs\": " << benchResult[i].minNs << ", \"maxNs\": " << benchResult[i].maxNs << "}";
+	}
+	out << "\n  ]\n}" << endl;
+	return 0;
+}
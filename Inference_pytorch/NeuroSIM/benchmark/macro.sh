@@ -0,0 +1,34 @@
+#!/bin/bash
+# End-to-end simulator throughput on synthetic traces (no PyTorch needed): make macrobench, or
+#   benchmark/macro.sh [network.csv ...]         (from the NeuroSIM directory, default: VGG-8, ResNet-like and large-FC)
+# environment: WEIGHT_BIT (8), INPUT_BIT (8), SPARSITY (0.5), SEED (0)
+# one JSON object per network on stdout; an input vector is one sliding window of one layer, as in the --profile output
+
+cd "$(dirname "$0")/.." || exit 1
+make -s main tracegen || exit 1
+
+WEIGHT_BIT=${WEIGHT_BIT:-8}
+INPUT_BIT=${INPUT_BIT:-8}
+SPARSITY=${SPARSITY:-0.5}
+SEED=${SEED:-0}
+if [ $# -gt 0 ]; then
+	networks="$@"
+else
+	networks="NetWork.csv benchmark/ResNet.csv benchmark/LargeFC.csv"
+fi
+
+for network in $networks; do
+	traceDir=$(mktemp -d)
+	traces=$(./tracegen "$network" $WEIGHT_BIT $INPUT_BIT "$traceDir" --sparsity $SPARSITY --seed $SEED) || exit 1
+	start=$(date +%s.%N)
+	./main "$network" $WEIGHT_BIT $INPUT_BIT $traces > "$traceDir/main.out" || { echo "main failed on $network, see $traceDir/main.out" >&2; exit 1; }
+	stop=$(date +%s.%N)
+	awk -F, -v network="$network" -v start=$start -v stop=$stop '
+		NF >= 6 { numLayer++; numVector += ($1-$4+1)*($2-$5+1) }
+		END {
+			time = stop-start
+			printf "{\"network\": \"%s\", \"numLayer\": %d, \"numInputVector\": %d, \"seconds\": %.3f, \"layersPerSecond\": %.4g, \"inputVectorsPerSecond\": %.4g}\n",
+				network, numLayer, numVector, time, numLayer/time, numVector/time
+		}' "$network"
+	rm -rf "$traceDir"
+done
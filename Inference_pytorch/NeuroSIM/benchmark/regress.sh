@@ -0,0 +1,139 @@
+#!/bin/bash
+# Golden-output regression test of the simulator (no PyTorch needed): make regress, or
+#   benchmark/regress.sh [--update] [--tolerance 1e-9]   (from the NeuroSIM directory)
+# runs main on fixed synthetic traces of benchmark/Regression.csv for every operationmode (1-6) and memcelltype (1-3),
+# with 8-bit weights (the BNN/XNOR modes map each weight to one binary synapse, see numRowPerSynapse/numColPerSynapse in main.cpp),
+# and compares every metric of the --report output with benchmark/golden/op<mode>_cell<type>.csv (relative tolerance);
+# --update rewrites the goldens instead, only do this for an intended change of the results
+# simulation/runTime and profile/* are wall-clock times and not compared; exit status is the number of failed configurations
+# (plus one if the multi-bit input check fails: with 4 input bits per read cycle the input buffer and bus move the same bits, so their energy stays that of the bit-serial run)
+# benchmark/Depthwise.csv (grouped layers packed into row bands) has its own golden, and each grouped layer must report numOutputChannel = M
+
+cd "$(dirname "$0")/.." || exit 1
+make -s main tracegen || exit 1
+
+update=0
+tolerance=1e-9
+while [ $# -gt 0 ]; do
+	case "$1" in
+		--update)		update=1 ;;
+		--tolerance)	tolerance=$2; shift ;;
+		*)				echo "usage: $0 [--update] [--tolerance 1e-9]" >&2; exit 255 ;;
+	esac
+	shift
+done
+
+network=benchmark/Regression.csv
+goldenDir=benchmark/golden
+traceDir=$(mktemp -d)
+mkdir -p "$traceDir/w8"
+traces8=$(./tracegen $network 8 8 "$traceDir/w8" --sparsity 0.5 --seed 0) || exit 255
+depthwise=benchmark/Depthwise.csv
+mkdir -p "$traceDir/depthwise"
+tracesDepthwise=$(./tracegen $depthwise 8 8 "$traceDir/depthwise" --sparsity 0.5 --seed 0) || exit 255
+
+# check <name> <network> <weightBit> <traces> [main options]: run main and compare its report with benchmark/golden/<name>.csv
+check() {
+	local name=$1 network=$2 weightBit=$3 traces=$4
+	shift 4
+	local golden=$goldenDir/$name.csv
+	if ! ./main $network $weightBit 8 $traces "$@" --report "$traceDir/$name.csv" > "$traceDir/$name.out"; then
+		echo "FAIL $name: main failed, see $traceDir/$name.out"
+		numFail=$((numFail+1))
+		return 1
+	fi
+	grep -v -e '^simulation,runTime,' -e '^profile/' "$traceDir/$name.csv" > "$traceDir/$name.filtered"
+	if [ $update -eq 1 ]; then
+		cp "$traceDir/$name.filtered" "$golden"
+		echo "UPDATE $name"
+		return 0
+	fi
+	if [ ! -f "$golden" ]; then
+		echo "FAIL $name: no golden $golden, run with --update first"
+		numFail=$((numFail+1))
+		return 1
+	fi
+	# key = scope,metric; values that are identical strings (also nan/inf) always match
+	awk -F, -v tolerance=$tolerance -v name=$name '
+		FNR == 1 { next }
+		NR == FNR { golden[$1 "," $2] = $3; next }
+		{
+			key = $1 "," $2
+			seen[key] = 1
+			if (!(key in golden)) { print "  extra metric " key " = " $3; numFail++; next }
+			expected = golden[key]
+			if ($3 == expected) next
+			if (expected ~ /nan|inf/ || $3 ~ /nan|inf/) { print "  " key ": " $3 " (golden " expected ")"; numFail++; next }
+			diff = $3 - expected; if (diff < 0) diff = -diff
+			scale = expected < 0 ? -expected : expected
+			if (diff > tolerance*scale) { printf "  %s: %s (golden %s, relative error %.3g)\n", key, $3, expected, (scale > 0 ? diff/scale : diff); numFail++ }
+		}
+		END {
+			for (key in golden) if (!(key in seen)) { print "  missing metric " key; numFail++ }
+			exit (numFail > 0)
+		}' "$golden" "$traceDir/$name.filtered" > "$traceDir/$name.diff"
+	if [ $? -eq 0 ]; then
+		echo "PASS $name"
+	else
+		echo "FAIL $name: $(grep -c . "$traceDir/$name.diff") metrics differ"
+		head -20 "$traceDir/$name.diff"
+		numFail=$((numFail+1))
+		return 1
+	fi
+}
+
+numFail=0
+for mode in 1 2 3 4 5 6; do
+	for type in 1 2 3; do
+		check op${mode}_cell${type} $network 8 "$traces8" --operationmode $mode --memcelltype $type
+	done
+done
+
+numCheck=18
+for bitPerCycle in 1 4; do
+	./main $network 8 8 $traces8 --operationmode 2 --memcelltype 1 --inputbitpercycle $bitPerCycle --folded "$traceDir/input$bitPerCycle" \
+		--report "$traceDir/input$bitPerCycle.csv" > "$traceDir/input$bitPerCycle.out"
+done
+if [ $update -eq 0 ]; then
+	numCheck=19
+	awk -F, -v tolerance=$tolerance '
+		$1 !~ /^breakdown\/(inputBuffer|bufferInput|busInput)$/ || $2 != "readDynamicEnergy" { next }
+		NR == FNR { serial[$1] = $3; next }
+		{
+			seen++
+			diff = $3 - serial[$1]; if (diff < 0) diff = -diff
+			if (!($1 in serial) || diff > tolerance*serial[$1]) { print "  " $1 ": " $3 " (bit-serial " serial[$1] ")"; numFail++ }
+		}
+		END { exit (numFail > 0 || seen != 3) }' "$traceDir/input1.csv" "$traceDir/input4.csv" > "$traceDir/input.diff"
+	if [ $? -eq 0 ]; then
+		echo "PASS multi-bit input"
+	else
+		echo "FAIL multi-bit input: the input buffer/bus energy changed with 4 input bits per read cycle"
+		cat "$traceDir/input.diff"
+		numFail=$((numFail+1))
+	fi
+fi
+
+# grouped layers packed into row bands: every band sends out the output channels of its own groups, so a layer reports numOutputChannel = M
+numCheck=$((numCheck+1))
+if check depthwise $depthwise 8 "$tracesDepthwise" --operationmode 2 --memcelltype 1 && [ $update -eq 0 ]; then
+	numCheck=$((numCheck+1))
+	awk -F, '
+		NR == FNR { numLayer++; if ($10 > 1) { M["layer" numLayer] = $6; numGrouped++ }; next }
+		$2 == "numOutputChannel" { seen++; if ($3 != M[$1]) { print "  " $1 ": " $3 " output channels (M = " M[$1] ")"; numFail++ } }
+		END { exit (numFail > 0 || seen != numGrouped) }' $depthwise "$traceDir/depthwise.csv" > "$traceDir/depthwiseOutput.diff"
+	if [ $? -eq 0 ]; then
+		echo "PASS depthwise output channels"
+	else
+		echo "FAIL depthwise output channels: a packed grouped layer does not send out M output channels"
+		cat "$traceDir/depthwiseOutput.diff"
+		numFail=$((numFail+1))
+	fi
+fi
+
+if [ $numFail -eq 0 ]; then
+	rm -rf "$traceDir"
+else
+	echo "$numFail of $numCheck configurations failed, outputs are in $traceDir"
+fi
+exit $numFail
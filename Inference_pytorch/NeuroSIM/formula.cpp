@@ -41,21 +41,30 @@
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
 #include "constant.h"
 #include "formula.h"
+#include "Param.h"
+#include "Report.h"
 
 using namespace std;
 
+extern Param *param;
+
 /* Beyond 22 nm technology, the value capIdealGate is the sum of capIdealGate and capOverlap and capFringe */
-double CalculateGateCap(double width, Technology tech) {
+double CalculateGateCap(double width, const Technology& tech) {
 	return (tech.capIdealGate + tech.capOverlap + tech.capFringe) * width   // 3 * tech.capFringe
 			+ tech.phyGateLength * tech.capPolywire;
 }
 
-double CalculateGateArea(	// Calculate layout area and width of logic gate given fixed layout height
+static double CalculateGateAreaUncached(	// Calculate layout area and width of logic gate given fixed layout height
 		int gateType, int numInput,
 		double widthNMOS, double widthPMOS,
-		double heightTransistorRegion, Technology tech,
+		double heightTransistorRegion, const Technology& tech,
 		double *height, double *width) {
 	double	ratio = widthPMOS / (widthPMOS + widthNMOS);
 
@@ -185,10 +194,10 @@ double CalculateGateArea(	// Calculate layout area and width of logic gate given
 	return (*width)*(*height);
 }
 
-void CalculateGateCapacitance(
+static void CalculateGateCapacitanceUncached(
 		int gateType, int numInput,
 		double widthNMOS, double widthPMOS,
-		double heightTransistorRegion, Technology tech,
+		double heightTransistorRegion, const Technology& tech,
 		double *capInput, double *capOutput) {
 
 	double	ratio = widthPMOS / (widthPMOS + widthNMOS);
@@ -381,9 +390,154 @@ void CalculateGateCapacitance(
 }
 
 
+/*** Gate characterization cache: the circuit models ask for the same few INV/NAND/NOR sizes over and over ***/
+// keyed on the exact bits of the inputs, so a hit returns exactly what the calculation above would
+// each thread has its own cache, the hit counts are only merged when they are printed
+
+const int maxNumGateCache = 1 << 16;     // entries per cache and thread, further sizes are calculated without being kept
+
+struct GateKey {
+	const Technology *tech;
+	int featureSizeInNano, transistorType, deviceRoadmap;   // the technology handle can be re-initialized to another node
+	int gateType, numInput;
+	double widthNMOS, widthPMOS, heightTransistorRegion;
+	
+	bool operator==(const GateKey &k) const {
+		return tech == k.tech && featureSizeInNano == k.featureSizeInNano && transistorType == k.transistorType && deviceRoadmap == k.deviceRoadmap
+				&& gateType == k.gateType && numInput == k.numInput && !memcmp(&widthNMOS, &k.widthNMOS, 3*sizeof(double));
+	}
+};
+
+struct GateKeyHash {
+	size_t operator()(const GateKey &k) const {
+		uint64_t bits[3];
+		memcpy(bits, &k.widthNMOS, sizeof(bits));
+		uint64_t h = (uint64_t) k.tech ^ ((uint64_t) k.featureSizeInNano << 16) ^ ((uint64_t) k.transistorType << 40) ^ ((uint64_t) k.deviceRoadmap << 44)
+					^ ((uint64_t) k.gateType << 48) ^ ((uint64_t) k.numInput << 56);
+		for (int i=0; i<3; i++) {
+			h = (h ^ bits[i]) * 0x100000001b3ULL;
+			h ^= h >> 29;
+		}
+		return h;
+	}
+};
+
+struct GateArea {
+	double area, height, width;
+};
+
+struct GateCapacitance {
+	double capInput, capOutput;
+};
+
+struct GateCache {
+	unordered_map<GateKey, GateArea, GateKeyHash> area;
+	unordered_map<GateKey, GateCapacitance, GateKeyHash> capacitance;
+	long long numAreaHit, numAreaMiss, numCapHit, numCapMiss;
+};
+
+mutex gateCacheMutex;                  // only taken once per thread and when printing
+vector<GateCache *> gateCacheTable;
+thread_local GateCache *gateThreadCache = NULL;
+
+GateCache *GetGateCache() {
+	if (!gateThreadCache) {
+		gateThreadCache = new GateCache();   // zero-initialized, kept until the end of the program
+		lock_guard<mutex> lock(gateCacheMutex);
+		gateCacheTable.push_back(gateThreadCache);
+	}
+	return gateThreadCache;
+}
+
+GateKey MakeGateKey(int gateType, int numInput, double widthNMOS, double widthPMOS, double heightTransistorRegion, const Technology& tech) {
+	GateKey k = {&tech, tech.featureSizeInNano, tech.transistorType, tech.deviceRoadmap, gateType, numInput, widthNMOS, widthPMOS, heightTransistorRegion};
+	return k;
+}
+
+double CalculateGateArea(
+		int gateType, int numInput,
+		double widthNMOS, double widthPMOS,
+		double heightTransistorRegion, const Technology& tech,
+		double *height, double *width) {
+	if (!param->gateCache) {
+		return CalculateGateAreaUncached(gateType, numInput, widthNMOS, widthPMOS, heightTransistorRegion, tech, height, width);
+	}
+	GateCache *cache = GetGateCache();
+	GateKey k = MakeGateKey(gateType, numInput, widthNMOS, widthPMOS, heightTransistorRegion, tech);
+	unordered_map<GateKey, GateArea, GateKeyHash>::const_iterator it = cache->area.find(k);
+	if (it != cache->area.end()) {
+		cache->numAreaHit++;
+		*height = it->second.height;
+		*width = it->second.width;
+		return it->second.area;
+	}
+	cache->numAreaMiss++;
+	GateArea a;
+	a.area = CalculateGateAreaUncached(gateType, numInput, widthNMOS, widthPMOS, heightTransistorRegion, tech, &a.height, &a.width);
+	if (cache->area.size() < maxNumGateCache) {
+		cache->area[k] = a;
+	}
+	*height = a.height;
+	*width = a.width;
+	return a.area;
+}
+
+void CalculateGateCapacitance(
+		int gateType, int numInput,
+		double widthNMOS, double widthPMOS,
+		double heightTransistorRegion, const Technology& tech,
+		double *capInput, double *capOutput) {
+	if (!param->gateCache) {
+		CalculateGateCapacitanceUncached(gateType, numInput, widthNMOS, widthPMOS, heightTransistorRegion, tech, capInput, capOutput);
+		return;
+	}
+	GateCache *cache = GetGateCache();
+	GateKey k = MakeGateKey(gateType, numInput, widthNMOS, widthPMOS, heightTransistorRegion, tech);
+	unordered_map<GateKey, GateCapacitance, GateKeyHash>::const_iterator it = cache->capacitance.find(k);
+	GateCapacitance c;
+	if (it != cache->capacitance.end()) {
+		cache->numCapHit++;
+		c = it->second;
+	} else {
+		cache->numCapMiss++;
+		CalculateGateCapacitanceUncached(gateType, numInput, widthNMOS, widthPMOS, heightTransistorRegion, tech, &c.capInput, &c.capOutput);
+		if (cache->capacitance.size() < maxNumGateCache) {
+			cache->capacitance[k] = c;
+		}
+	}
+	if (capOutput)
+		*(capOutput) = c.capOutput;
+	if (capInput)
+		*(capInput) = c.capInput;
+}
+
+void GateCachePrint() {
+	lock_guard<mutex> lock(gateCacheMutex);
+	long long numAreaHit = 0, numAreaMiss = 0, numCapHit = 0, numCapMiss = 0;
+	int numEntry = 0;
+	for (int t=0; t<gateCacheTable.size(); t++) {
+		numAreaHit += gateCacheTable[t]->numAreaHit;
+		numAreaMiss += gateCacheTable[t]->numAreaMiss;
+		numCapHit += gateCacheTable[t]->numCapHit;
+		numCapMiss += gateCacheTable[t]->numCapMiss;
+		numEntry += gateCacheTable[t]->area.size() + gateCacheTable[t]->capacitance.size();
+	}
+	double areaHitRate = (numAreaHit+numAreaMiss > 0)? (double) numAreaHit/(numAreaHit+numAreaMiss) : 0;
+	double capHitRate = (numCapHit+numCapMiss > 0)? (double) numCapHit/(numCapHit+numCapMiss) : 0;
+	cout << "Gate cache: CalculateGateArea " << numAreaHit << " hits / " << numAreaMiss << " misses (" << areaHitRate*100 << "%), "
+		 << "CalculateGateCapacitance " << numCapHit << " hits / " << numCapMiss << " misses (" << capHitRate*100 << "%), " << numEntry << " entries" << endl;
+	ReportSet("gateCache", "areaHit", numAreaHit, "");
+	ReportSet("gateCache", "areaMiss", numAreaMiss, "");
+	ReportSet("gateCache", "areaHitRate", areaHitRate, "");
+	ReportSet("gateCache", "capacitanceHit", numCapHit, "");
+	ReportSet("gateCache", "capacitanceMiss", numCapMiss, "");
+	ReportSet("gateCache", "capacitanceHitRate", capHitRate, "");
+	ReportSet("gateCache", "entries", numEntry, "");
+}
+
 double CalculateDrainCap(
 		double width, int type,
-		double heightTransistorRegion, Technology tech) {
+		double heightTransistorRegion, const Technology& tech) {
 	double drainCap = 0;
 	if (type == NMOS)
 		CalculateGateCapacitance(INV, 1, width, 0, heightTransistorRegion, tech, NULL, &drainCap);
@@ -395,14 +549,14 @@ double CalculateDrainCap(
 double CalculateGateLeakage(
 		int gateType, int numInput,
 		double widthNMOS, double widthPMOS,
-		double temperature, Technology tech) {
+		double temperature, const Technology& tech) {
 	int tempIndex = (int)temperature - 300;
 	if ((tempIndex > 100) || (tempIndex < 0)) {
 		cout<<"Error: Temperature is out of range"<<endl;
 		exit(-1);
 	}
-	double *leakN = tech.currentOffNmos;
-	double *leakP = tech.currentOffPmos;
+	const double *leakN = tech.currentOffNmos;
+	const double *leakP = tech.currentOffPmos;
 	double leakageN, leakageP;
 	switch (gateType) {
 	case INV:
@@ -430,7 +584,7 @@ double CalculateGateLeakage(
 	}
 }
 
-double CalculateOnResistance(double width, int type, double temperature, Technology tech) {
+double CalculateOnResistance(double width, int type, double temperature, const Technology& tech) {
 	double r;
 	int tempIndex = (int)temperature - 300;
 	if ((tempIndex > 100) || (tempIndex < 0)) {
@@ -444,7 +598,7 @@ double CalculateOnResistance(double width, int type, double temperature, Technol
 	return r;
 }
 
-double CalculateTransconductance(double width, int type, Technology tech) {
+double CalculateTransconductance(double width, int type, const Technology& tech) {
 	double gm;
 	if (type == NMOS) {
 		gm = (2*tech.current_gmNmos)*width/(0.7*tech.vdd-tech.vth);
@@ -467,7 +621,7 @@ double horowitz(double tr, double beta, double rampInput, double *rampOutput) {
 
 double CalculatePassGateArea(	// Calculate layout area, height and width of pass gate given the number of folding on the pass gate width
 								// This function is for pass gate where the cell height can change. For normal standard cells, use CalculateGateArea() where the cell height is fixed
-		double widthNMOS, double widthPMOS, Technology tech, int numFold, double *height, double *width) {
+		double widthNMOS, double widthPMOS, const Technology& tech, int numFold, double *height, double *width) {
 	
 	*width = (numFold + 1) * (POLY_WIDTH + MIN_GAP_BET_GATE_POLY) * tech.featureSize;	// No folding means numFold=1
 
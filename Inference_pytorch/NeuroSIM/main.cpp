@@ -1,361 +1,656 @@
-/*******************************************************************************
-* Copyright (c) 2015-2017
-* School of Electrical, Computer and Energy Engineering, Arizona State University
-* PI: Prof. Shimeng Yu
-* All rights reserved.
-* 
-* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
-* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
-* Copyright of the model is maintained by the developers, and the model is distributed under 
-* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
-* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
-* The source code is free and you can redistribute and/or modify it
-* by providing that the following conditions are met:
-* 
-*  1) Redistributions of source code must retain the above copyright notice,
-*     this list of conditions and the following disclaimer.
-* 
-*  2) Redistributions in binary form must reproduce the above copyright notice,
-*     this list of conditions and the following disclaimer in the documentation
-*     and/or other materials provided with the distribution.
-* 
-* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-* 
-* Developer list: 
-*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
-*                    
-*   Xiaochen Peng   Email: xpeng15 at asu dot edu
-********************************************************************************/
-
-#include <cstdio>
-#include <random>
-#include <cmath>
-#include <iostream>
-#include <fstream>
-#include <string>
-#include <stdlib.h>
-#include <vector>
-#include <sstream>
-#include <chrono>
-#include <algorithm>
-#include "constant.h"
-#include "formula.h"
-#include "Param.h"
-#include "Tile.h"
-#include "Chip.h"
-#include "ProcessingUnit.h"
-#include "SubArray.h"
-#include "Definition.h"
-
-using namespace std;
-
-vector<vector<double> > getNetStructure(const string &inputfile);
-
-int main(int argc, char * argv[]) {   
-
-	auto start = chrono::high_resolution_clock::now();
-	
-	gen.seed(0);
-	
-	vector<vector<double> > netStructure;
-	netStructure = getNetStructure(argv[1]);
-	
-	// define weight/input/memory precision from wrapper
-	param->synapseBit = atoi(argv[2]);              // precision of synapse weight
-	param->numBitInput = atoi(argv[3]);             // precision of input neural activation
-	if (param->cellBit > param->synapseBit) {
-		cout << "ERROR!: Memory precision is even higher than synapse precision, please modify 'cellBit' in Param.cpp!" << endl;
-		param->cellBit = param->synapseBit;
-	}
-	
-	param->numRowPerSynapse = 1;
-	param->numColPerSynapse = ceil((double)param->synapseBit/(double)param->cellBit); 
-	
-	double maxPESizeNM, maxTileSizeCM, numPENM;
-	vector<int> markNM;
-	markNM = ChipDesignInitialize(inputParameter, tech, cell, netStructure, &maxPESizeNM, &maxTileSizeCM, &numPENM);		
-	
-	double desiredNumTileNM, desiredPESizeNM, desiredNumTileCM, desiredTileSizeCM, desiredPESizeCM;
-	int numTileRow, numTileCol;
-	
-	vector<vector<double> > numTileEachLayer;
-	vector<vector<double> > utilizationEachLayer;
-	vector<vector<double> > speedUpEachLayer;
-	vector<vector<double> > tileLocaEachLayer;
-	
-	numTileEachLayer = ChipFloorPlan(true, false, false, netStructure, markNM, 
-					maxPESizeNM, maxTileSizeCM, numPENM, 
-					&desiredNumTileNM, &desiredPESizeNM, &desiredNumTileCM, &desiredTileSizeCM, &desiredPESizeCM, &numTileRow, &numTileCol);	
-					
-	utilizationEachLayer = ChipFloorPlan(false, true, false, netStructure, markNM, 
-					maxPESizeNM, maxTileSizeCM, numPENM,
-					&desiredNumTileNM, &desiredPESizeNM, &desiredNumTileCM, &desiredTileSizeCM, &desiredPESizeCM, &numTileRow, &numTileCol);
-	
-	speedUpEachLayer = ChipFloorPlan(false, false, true, netStructure, markNM,
-					maxPESizeNM, maxTileSizeCM, numPENM,
-					&desiredNumTileNM, &desiredPESizeNM, &desiredNumTileCM, &desiredTileSizeCM, &desiredPESizeCM, &numTileRow, &numTileCol);
-					
-	tileLocaEachLayer = ChipFloorPlan(false, false, false, netStructure, markNM,
-					maxPESizeNM, maxTileSizeCM, numPENM,
-					&desiredNumTileNM, &desiredPESizeNM, &desiredNumTileCM, &desiredTileSizeCM, &desiredPESizeCM, &numTileRow, &numTileCol);
-	
-	cout << "------------------------------ FloorPlan --------------------------------" <<  endl;
-	cout << endl;
-	cout << "Tile and PE size are optimized to maximize memory utilization ( = memory mapped by synapse / total memory on chip)" << endl;
-	cout << endl;
-	if (!param->novelMapping) {
-		cout << "Desired Conventional Mapped Tile Storage Size: " << desiredTileSizeCM << "x" << desiredTileSizeCM << endl;
-		cout << "Desired Conventional PE Storage Size: " << desiredPESizeCM << "x" << desiredPESizeCM << endl;
-	} else {
-		cout << "Desired Conventional Mapped Tile Storage Size: " << desiredTileSizeCM << "x" << desiredTileSizeCM << endl;
-		cout << "Desired Conventional PE Storage Size: " << desiredPESizeCM << "x" << desiredPESizeCM << endl;
-		cout << "Desired Novel Mapped Tile Storage Size: " << numPENM << "x" << desiredPESizeNM << "x" << desiredPESizeNM << endl;
-	}
-	cout << "User-defined SubArray Size: " << param->numRowSubArray << "x" << param->numColSubArray << endl;
-	cout << endl;
-	cout << "----------------- # of tile used for each layer -----------------" <<  endl;
-	double totalNumTile = 0;
-	for (int i=0; i<netStructure.size(); i++) {
-		cout << "layer" << i+1 << ": " << numTileEachLayer[0][i] * numTileEachLayer[1][i] << endl;
-		totalNumTile += numTileEachLayer[0][i] * numTileEachLayer[1][i];
-	}
-	cout << endl;
-
-	cout << "----------------- Speed-up of each layer ------------------" <<  endl;
-	for (int i=0; i<netStructure.size(); i++) {
-		cout << "layer" << i+1 << ": " << speedUpEachLayer[0][i] << ", " << speedUpEachLayer[1][i] << endl;
-	}
-	cout << endl;
-	
-	cout << "----------------- Utilization of each layer ------------------" <<  endl;
-	double realMappedMemory = 0;
-	for (int i=0; i<netStructure.size(); i++) {
-		cout << "layer" << i+1 << ": " << utilizationEachLayer[i][0] << endl;
-		realMappedMemory += numTileEachLayer[0][i] * numTileEachLayer[1][i] * utilizationEachLayer[i][0];
-	}
-	cout << "Memory Utilization of Whole Chip: " << realMappedMemory/totalNumTile*100 << " % " << endl;
-	cout << endl;
-	cout << "---------------------------- FloorPlan Done ------------------------------" <<  endl;
-	cout << endl;
-	cout << endl;
-	cout << endl;
-	
-	double numComputation = 0;
-	for (int i=0; i<netStructure.size(); i++) {
-		numComputation += 2*(netStructure[i][0] * netStructure[i][1] * netStructure[i][2] * netStructure[i][3] * netStructure[i][4] * netStructure[i][5]);
-	}
-	
-	ChipInitialize(inputParameter, tech, cell, netStructure, markNM, numTileEachLayer,
-					numPENM, desiredNumTileNM, desiredPESizeNM, desiredNumTileCM, desiredTileSizeCM, desiredPESizeCM, numTileRow, numTileCol);
-					
-	double chipHeight, chipWidth, chipArea, chipAreaIC, chipAreaADC, chipAreaAccum, chipAreaOther;
-	double CMTileheight = 0;
-	double CMTilewidth = 0;
-	double NMTileheight = 0;
-	double NMTilewidth = 0;
-	vector<double> chipAreaResults;
-						
-	chipAreaResults = ChipCalculateArea(inputParameter, tech, cell, desiredNumTileNM, numPENM, desiredPESizeNM, desiredNumTileCM, desiredTileSizeCM, desiredPESizeCM, numTileRow, 
-					&chipHeight, &chipWidth, &CMTileheight, &CMTilewidth, &NMTileheight, &NMTilewidth);		
-	chipArea = chipAreaResults[0];
-	chipAreaIC = chipAreaResults[1];
-	chipAreaADC = chipAreaResults[2];
-	chipAreaAccum = chipAreaResults[3];
-	chipAreaOther = chipAreaResults[4];
-
-	double chipReadLatency = 0;
-	double chipReadDynamicEnergy = 0;
-	double chipLeakageEnergy = 0;
-	double chipLeakage = 0;
-	double chipbufferLatency = 0;
-	double chipbufferReadDynamicEnergy = 0;
-	double chipicLatency = 0;
-	double chipicReadDynamicEnergy = 0;
-	
-	double chipLatencyADC = 0;
-	double chipLatencyAccum = 0;
-	double chipLatencyOther = 0;
-	double chipEnergyADC = 0;
-	double chipEnergyAccum = 0;
-	double chipEnergyOther = 0;
-	
-	double layerReadLatency = 0;
-	double layerReadDynamicEnergy = 0;
-	double tileLeakage = 0;
-	double layerbufferLatency = 0;
-	double layerbufferDynamicEnergy = 0;
-	double layericLatency = 0;
-	double layericDynamicEnergy = 0;
-	
-	double coreLatencyADC = 0;
-	double coreLatencyAccum = 0;
-	double coreLatencyOther = 0;
-	double coreEnergyADC = 0;
-	double coreEnergyAccum = 0;
-	double coreEnergyOther = 0;
-	
-	cout << "-------------------------------------- Hardware Performance --------------------------------------" <<  endl;
-	
-	for (int i=0; i<netStructure.size(); i++) {
-		
-		cout << "-------------------- Estimation of Layer " << i+1 << " ----------------------" << endl;
-		
-		ChipCalculatePerformance(cell, i, argv[2*i+4], argv[2*i+4], argv[2*i+5], netStructure[i][6],
-					netStructure, markNM, numTileEachLayer, utilizationEachLayer, speedUpEachLayer, tileLocaEachLayer,
-					numPENM, desiredPESizeNM, desiredTileSizeCM, desiredPESizeCM, CMTileheight, CMTilewidth, NMTileheight, NMTilewidth,
-					&layerReadLatency, &layerReadDynamicEnergy, &tileLeakage, &layerbufferLatency, &layerbufferDynamicEnergy, &layericLatency, &layericDynamicEnergy,
-					&coreLatencyADC, &coreLatencyAccum, &coreLatencyOther, &coreEnergyADC, &coreEnergyAccum, &coreEnergyOther);
-		
-		double numTileOtherLayer = 0;
-		double layerLeakageEnergy = 0;		
-		for (int j=0; j<netStructure.size(); j++) {
-			if (j != i) {
-				numTileOtherLayer += numTileEachLayer[0][j] * numTileEachLayer[1][j];
-			}
-		}
-		layerLeakageEnergy = numTileOtherLayer*layerReadLatency*tileLeakage;
-		
-		cout << "layer" << i+1 << "'s readLatency is: " << layerReadLatency*1e9 << "ns" << endl;
-		cout << "layer" << i+1 << "'s readDynamicEnergy is: " << layerReadDynamicEnergy*1e12 << "pJ" << endl;
-		cout << "layer" << i+1 << "'s leakagePower is: " << numTileEachLayer[0][i] * numTileEachLayer[1][i] * tileLeakage*1e6 << "uW" << endl;
-		cout << "layer" << i+1 << "'s leakageEnergy is: " << layerLeakageEnergy*1e12 << "pJ" << endl;
-		cout << "layer" << i+1 << "'s buffer latency is: " << layerbufferLatency*1e9 << "ns" << endl;
-		cout << "layer" << i+1 << "'s buffer readDynamicEnergy is: " << layerbufferDynamicEnergy*1e12 << "pJ" << endl;
-		cout << "layer" << i+1 << "'s ic latency is: " << layericLatency*1e9 << "ns" << endl;
-		cout << "layer" << i+1 << "'s ic readDynamicEnergy is: " << layericDynamicEnergy*1e12 << "pJ" << endl;
-		
-		
-		cout << endl;
-		cout << "************************ Breakdown of Latency and Dynamic Energy *************************" << endl;
-		cout << endl;
-		cout << "----------- ADC (or S/As and precharger for SRAM) readLatency is : " << coreLatencyADC*1e9 << "ns" << endl;
-		cout << "----------- Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) readLatency is : " << coreLatencyAccum*1e9 << "ns" << endl;
-		cout << "----------- Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) readLatency is : " << coreLatencyOther*1e9 << "ns" << endl;
-		cout << "----------- ADC (or S/As and precharger for SRAM) readDynamicEnergy is : " << coreEnergyADC*1e12 << "pJ" << endl;
-		cout << "----------- Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) readDynamicEnergy is : " << coreEnergyAccum*1e12 << "pJ" << endl;
-		cout << "----------- Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) readDynamicEnergy is : " << coreEnergyOther*1e12 << "pJ" << endl;
-		cout << endl;
-		cout << "************************ Breakdown of Latency and Dynamic Energy *************************" << endl;
-		cout << endl;
-		
-		chipReadLatency += layerReadLatency;
-		chipReadDynamicEnergy += layerReadDynamicEnergy;
-		chipLeakageEnergy += layerLeakageEnergy;
-		chipLeakage += tileLeakage*numTileEachLayer[0][i] * numTileEachLayer[1][i];
-		chipbufferLatency += layerbufferLatency;
-		chipbufferReadDynamicEnergy += layerbufferDynamicEnergy;
-		chipicLatency += layericLatency;
-		chipicReadDynamicEnergy += layericDynamicEnergy;
-		
-		chipLatencyADC += coreLatencyADC;
-		chipLatencyAccum += coreLatencyAccum;
-		chipLatencyOther += coreLatencyOther;
-		chipEnergyADC += coreEnergyADC;
-		chipEnergyAccum += coreEnergyAccum;
-		chipEnergyOther += coreEnergyOther;
-	}
-	
-	cout << "------------------------------ Summary --------------------------------" <<  endl;
-	cout << endl;
-	cout << "ChipArea : " << chipArea*1e12 << "um^2" << endl;
-	cout << "Total IC Area on chip (Global and Tile/PE local): " << chipAreaIC*1e12 << "um^2" << endl;
-	cout << "Total ADC (or S/As and precharger for SRAM) Area on chip : " << chipAreaADC*1e12 << "um^2" << endl;
-	cout << "Total Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) on chip : " << chipAreaAccum*1e12 << "um^2" << endl;
-	cout << "Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) : " << chipAreaOther*1e12 << "um^2" << endl;
-	cout << endl;
-	cout << "Chip total readLatency is: " << chipReadLatency*1e9 << "ns" << endl;
-	cout << "Chip total readDynamicEnergy is: " << chipReadDynamicEnergy*1e12 << "pJ" << endl;
-	cout << "Chip total leakage Energy is: " << chipLeakageEnergy*1e12 << "pJ" << endl;
-	cout << "Chip total leakage Power is: " << chipLeakage*1e6 << "uW" << endl;
-	cout << "Chip buffer readLatency is: " << chipbufferLatency*1e9 << "ns" << endl;
-	cout << "Chip buffer readDynamicEnergy is: " << chipbufferReadDynamicEnergy*1e12 << "pJ" << endl;
-	cout << "Chip ic readLatency is: " << chipicLatency*1e9 << "ns" << endl;
-	cout << "Chip ic readDynamicEnergy is: " << chipicReadDynamicEnergy*1e12 << "pJ" << endl;
-	
-	cout << endl;
-	cout << "************************ Breakdown of Latency and Dynamic Energy *************************" << endl;
-	cout << endl;
-	cout << "----------- ADC (or S/As and precharger for SRAM) readLatency is : " << chipLatencyADC*1e9 << "ns" << endl;
-	cout << "----------- Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) readLatency is : " << chipLatencyAccum*1e9 << "ns" << endl;
-	cout << "----------- Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) readLatency is : " << chipLatencyOther*1e9 << "ns" << endl;
-	cout << "----------- ADC (or S/As and precharger for SRAM) readDynamicEnergy is : " << chipEnergyADC*1e12 << "pJ" << endl;
-	cout << "----------- Accumulation Circuits (subarray level: adders, shiftAdds; PE/Tile/Global level: accumulation units) readDynamicEnergy is : " << chipEnergyAccum*1e12 << "pJ" << endl;
-	cout << "----------- Other Peripheries (e.g. decoders, mux, switchmatrix, buffers, IC, pooling and activation units) readDynamicEnergy is : " << chipEnergyOther*1e12 << "pJ" << endl;
-	cout << endl;
-	cout << "************************ Breakdown of Latency and Dynamic Energy *************************" << endl;
-	cout << endl;
-	
-	cout << endl;
-	cout << "----------------------------- Performance -------------------------------" << endl;
-	cout << "Energy Efficiency TOPS/W (Layer-by-Layer Process): " << numComputation/(chipReadDynamicEnergy*1e12+chipLeakageEnergy*1e12) << endl;
-	cout << "Throughput FPS (Layer-by-Layer Process): " << 1/(chipReadLatency) << endl;
-	cout << "-------------------------------------- Hardware Performance Done --------------------------------------" <<  endl;
-	cout << endl;
-	auto stop = chrono::high_resolution_clock::now();
-	auto duration = chrono::duration_cast<chrono::seconds>(stop-start);
-    cout << "------------------------------ Simulation Performance --------------------------------" <<  endl;
-	cout << "Total Run-time of NeuroSim: " << duration.count() << " seconds" << endl;
-	cout << "------------------------------ Simulation Performance --------------------------------" <<  endl;
-	
-	return 0;
-}
-
-vector<vector<double> > getNetStructure(const string &inputfile) {
-	ifstream infile(inputfile.c_str());      
-	string inputline;
-	string inputval;
-	
-	int ROWin=0, COLin=0;      
-	if (!infile.good()) {        
-		cerr << "Error: the input file cannot be opened!" << endl;
-		exit(1);
-	}else{
-		while (getline(infile, inputline, '\n')) {       
-			ROWin++;                                
-		}
-		infile.clear();
-		infile.seekg(0, ios::beg);      
-		if (getline(infile, inputline, '\n')) {        
-			istringstream iss (inputline);      
-			while (getline(iss, inputval, ',')) {       
-				COLin++;
-			}
-		}	
-	}
-	infile.clear();
-	infile.seekg(0, ios::beg);          
-
-	vector<vector<double> > netStructure;               
-	for (int row=0; row<ROWin; row++) {	
-		vector<double> netStructurerow;
-		getline(infile, inputline, '\n');             
-		istringstream iss;
-		iss.str(inputline);
-		for (int col=0; col<COLin; col++) {       
-			while(getline(iss, inputval, ',')){	
-				istringstream fs;
-				fs.str(inputval);
-				double f=0;
-				fs >> f;				
-				netStructurerow.push_back(f);			
-			}			
-		}		
-		netStructure.push_back(netStructurerow);
-	}
-	infile.close();
-	
-	return netStructure;
-	netStructure.clear();
-}	
-
-
-
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cstdio>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <stdlib.h>
+#include <vector>
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+#include "constant.h"
+#include "formula.h"
+#include "Param.h"
+#include "Tile.h"
+#include "Chip.h"
+#include "ProcessingUnit.h"
+#include "MonteCarlo.h"
+#include "Report.h"
+#include "Breakdown.h"
+#include "Heatmap.h"
+#include "Activity.h"
+#include "Profile.h"
+#include "SubArray.h"
+#include "Definition.h"
+
+using namespace std;
+
+vector<vector<double> > getNetStructure(const string &inputfile);
+
+int main(int argc, char * argv[]) {   
+
+	auto start = chrono::high_resolution_clock::now();
+	
+	// options may appear anywhere on the command line, the rest are the positional arguments (network, precisions, weight/input files)
+	// --report out.json (or out.csv): write all the results below as a structured document
+	// --folded prefix: write the per-instance breakdown as prefix.energy.folded and prefix.latency.folded (flamegraph.pl, speedscope)
+	// --profile trace.json: print where the simulation time goes and write it as Chrome trace events (chrome://tracing, Perfetto)
+	// --heatmap out.csv: write the latency, energy and utilization of every tile and PE of each layer with its position on the chip
+	// --activity out.csv: write the activity counters of every subArray (reads, all-zero vectors, row activity histogram, ADC conversions, column conductance)
+	// --operationmode N, --memcelltype N: override these two options of Param.cpp (e.g. to sweep all of them without rebuilding)
+	// --inputbitpercycle N: override numInputBitPerCycle of Param.cpp
+	string reportFile, foldedPrefix, profileFile, heatmapFile, activityFile;
+	vector<char *> args;
+	for (int i=0; i<argc; i++) {
+		if (string(argv[i]) == "--report" && i+1 < argc) {
+			reportFile = argv[++i];
+		} else if (string(argv[i]) == "--folded" && i+1 < argc) {
+			foldedPrefix = argv[++i];
+			param->breakdown = true;
+		} else if (string(argv[i]) == "--profile" && i+1 < argc) {
+			profileFile = argv[++i];
+			param->profile = true;
+		} else if (string(argv[i]) == "--heatmap" && i+1 < argc) {
+			heatmapFile = argv[++i];
+			param->heatmap = true;
+		} else if (string(argv[i]) == "--activity" && i+1 < argc) {
+			activityFile = argv[++i];
+			param->activity = true;
+		} else if (string(argv[i]) == "--operationmode" && i+1 < argc) {
+			param->operationmode = atoi(argv[++i]);
+			param->Initialize();
+		} else if (string(argv[i]) == "--memcelltype" && i+1 < argc) {
+			param->memcelltype = atoi(argv[++i]);
+			param->Initialize();
+		} else if (string(argv[i]) == "--inputbitpercycle" && i+1 < argc) {
+			param->numInputBitPerCycle = atoi(argv[++i]);
+		} else {
+			args.push_back(argv[i]);
+		}
+	}
+	argc = args.size();
+	argv = &args[0];
+	ProfileCountAllocation(param->profile);
+	
+	gen.seed(0);
+	
+	vector<vector<double> > netStructure;
+	netStructure = getNetStructure(argv[1]);
+	
+	// define weight/input/memory precision from wrapper
+	param->synapseBit = atoi(argv[2]);              // precision of synapse weight
+	param->numBitInput = atoi(argv[3]);             // precision of input neural activation
+	param->Initialize();                            // numInputCycle from numBitInput and numInputBitPerCycle
+	if (param->cellBit > param->synapseBit) {
+		cout << "ERROR!: Memory precision is even higher than synapse precision, please modify 'cellBit' in Param.cpp!" << endl;
+		param->cellBit = param->synapseBit;
+	}
+	
+	param->numRowPerSynapse = 1;
+	param->numColPerSynapse = ceil((double)param->synapseBit/(double)param->cellBit); 
+	if (param->BNNparallelMode) {
+		param->numColPerSynapse = 2;        // binary weight and its complement on two columns (LoadInWeightData)
+	} else if (param->XNORparallelMode || param->XNORsequentialMode) {
+		param->numRowPerSynapse = 2;        // binary weight and its complement on two rows, read by the input and its complement
+		param->numColPerSynapse = 1;
+	}
+	
+	double maxPESizeNM, maxTileSizeCM, numPENM;
+	vector<int> markNM;
+	markNM = ChipDesignInitialize(inputParameter, tech, cell, netStructure, &maxPESizeNM, &maxTileSizeCM, &numPENM);		
+	
+	double desiredNumTileNM, desiredPESizeNM, desiredNumTileCM, desiredTileSizeCM, desiredPESizeCM;
+	int numTileRow, numTileCol;
+	
+	vector<vector<double> > numTileEachLayer;
+	vector<vector<double> > utilizationEachLayer;
+	vector<vector<double> > speedUpEachLayer;
+	vector<vector<double> > tileLocaEachLayer;
+	
+	numTileEachLayer = ChipFloorPlan(true, false, false, netStructure, markNM, 
+					maxPESizeNM, maxTileSizeCM, numPENM, 
+					&desiredNumTileNM, &desiredPESizeNM, &desiredNumTileCM, &desiredTileSizeCM, &desiredPESizeCM, &numTileRow, &numTileCol);	
+					
+	utilizationEachLayer = ChipFloorPlan(false, true, false, netStructure, markNM, 
+					maxPESizeNM, maxTileSizeCM, numPENM,
+					&desiredNumTileNM, &desiredPESizeNM, &desiredNumTileCM, &desiredTileSizeCM, &desiredPESizeCM, &numTileRow, &numTileCol);
+	
+	speedUpEachLayer = ChipFloorPlan(false, false, true, netStructure, markNM,
+					maxPESizeNM, maxTileSizeCM, numPENM,
+					&desiredNumTileNM, &desiredPESizeNM, &desiredNumTileCM, &desiredTileSizeCM, &desiredPESizeCM, &numTileRow, &numTileCol);
+					
+	tileLocaEachLayer = ChipFloorPlan(false, false, false, netStructure, markNM,
+					maxPESizeNM, maxTileSizeCM, numPENM,
+					&desiredNumTileNM, &desiredPESizeNM, &desiredNumTileCM, &desiredTileSizeCM, &desiredPESizeCM, &numTileRow, &numTileCol);
+	
+	ReportSet("chip", "technode", param->technode, "nm");
+	ReportSet("chip", "operationmode", param->operationmode, "");
+	ReportSet("chip", "memcelltype", param->memcelltype, "");
+	ReportSet("chip", "synapseBit", param->synapseBit, "bit");
+	ReportSet("chip", "numBitInput", param->numBitInput, "bit");
+	if (param->numInputBitPerCycle > 1) {
+		ReportSet("chip", "numInputBitPerCycle", param->numInputBitPerCycle, "bit");
+	}
+	ReportSet("chip", "cellBit", param->cellBit, "bit");
+	ReportSet("chip", "tileSizeCM", desiredTileSizeCM, "");
+	ReportSet("chip", "peSizeCM", desiredPESizeCM, "");
+	if (param->novelMapping) {
+		ReportSet("chip", "numPENM", numPENM, "");
+		ReportSet("chip", "peSizeNM", desiredPESizeNM, "");
+	}
+	ReportSet("chip", "numRowSubArray", param->numRowSubArray, "");
+	ReportSet("chip", "numColSubArray", param->numColSubArray, "");
+	double totalNumTile = 0;
+	double realMappedMemory = 0;
+	for (int i=0; i<netStructure.size(); i++) {
+		ReportSet(LayerScope(i+1), "numTile", numTileEachLayer[0][i] * numTileEachLayer[1][i], "");
+		ReportSet(LayerScope(i+1), "speedUpRow", speedUpEachLayer[0][i], "");
+		ReportSet(LayerScope(i+1), "speedUpCol", speedUpEachLayer[1][i], "");
+		ReportSet(LayerScope(i+1), "utilization", utilizationEachLayer[i][0], "");
+		totalNumTile += numTileEachLayer[0][i] * numTileEachLayer[1][i];
+		realMappedMemory += numTileEachLayer[0][i] * numTileEachLayer[1][i] * utilizationEachLayer[i][0];
+	}
+	ReportSet("chip", "numTile", totalNumTile, "");
+	ReportSet("chip", "memoryUtilization", realMappedMemory/totalNumTile, "");
+	ReportPrintFloorPlan(netStructure.size());
+	
+	double numComputation = 0;
+	for (int i=0; i<netStructure.size(); i++) {
+		numComputation += LayerNumOperation(netStructure[i]);
+	}
+	
+	ChipInitialize(inputParameter, tech, cell, netStructure, markNM, numTileEachLayer,
+					numPENM, desiredNumTileNM, desiredPESizeNM, desiredNumTileCM, desiredTileSizeCM, desiredPESizeCM, numTileRow, numTileCol);
+					
+	double chipHeight, chipWidth, chipArea, chipAreaIC, chipAreaADC, chipAreaAccum, chipAreaOther;
+	double CMTileheight = 0;
+	double CMTilewidth = 0;
+	double NMTileheight = 0;
+	double NMTilewidth = 0;
+	vector<double> chipAreaResults;
+						
+	chipAreaResults = ChipCalculateArea(inputParameter, tech, cell, desiredNumTileNM, numPENM, desiredPESizeNM, desiredNumTileCM, desiredTileSizeCM, desiredPESizeCM, numTileRow, 
+					&chipHeight, &chipWidth, &CMTileheight, &CMTilewidth, &NMTileheight, &NMTilewidth);		
+	chipArea = chipAreaResults[0];
+	chipAreaIC = chipAreaResults[1];
+	chipAreaADC = chipAreaResults[2];
+	chipAreaAccum = chipAreaResults[3];
+	chipAreaOther = chipAreaResults[4];
+	ReportSet("chip", "area", chipArea, "m^2");
+	ReportSet("chip", "areaIC", chipAreaIC, "m^2");
+	ReportSet("chip", "areaADC", chipAreaADC, "m^2");
+	ReportSet("chip", "areaAccum", chipAreaAccum, "m^2");
+	ReportSet("chip", "areaOther", chipAreaOther, "m^2");
+	ReportSet("chip", "numOperation", numComputation, "");
+
+	double chipReadLatency = 0;
+	double chipReadDynamicEnergy = 0;
+	double chipLeakageEnergy = 0;
+	double chipLeakage = 0;
+	double chipbufferLatency = 0;
+	double chipbufferReadDynamicEnergy = 0;
+	double chipicLatency = 0;
+	double chipicReadDynamicEnergy = 0;
+	
+	double chipLatencyADC = 0;
+	double chipLatencyAccum = 0;
+	double chipLatencyOther = 0;
+	double chipEnergyADC = 0;
+	double chipEnergyAccum = 0;
+	double chipEnergyOther = 0;
+	
+	double layerReadLatency = 0;
+	double layerReadDynamicEnergy = 0;
+	double tileLeakage = 0;
+	double layerbufferLatency = 0;
+	double layerbufferDynamicEnergy = 0;
+	double layericLatency = 0;
+	double layericDynamicEnergy = 0;
+	
+	double coreLatencyADC = 0;
+	double coreLatencyAccum = 0;
+	double coreLatencyOther = 0;
+	double coreEnergyADC = 0;
+	double coreEnergyAccum = 0;
+	double coreEnergyOther = 0;
+	
+	double chipOverlapLatency = 0;
+	vector<int> numBoundLayer(3, 0);
+	
+	vector<double> stageLatency;
+	vector<double> stageLeakage;
+	vector<double> stageTileLatency;
+	vector<double> stageWriteLatency;
+	vector<double> stageWriteEnergy;
+	vector<double> chipReadDynamicEnergyMonteCarlo(param->numTrialMonteCarlo, 0);
+	
+	cout << "-------------------------------------- Hardware Performance --------------------------------------" <<  endl;
+	
+	for (int i=0; i<netStructure.size(); i++) {
+		
+		cout << "-------------------- Estimation of Layer " << i+1 << " ----------------------" << endl;
+		
+		double layerTileLatency = ChipCalculatePerformance(cell, i, argv[2*i+4], argv[2*i+4], argv[2*i+5], netStructure[i][6],
+					netStructure, markNM, numTileEachLayer, utilizationEachLayer, speedUpEachLayer, tileLocaEachLayer,
+					numPENM, desiredPESizeNM, desiredTileSizeCM, desiredPESizeCM, CMTileheight, CMTilewidth, NMTileheight, NMTilewidth,
+					&layerReadLatency, &layerReadDynamicEnergy, &tileLeakage, &layerbufferLatency, &layerbufferDynamicEnergy, &layericLatency, &layericDynamicEnergy,
+					&coreLatencyADC, &coreLatencyAccum, &coreLatencyOther, &coreEnergyADC, &coreEnergyAccum, &coreEnergyOther);
+		
+		double numTileOtherLayer = 0;
+		double layerLeakageEnergy = 0;		
+		for (int j=0; j<netStructure.size(); j++) {
+			if (j != i) {
+				numTileOtherLayer += numTileEachLayer[0][j] * numTileEachLayer[1][j];
+			}
+		}
+		layerLeakageEnergy = numTileOtherLayer*layerReadLatency*tileLeakage;
+		
+		string layerScope = LayerScope(i+1);
+		ReportSetBreakdown(layerScope, layerReadLatency, layerReadDynamicEnergy, layerbufferLatency, layerbufferDynamicEnergy, layericLatency, layericDynamicEnergy,
+						coreLatencyADC, coreLatencyAccum, coreLatencyOther, coreEnergyADC, coreEnergyAccum, coreEnergyOther);
+		ReportSet(layerScope, "leakagePower", numTileEachLayer[0][i] * numTileEachLayer[1][i] * tileLeakage, "W");
+		ReportSet(layerScope, "leakageEnergy", layerLeakageEnergy, "J");
+		ReportSet(layerScope, "area", numTileEachLayer[0][i] * numTileEachLayer[1][i] * (markNM[i]? NMTileheight*NMTilewidth : CMTileheight*CMTilewidth), "m^2");
+		if (param->sampling) {
+			ReportSet(layerScope, "numSampledVector", samplingStats.numSampled, "");
+			ReportSet(layerScope, "numVector", samplingStats.numTotal, "");
+			ReportSet(layerScope, "readLatencyCI", layerReadLatency*samplingStats.latencyRelError, "s");
+			ReportSet(layerScope, "readDynamicEnergyCI", SamplingZValue(param->samplingConfidence)*sqrt(samplingStats.energyVariance), "J");
+		}
+		if (param->monteCarlo) {
+			double mean, stdDev, low, high;
+			MonteCarloSummary(monteCarloStats.latency, &mean, &stdDev, &low, &high);
+			ReportSet(layerScope, "criticalPathNominal", monteCarloStats.nominalLatency, "s");
+			ReportSet(layerScope, "criticalPathMean", mean, "s");
+			ReportSet(layerScope, "criticalPathStd", stdDev, "s");
+			ReportSet(layerScope, "criticalPathP5", low, "s");
+			ReportSet(layerScope, "criticalPathP95", high, "s");
+			vector<double> energy(monteCarloStats.energyDelta);
+			for (int t=0; t<energy.size(); t++) {
+				energy[t] += layerReadDynamicEnergy;
+				chipReadDynamicEnergyMonteCarlo[t] += energy[t];
+			}
+			MonteCarloSummary(energy, &mean, &stdDev, &low, &high);
+			ReportSet(layerScope, "readDynamicEnergyMean", mean, "J");
+			ReportSet(layerScope, "readDynamicEnergyStd", stdDev, "J");
+			ReportSet(layerScope, "readDynamicEnergyP5", low, "J");
+			ReportSet(layerScope, "readDynamicEnergyP95", high, "J");
+		}
+		if (param->roofline) {
+			double layerOperation = LayerNumOperation(netStructure[i]);
+			double computeLatency, overlapLatency, computeRate, bufferBandwidth, icBandwidth, intensityBuffer, intensityIC, attainableRate;
+			int bound;
+			ChipCalculateRoofline(layerOperation, layerReadLatency, layerbufferLatency, layericLatency, rooflineStats.numBitBuffer, rooflineStats.numBitIC, 
+								&computeLatency, &overlapLatency, &computeRate, &bufferBandwidth, &icBandwidth, &intensityBuffer, &intensityIC, &attainableRate, &bound);
+			ReportSet(layerScope, "numOperation", layerOperation, "");
+			ReportSet(layerScope, "computeLatency", computeLatency, "s");
+			ReportSet(layerScope, "overlapLatency", overlapLatency, "s");
+			ReportSet(layerScope, "bound", bound, "");     // 0: compute, 1: buffer, 2: interconnect
+			ReportSet(layerScope, "computeRate", computeRate, "OPS");
+			ReportSet(layerScope, "bufferBandwidth", bufferBandwidth, "B/s");
+			ReportSet(layerScope, "icBandwidth", icBandwidth, "B/s");
+			ReportSet(layerScope, "globalBufferBandwidth", rooflineStats.bufferPeakBandwidth/8, "B/s");
+			ReportSet(layerScope, "globalICBandwidth", rooflineStats.icPeakBandwidth/8, "B/s");
+			ReportSet(layerScope, "intensityBuffer", intensityBuffer, "OP/B");
+			ReportSet(layerScope, "intensityIC", intensityIC, "OP/B");
+			ReportSet(layerScope, "attainableRate", attainableRate, "OPS");
+			chipOverlapLatency += overlapLatency;
+			numBoundLayer[bound]++;
+		}
+		ReportPrintLayer(i+1);
+		
+		stageLatency.push_back(layerReadLatency);
+		stageLeakage.push_back(tileLeakage*numTileEachLayer[0][i] * numTileEachLayer[1][i]);
+		stageTileLatency.push_back(layerTileLatency);
+		if (param->weightStreaming) {
+			double layerWriteLatency = 0;
+			double layerWriteDynamicEnergy = 0;
+			if (!LayerStoredActivation(netStructure[i])) {     // a stored activation is already programmed for each image (reprogramLatency)
+				ChipCalculateWeightWrite(i, netStructure, markNM, numTileEachLayer, speedUpEachLayer, numPENM, desiredPESizeNM, desiredTileSizeCM, desiredPESizeCM,
+								&layerWriteLatency, &layerWriteDynamicEnergy);
+			}
+			stageWriteLatency.push_back(layerWriteLatency);
+			stageWriteEnergy.push_back(layerWriteDynamicEnergy);
+		}
+		
+		chipReadLatency += layerReadLatency;
+		chipReadDynamicEnergy += layerReadDynamicEnergy;
+		chipLeakageEnergy += layerLeakageEnergy;
+		chipLeakage += tileLeakage*numTileEachLayer[0][i] * numTileEachLayer[1][i];
+		chipbufferLatency += layerbufferLatency;
+		chipbufferReadDynamicEnergy += layerbufferDynamicEnergy;
+		chipicLatency += layericLatency;
+		chipicReadDynamicEnergy += layericDynamicEnergy;
+		
+		chipLatencyADC += coreLatencyADC;
+		chipLatencyAccum += coreLatencyAccum;
+		chipLatencyOther += coreLatencyOther;
+		chipEnergyADC += coreEnergyADC;
+		chipEnergyAccum += coreEnergyAccum;
+		chipEnergyOther += coreEnergyOther;
+	}
+	
+	ReportSetBreakdown("chip", chipReadLatency, chipReadDynamicEnergy, chipbufferLatency, chipbufferReadDynamicEnergy, chipicLatency, chipicReadDynamicEnergy,
+					chipLatencyADC, chipLatencyAccum, chipLatencyOther, chipEnergyADC, chipEnergyAccum, chipEnergyOther);
+	ReportSet("chip", "leakageEnergy", chipLeakageEnergy, "J");
+	ReportSet("chip", "leakagePower", chipLeakage, "W");
+	if (param->roofline) {
+		ReportSet("chip", "overlapLatency", chipOverlapLatency, "s");
+		ReportSet("chip", "numComputeBoundLayer", numBoundLayer[0], "");
+		ReportSet("chip", "numBufferBoundLayer", numBoundLayer[1], "");
+		ReportSet("chip", "numICBoundLayer", numBoundLayer[2], "");
+	}
+	if (param->monteCarlo) {
+		double mean, stdDev, low, high;
+		MonteCarloSummary(chipReadDynamicEnergyMonteCarlo, &mean, &stdDev, &low, &high);
+		ReportSet("chip", "readDynamicEnergyMean", mean, "J");
+		ReportSet("chip", "readDynamicEnergyStd", stdDev, "J");
+		ReportSet("chip", "readDynamicEnergyP5", low, "J");
+		ReportSet("chip", "readDynamicEnergyP95", high, "J");
+	}
+	ReportPrintSummary();
+	
+	if (param->breakdown) {
+		// totals of each kind of circuit over all its instances, then the whole tree (before any duplication below)
+		vector<string> componentName;
+		vector<double> componentLatency, componentEnergy;
+		BreakdownByComponent(&componentName, &componentLatency, &componentEnergy);
+		for (int i=0; i<componentName.size(); i++) {
+			ReportSet("breakdown/" + componentName[i], "busyTime", componentLatency[i], "s");
+			ReportSet("breakdown/" + componentName[i], "readDynamicEnergy", componentEnergy[i], "J");
+		}
+		if (!foldedPrefix.empty()) {
+			BreakdownWriteFolded(foldedPrefix + ".energy.folded", false);
+			BreakdownWriteFolded(foldedPrefix + ".latency.folded", true);
+		}
+	}
+	if (param->heatmap) {
+		HeatmapWrite(heatmapFile, numTileRow, numTileCol);
+	}
+	if (param->activity) {
+		ActivityWrite(activityFile.empty()? "activity.csv" : activityFile);
+	}
+	
+	ReportSet("performance", "energyEfficiency", numComputation/(chipReadDynamicEnergy*1e12+chipLeakageEnergy*1e12), "TOPS/W");
+	ReportSet("performance", "throughput", 1/(chipReadLatency), "FPS");
+	if (param->pipeline) {
+		int bottleneckStage;
+		double bottleneckLatency, imageLatency, batchLatency, fillDrainLatency, pipelineLeakageEnergy;
+		ChipCalculatePipeline(stageLatency, stageLeakage, param->batchSize, &bottleneckStage, &bottleneckLatency, 
+							&imageLatency, &batchLatency, &fillDrainLatency, &pipelineLeakageEnergy);
+		ReportSet("pipeline", "bottleneckLayer", bottleneckStage+1, "");
+		ReportSet("pipeline", "bottleneckLatency", bottleneckLatency, "s");
+		ReportSet("pipeline", "imageLatency", imageLatency, "s");
+		ReportSet("pipeline", "batchSize", param->batchSize, "");
+		ReportSet("pipeline", "batchLatency", batchLatency, "s");
+		ReportSet("pipeline", "fillDrainLatency", fillDrainLatency, "s");
+		ReportSet("pipeline", "leakageEnergy", pipelineLeakageEnergy/param->batchSize, "J");
+		ReportSet("pipeline", "energyEfficiency", numComputation/(chipReadDynamicEnergy*1e12+pipelineLeakageEnergy/param->batchSize*1e12), "TOPS/W");
+		ReportSet("pipeline", "throughput", 1/bottleneckLatency, "FPS");
+		ReportSet("pipeline", "throughputBatch", param->batchSize/batchLatency, "FPS");
+	}
+	ReportPrintPerformance();
+	if (param->optimizeDuplication) {
+		vector<double> numTileStage;
+		vector<double> tileAreaStage;
+		vector<double> maxDupStage;
+		for (int i=0; i<netStructure.size(); i++) {
+			numTileStage.push_back(numTileEachLayer[0][i] * numTileEachLayer[1][i]);
+			tileAreaStage.push_back(markNM[i]? NMTileheight*NMTilewidth : CMTileheight*CMTilewidth);
+			// every copy needs input vectors of its own, including the copies inside the tiles (speedUpRow/Col)
+			maxDupStage.push_back(ceil(LayerOutputHeight(netStructure[i])*LayerOutputWidth(netStructure[i])/(speedUpEachLayer[0][i]*speedUpEachLayer[1][i])));
+		}
+		vector<double> dupEachLayer;
+		dupEachLayer = ChipOptimizeDuplication(stageLatency, stageTileLatency, numTileStage, tileAreaStage, maxDupStage, chipArea, totalNumTile, param->maxChipArea, param->maxNumTile);
+		
+		// the copies split the input vectors of the layer: only its tile part scales with 1/dup (the estimate the optimizer used),
+		// the work and so the dynamic energy stay the same, the copies add their leakage
+		vector<double> optimizedStageLatency;
+		vector<double> optimizedStageLeakage;
+		double optimizedArea = chipArea;
+		for (int i=0; i<netStructure.size(); i++) {
+			optimizedStageLatency.push_back(stageLatency[i] - stageTileLatency[i] + stageTileLatency[i]/dupEachLayer[i]);
+			optimizedStageLeakage.push_back(stageLeakage[i]*dupEachLayer[i]);
+			optimizedArea += (dupEachLayer[i]-1)*numTileStage[i]*tileAreaStage[i];
+			ReportSet(LayerScope(i+1), "duplication", dupEachLayer[i], "");
+			ReportSet(LayerScope(i+1), "numTileDuplicated", numTileStage[i]*dupEachLayer[i], "");
+			ReportSet(LayerScope(i+1), "readLatencyDuplicated", optimizedStageLatency[i], "s");
+		}
+		int bottleneckStage;
+		double bottleneckBefore, bottleneckAfter, imageLatency, batchLatency, fillDrainLatency, leakageBefore, leakageAfter;
+		ChipCalculatePipeline(stageLatency, stageLeakage, param->batchSize, &bottleneckStage, &bottleneckBefore, 
+							&imageLatency, &batchLatency, &fillDrainLatency, &leakageBefore);
+		ChipCalculatePipeline(optimizedStageLatency, optimizedStageLeakage, param->batchSize, &bottleneckStage, &bottleneckAfter, 
+							&imageLatency, &batchLatency, &fillDrainLatency, &leakageAfter);
+		ReportSet("duplication", "area", optimizedArea, "m^2");
+		ReportSet("duplication", "throughputBefore", 1/bottleneckBefore, "FPS");
+		ReportSet("duplication", "throughputAfter", 1/bottleneckAfter, "FPS");
+		ReportSet("duplication", "throughputPerAreaBefore", 1/bottleneckBefore/(chipArea*1e6), "FPS/mm^2");
+		ReportSet("duplication", "throughputPerAreaAfter", 1/bottleneckAfter/(optimizedArea*1e6), "FPS/mm^2");
+		ReportSet("duplication", "leakageEnergyBefore", leakageBefore/param->batchSize, "J");
+		ReportSet("duplication", "leakageEnergyAfter", leakageAfter/param->batchSize, "J");
+		ReportSet("duplication", "energyEfficiencyBefore", numComputation/(chipReadDynamicEnergy*1e12+leakageBefore/param->batchSize*1e12), "TOPS/W");
+		ReportSet("duplication", "energyEfficiencyAfter", numComputation/(chipReadDynamicEnergy*1e12+leakageAfter/param->batchSize*1e12), "TOPS/W");
+		ReportPrintDuplication(netStructure.size());
+	}
+	if (param->multiChip) {
+		vector<double> numTileStage;
+		vector<double> tileAreaStage;
+		vector<double> stageInputBit;
+		double tileArea = 0;
+		for (int i=0; i<netStructure.size(); i++) {
+			numTileStage.push_back(numTileEachLayer[0][i] * numTileEachLayer[1][i]);
+			tileAreaStage.push_back(markNM[i]? NMTileheight*NMTilewidth : CMTileheight*CMTilewidth);
+			stageInputBit.push_back(netStructure[i][0]*netStructure[i][1]*netStructure[i][2]*param->numBitInput);
+			tileArea += numTileStage[i]*tileAreaStage[i];
+		}
+		int numChip;
+		vector<vector<double> > shard;
+		shard = ChipPartition(numTileStage, tileAreaStage, chipArea-tileArea, param->maxAreaPerChip, &numChip);
+		if (numChip == 0) {
+			cout << "ERROR: not even one tile fits into 'maxAreaPerChip' next to the chip periphery (" << (chipArea-tileArea)*1e12 << "um^2), please increase it in Param.cpp!" << endl;
+		} else {
+			vector<double> chipLatency, linkBit, linkLatency;
+			double linkEnergy, bottleneckLatency, imageLatency, leakageEnergy;
+			ChipCalculateMultiChip(shard, numChip, stageLatency, stageInputBit, stageLeakage, numTileStage, ChipPeripheryLeakage(), 
+								&chipLatency, &linkBit, &linkLatency, &linkEnergy, &bottleneckLatency, &imageLatency, &leakageEnergy);
+			
+			vector<double> numTileChip(numChip, 0);
+			vector<double> areaChip(numChip, chipArea-tileArea);
+			vector<double> mappedTileChip(numChip, 0);
+			for (int s=0; s<shard.size(); s++) {
+				int c = shard[s][0];
+				int l = shard[s][1];
+				numTileChip[c] += shard[s][2];
+				areaChip[c] += shard[s][2]*tileAreaStage[l];
+				mappedTileChip[c] += shard[s][2]*utilizationEachLayer[l][0];
+			}
+			for (int c=0; c<numChip; c++) {
+				string chipScope = "multiChip/chip" + to_string(c+1);
+				ReportSet(chipScope, "numTile", numTileChip[c], "");
+				ReportSet(chipScope, "area", areaChip[c], "m^2");
+				ReportSet(chipScope, "areaUtilization", areaChip[c]/param->maxAreaPerChip, "");
+				ReportSet(chipScope, "memoryUtilization", mappedTileChip[c]/numTileChip[c], "");
+				ReportSet(chipScope, "stageLatency", chipLatency[c], "s");
+				ReportSet(chipScope, "busyRatio", chipLatency[c]/bottleneckLatency, "");
+			}
+			for (int i=0; i<netStructure.size(); i++) {
+				int firstChip = numChip, lastChip = 0;
+				for (int s=0; s<shard.size(); s++) {
+					if (shard[s][1] == i) {
+						firstChip = MIN(firstChip, (int) shard[s][0]);
+						lastChip = MAX(lastChip, (int) shard[s][0]);
+					}
+				}
+				ReportSet(LayerScope(i+1), "firstChip", firstChip+1, "");
+				ReportSet(LayerScope(i+1), "lastChip", lastChip+1, "");
+				ReportSet(LayerScope(i+1), "linkInputBit", linkBit[i], "bit");
+				ReportSet(LayerScope(i+1), "linkLatency", linkLatency[i], "s");
+			}
+			ReportSet("multiChip", "numChip", numChip, "");
+			ReportSet("multiChip", "maxAreaPerChip", param->maxAreaPerChip, "m^2");
+			ReportSet("multiChip", "linkEnergy", linkEnergy, "J");
+			ReportSet("multiChip", "bottleneckLatency", bottleneckLatency, "s");
+			ReportSet("multiChip", "imageLatency", imageLatency, "s");
+			ReportSet("multiChip", "leakageEnergy", leakageEnergy, "J");
+			ReportSet("multiChip", "energyEfficiency", numComputation/(chipReadDynamicEnergy*1e12+linkEnergy*1e12+leakageEnergy*1e12), "TOPS/W");
+			ReportSet("multiChip", "throughput", 1/bottleneckLatency, "FPS");
+			ReportPrintMultiChip(netStructure.size(), numChip);
+		}
+	}
+	if (param->weightStreaming) {
+		vector<double> numTileStage;
+		vector<double> tileAreaStage;
+		vector<double> stageWeightBit;
+		double tileArea = 0;
+		double maxTileArea = 0;
+		for (int i=0; i<netStructure.size(); i++) {
+			numTileStage.push_back(numTileEachLayer[0][i] * numTileEachLayer[1][i]);
+			tileAreaStage.push_back(markNM[i]? NMTileheight*NMTilewidth : CMTileheight*CMTilewidth);
+			stageWeightBit.push_back(LayerStoredActivation(netStructure[i])? 0 : LayerMatrixRow(netStructure[i])*LayerMatrixCol(netStructure[i])*param->cellBit);
+			tileArea += numTileStage[i]*tileAreaStage[i];
+			maxTileArea = MAX(maxTileArea, tileAreaStage[i]);
+		}
+		double streamChipArea = (param->streamChipArea > 0)? param->streamChipArea : chipArea-tileArea/2;
+		double tileAreaBudget = streamChipArea-(chipArea-tileArea);
+		if (tileAreaBudget < maxTileArea) {
+			cout << "ERROR: not even one tile fits into 'streamChipArea' next to the chip periphery (" << (chipArea-tileArea)*1e12 << "um^2), please increase it in Param.cpp!" << endl;
+		} else {
+			vector<double> resident, numPass, stageStreamLatency;
+			double dramBit, dramEnergy, writeEnergy, imageLatency, leakageEnergy;
+			ChipCalculateStreaming(numTileStage, tileAreaStage, stageLatency, stageWeightBit, stageWriteLatency, stageWriteEnergy, stageLeakage, ChipPeripheryLeakage(), 
+								tileAreaBudget, &resident, &numPass, &stageStreamLatency, &dramBit, &dramEnergy, &writeEnergy, &imageLatency, &leakageEnergy);
+			for (int i=0; i<netStructure.size(); i++) {
+				ReportSet(LayerScope(i+1), "weightResident", resident[i], "");
+				ReportSet(LayerScope(i+1), "numWeightPass", numPass[i], "");
+				ReportSet(LayerScope(i+1), "weightWriteLatency", stageWriteLatency[i], "s");
+				ReportSet(LayerScope(i+1), "weightWriteDynamicEnergy", stageWriteEnergy[i], "J");
+				ReportSet(LayerScope(i+1), "streamLatency", stageStreamLatency[i], "s");
+			}
+			ReportSet("streaming", "chipArea", streamChipArea, "m^2");
+			ReportSet("streaming", "tileAreaUtilization", MIN(tileArea/tileAreaBudget, 1), "");
+			ReportSet("streaming", "dramBit", dramBit, "bit");
+			ReportSet("streaming", "dramEnergy", dramEnergy, "J");
+			ReportSet("streaming", "writeDynamicEnergy", writeEnergy, "J");
+			ReportSet("streaming", "imageLatency", imageLatency, "s");
+			ReportSet("streaming", "leakageEnergy", leakageEnergy, "J");
+			ReportSet("streaming", "energyEfficiency", numComputation/(chipReadDynamicEnergy*1e12+dramEnergy*1e12+writeEnergy*1e12+leakageEnergy*1e12), "TOPS/W");
+			ReportSet("streaming", "throughput", 1/imageLatency, "FPS");
+			ReportSet("streaming", "throughputResident", 1/chipReadLatency, "FPS");
+			ReportSet("streaming", "throughputPenalty", imageLatency/chipReadLatency, "");
+			ReportPrintStreaming(netStructure.size());
+		}
+	}
+	cout << "-------------------------------------- Hardware Performance Done --------------------------------------" <<  endl;
+	cout << endl;
+	auto stop = chrono::high_resolution_clock::now();
+	auto duration = chrono::duration_cast<chrono::seconds>(stop-start);
+    cout << "------------------------------ Simulation Performance --------------------------------" <<  endl;
+	cout << "Total Run-time of NeuroSim: " << duration.count() << " seconds" << endl;
+	cout << "------------------------------ Simulation Performance --------------------------------" <<  endl;
+	
+	if (param->profile) {
+		ProfilePrint();
+		GateCachePrint();
+		if (!profileFile.empty()) {
+			ProfileWriteTrace(profileFile);
+		}
+	}
+	if (!reportFile.empty()) {
+		ReportSet("simulation", "runTime", duration.count(), "s");
+		ReportWrite(reportFile);
+	}
+	return 0;
+}
+
+vector<vector<double> > getNetStructure(const string &inputfile) {
+	PROFILE_SCOPE_TRACE("getNetStructure", 1);
+	ifstream infile(inputfile.c_str());      
+	string inputline;
+	string inputval;
+	
+	int ROWin=0, COLin=0;      
+	if (!infile.good()) {        
+		cerr << "Error: the input file cannot be opened!" << endl;
+		exit(1);
+	}else{
+		while (getline(infile, inputline, '\n')) {       
+			ROWin++;                                
+		}
+		infile.clear();
+		infile.seekg(0, ios::beg);      
+		if (getline(infile, inputline, '\n')) {        
+			istringstream iss (inputline);      
+			while (getline(iss, inputval, ',')) {       
+				COLin++;
+			}
+		}	
+	}
+	infile.clear();
+	infile.seekg(0, ios::beg);          
+
+	vector<vector<double> > netStructure;               
+	for (int row=0; row<ROWin; row++) {	
+		vector<double> netStructurerow;
+		getline(infile, inputline, '\n');             
+		istringstream iss;
+		iss.str(inputline);
+		for (int col=0; col<COLin; col++) {       
+			while(getline(iss, inputval, ',')){	
+				istringstream fs;
+				fs.str(inputval);
+				double f=0;
+				fs >> f;				
+				netStructurerow.push_back(f);			
+			}			
+		}		
+		LayerNormalize(&netStructurerow);      // fills in the optional columns (Chip.h)
+		netStructure.push_back(netStructurerow);
+	}
+	infile.close();
+	
+	return netStructure;
+	netStructure.clear();
+}	
+
+
+
@@ -0,0 +1,229 @@
+/*******************************************************************************
+* Copyright (c) 2015-2017
+* School of Electrical, Computer and Energy Engineering, Arizona State University
+* PI: Prof. Shimeng Yu
+* All rights reserved.
+* 
+* This source code is part of NeuroSim - a device-circuit-algorithm framework to benchmark 
+* neuro-inspired architectures with synaptic devices(e.g., SRAM and emerging non-volatile memory). 
+* Copyright of the model is maintained by the developers, and the model is distributed under 
+* the terms of the Creative Commons Attribution-NonCommercial 4.0 International Public License 
+* http://creativecommons.org/licenses/by-nc/4.0/legalcode.
+* The source code is free and you can redistribute and/or modify it
+* by providing that the following conditions are met:
+* 
+*  1) Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+* 
+*  2) Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+* 
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* 
+* Developer list: 
+*   Pai-Yu Chen	    Email: pchen72 at asu dot edu 
+*                    
+*   Xiaochen Peng   Email: xpeng15 at asu dot edu
+********************************************************************************/
+
+#include <cstdio>
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <stdlib.h>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include "formula.h"
+
+using namespace std;
+
+/*** Synthetic trace generator: the weight/input files of inference.py (utee/hook.py), without PyTorch ***/
+// usage: tracegen NetWork.csv weightBit inputBit outDir [--sparsity 0.5] [--seed 0]
+// writes outDir/weight<l>.csv and outDir/input<l>.csv for every layer l of the network, outDir/trace_command.sh to run main on them,
+// and prints the weight/input file arguments of main on stdout
+//
+// weight<l>.csv: (kh*kw*cin/groups) x cout, trained-WAGE-like weights: truncated normal with the variance of the WAGE initializer, quantized to weightBit
+// input<l>.csv:  (kh*kw*cin) x (numVector*inputBit), the bit-planes (sign bit first) of an activation map unrolled into sliding windows
+//                (with the stride, zero padding and dilation of the layer), the first layer is a signed dense image, 
+//                the others are ReLU outputs with the target fraction of zeros
+
+vector<vector<double> > ReadNetwork(const string &filename) {
+	ifstream file(filename.c_str());
+	if (!file.good()) {
+		cerr << "Error: the network file " << filename << " cannot be opened!" << endl;
+		exit(1);
+	}
+	vector<vector<double> > netStructure;
+	string line, value;
+	while (getline(file, line)) {
+		istringstream iss(line);
+		vector<double> layer;
+		while (getline(iss, value, ',')) {
+			layer.push_back(atof(value.c_str()));
+		}
+		if (layer.size() >= 6) {
+			// the optional columns of the layer descriptor (Chip.h): pooling, stride, padding, groups, dilation, activation, layer type, stored GEMM operand
+			const double defaultValue[14] = {0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0};
+			while (layer.size() < 14) {
+				layer.push_back(defaultValue[layer.size()]);
+			}
+			if (layer[12] > 0 && layer[13] == 1) {   // the stored left operand of a GEMM, as in LayerNormalize
+				swap(layer[0], layer[5]);
+			}
+			netStructure.push_back(layer);
+		}
+	}
+	return netStructure;
+}
+
+
+// the distributions of <random> differ between standard libraries, these only rely on the (fully specified) mt19937 sequence,
+// so the same seed gives the same traces everywhere (the regression goldens depend on it)
+double Uniform(mt19937 &traceGen) {
+	return (traceGen() + 0.5)/4294967296.0;     // (0, 1)
+}
+
+
+double Normal(mt19937 &traceGen, double sigma) {
+	// Box-Muller
+	double u1 = Uniform(traceGen), u2 = Uniform(traceGen);
+	return sigma*sqrt(-2*log(u1))*cos(2*M_PI*u2);
+}
+
+
+double Quantize(double x, int numBit) {
+	// wage_quantizer.Q: round to 2^-(numBit-1) steps inside (-1, 1)
+	double delta = pow(2, -(numBit-1));
+	x = round(x/delta)*delta;
+	return MIN(MAX(x, -1+delta), 1-delta);
+}
+
+
+void WriteWeight(const string &filename, int numRow, int numCol, int weightBit, mt19937 &traceGen) {
+	// WAGE initializer: uniform(-L, L) with L = max(sqrt(6/fanIn), 1.5/2^(weightBit-1)); trained weights keep that spread but look normal
+	double limit = MAX(sqrt(6.0/numRow), 1.5/pow(2, weightBit-1));
+	ofstream file(filename.c_str());
+	char buffer[32];
+	for (int i=0; i<numRow; i++) {
+		for (int j=0; j<numCol; j++) {
+			double w;
+			do {
+				w = Normal(traceGen, limit/sqrt(3.0));
+			} while (fabs(w) > 2*limit/sqrt(3.0));     // truncated at 2 sigma, as truncated_normal_
+			snprintf(buffer, sizeof(buffer), "%10.5f", Quantize(w, weightBit));
+			file << buffer << (j < numCol-1? "," : "\n");
+		}
+	}
+	file.close();
+}
+
+
+void WriteInput(const string &filename, const vector<double> &layer, bool firstLayer, int inputBit, double sparsity, mt19937 &traceGen) {
+	int height = layer[0], width = layer[1], numChannel = layer[2], kernelHeight = layer[3], kernelWidth = layer[4];
+	int stride = layer[7], padding = layer[8], dilation = layer[10];
+	double delta = pow(2, -(inputBit-1));
+	
+	// activation map (channel, y, x)
+	double sigma = firstLayer? 0.5 : 0.25;
+	vector<double> map(numChannel*height*width);
+	for (int i=0; i<map.size(); i++) {
+		if (!firstLayer && Uniform(traceGen) < sparsity) {
+			map[i] = 0;
+		} else if (firstLayer) {
+			map[i] = Quantize(Normal(traceGen, sigma), inputBit);
+		} else {
+			map[i] = Quantize(MAX(fabs(Normal(traceGen, sigma)), delta), inputBit);    // non-zero ReLU outputs stay non-zero after quantization
+		}
+	}
+	
+	// sliding windows (hook.py stretch_input), one row per (channel, ky, kx), inputBit columns per window (dec2bin, sign bit first)
+	int numWindowY = (height + 2*padding - dilation*(kernelHeight-1) - 1)/stride + 1;
+	int numWindowX = (width + 2*padding - dilation*(kernelWidth-1) - 1)/stride + 1;
+	int numRow = numChannel*kernelHeight*kernelWidth;
+	vector<vector<int> > bitPlane(numRow, vector<int>(numWindowY*numWindowX*inputBit));
+	for (int y=0; y<numWindowY; y++) {
+		for (int x=0; x<numWindowX; x++) {
+			int window = y*numWindowX + x;
+			for (int c=0; c<numChannel; c++) {
+				for (int ky=0; ky<kernelHeight; ky++) {
+					for (int kx=0; kx<kernelWidth; kx++) {
+						int row = (c*kernelHeight + ky)*kernelWidth + kx;
+						int mapY = y*stride - padding + ky*dilation, mapX = x*stride - padding + kx*dilation;
+						double a = (mapY < 0 || mapY >= height || mapX < 0 || mapX >= width)? 0 : map[(c*height + mapY)*width + mapX];
+						int level = round(a/delta);
+						int code = (level < 0)? level + (1 << inputBit) : level;       // two's complement
+						for (int b=0; b<inputBit; b++) {
+							bitPlane[row][window*inputBit + b] = (code >> (inputBit-1-b)) & 1;
+						}
+					}
+				}
+			}
+		}
+	}
+	
+	ofstream file(filename.c_str());
+	for (int i=0; i<numRow; i++) {
+		string line;
+		line.reserve(2*bitPlane[i].size());
+		for (int j=0; j<bitPlane[i].size(); j++) {
+			line += (bitPlane[i][j]? '1' : '0');
+			line += (j < bitPlane[i].size()-1? ',' : '\n');
+		}
+		file << line;
+	}
+	file.close();
+}
+
+
+int main(int argc, char * argv[]) {
+	
+	double sparsity = 0.5;
+	int seed = 0;
+	vector<string> args;
+	for (int i=1; i<argc; i++) {
+		if (string(argv[i]) == "--sparsity" && i+1 < argc) {
+			sparsity = atof(argv[++i]);
+		} else if (string(argv[i]) == "--seed" && i+1 < argc) {
+			seed = atoi(argv[++i]);
+		} else {
+			args.push_back(argv[i]);
+		}
+	}
+	if (args.size() != 4) {
+		cerr << "usage: " << argv[0] << " NetWork.csv weightBit inputBit outDir [--sparsity 0.5] [--seed 0]" << endl;
+		return 1;
+	}
+	string networkFile = args[0], outDir = args[3];
+	int weightBit = atoi(args[1].c_str());
+	int inputBit = atoi(args[2].c_str());
+	
+	vector<vector<double> > netStructure = ReadNetwork(networkFile);
+	mt19937 traceGen(seed);
+	string arguments;
+	for (int l=0; l<netStructure.size(); l++) {
+		string weightFile = outDir + "/weight" + to_string(l+1) + ".csv";
+		string inputFile = outDir + "/input" + to_string(l+1) + ".csv";
+		WriteWeight(weightFile, netStructure[l][2]/netStructure[l][9]*netStructure[l][3]*netStructure[l][4], netStructure[l][5], weightBit, traceGen);
+		WriteInput(inputFile, netStructure[l], l == 0, inputBit, sparsity, traceGen);
+		arguments += (l > 0? " " : "") + weightFile + " " + inputFile;
+	}
+	
+	ofstream command((outDir + "/trace_command.sh").c_str());
+	command << "./main " << networkFile << " " << weightBit << " " << inputBit << " " << arguments << endl;
+	command.close();
+	cout << arguments << endl;
+	return 0;
+}
@@ -16,7 +16,7 @@ def Neural_Sim(self, input, output):
     write_matrix_weight( weight_q.cpu().data.numpy(),weight_file_name)
     if len(self.weight.shape) > 2:
         k=self.weight.shape[-1]
-        write_matrix_activation_conv(stretch_input(input[0].cpu().data.numpy(),k),None,self.wl_input,input_file_name)
+        write_matrix_activation_conv(stretch_input(input[0].cpu().data.numpy(),k,self.stride[0],self.padding[0],self.dilation[0]),None,self.wl_input,input_file_name)
     else:
         write_matrix_activation_fc(input[0].cpu().data.numpy(),None ,self.wl_input, input_file_name)
 
@@ -44,15 +44,21 @@ def write_matrix_activation_fc(input_matrix,fill_dimension,length,filename):
         filled_matrix_b[:,i] =  b
     np.savetxt(filename, filled_matrix_b, delimiter=",",fmt='%s')
 
-def stretch_input(input_matrix,window_size = 5):
+def stretch_input(input_matrix,window_size = 5,stride = 1,padding = 0,dilation = 1):
+    # one window per output pixel, as the stride/padding/dilation columns of NetWork.csv (grouped layers still unroll all input channels)
+    if padding > 0:
+        input_matrix = np.pad(input_matrix, ((0,0),(0,0),(padding,padding),(padding,padding)), 'constant')
     input_shape = input_matrix.shape
-    item_num = (input_shape[2] - window_size + 1) * (input_shape[3]-window_size + 1)
+    span = dilation*(window_size-1) + 1
+    num_row = (input_shape[2] - span)//stride + 1
+    num_col = (input_shape[3] - span)//stride + 1
+    item_num = num_row * num_col
     output_matrix = np.zeros((input_shape[0],item_num,input_shape[1]*window_size*window_size))
     iter = 0
-    for i in range( input_shape[2]-window_size + 1 ):
-        for j in range( input_shape[3]-window_size + 1 ):
+    for i in range( num_row ):
+        for j in range( num_col ):
             for b in range(input_shape[0]):
-                output_matrix[b,iter,:] = input_matrix[b, :, i:i+window_size,j: j+window_size].reshape(input_shape[1]*window_size*window_size)
+                output_matrix[b,iter,:] = input_matrix[b, :, i*stride:i*stride+span:dilation,j*stride:j*stride+span:dilation].reshape(input_shape[1]*window_size*window_size)
             iter += 1
 
     return output_matrix